@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,4 +24,45 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListGetNextCommandId(
+    zex_command_list_handle_t hCommandList,
+    uint64_t *pCommandId);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableKernelArgument(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t argIndex,
+    size_t argSize,
+    const void *pArgValue);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupCount(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    const ze_group_count_t *pGroupCount);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableGroupSize(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t groupSizeX,
+    uint32_t groupSizeY,
+    uint32_t groupSizeZ);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateMutableSignalEvent(
+    zex_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    zex_event_handle_t hSignalEvent);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    zex_command_list_handle_t hCommandList);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t *phGraph);
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendGraph(
+    zex_command_list_handle_t hCommandList,
+    zex_command_list_handle_t hGraph);
 } // namespace L0
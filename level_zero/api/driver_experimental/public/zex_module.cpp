@@ -18,6 +18,13 @@ zexKernelGetBaseAddress(
     return L0::Kernel::fromHandle(hKernel)->getBaseAddress(baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexModuleBuildSynchronize(
+    ze_module_handle_t hModule,
+    uint64_t timeout) {
+    return L0::Module::fromHandle(hModule)->synchronizeBuild(timeout);
+}
+
 } // namespace L0
 
 extern "C" {
@@ -28,4 +35,11 @@ zexKernelGetBaseAddress(
     uint64_t *baseAddress) {
     return L0::zexKernelGetBaseAddress(hKernel, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexModuleBuildSynchronize(
+    ze_module_handle_t hModule,
+    uint64_t timeout) {
+    return L0::zexModuleBuildSynchronize(hModule, timeout);
+}
 }
@@ -18,6 +18,11 @@ zexKernelGetBaseAddress(
     ze_kernel_handle_t hKernel,
     uint64_t *baseAddress);
 
+ze_result_t ZE_APICALL
+zexModuleBuildSynchronize(
+    ze_module_handle_t hModule,
+    uint64_t timeout);
+
 }
 
 #endif // _ZEX_MODULE_H
@@ -183,6 +183,16 @@ struct CommandList : _ze_command_list_handle_t {
                                             uint64_t data) = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
 
+    virtual ze_result_t enableMutableCommands() = 0;
+    virtual ze_result_t getNextMutableCommandId(uint64_t *pCommandId) = 0;
+    virtual ze_result_t updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) = 0;
+    virtual ze_result_t updateMutableGroupCount(uint64_t commandId, const ze_group_count_t *pGroupCount) = 0;
+    virtual ze_result_t updateMutableGroupSize(uint64_t commandId, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ) = 0;
+    virtual ze_result_t updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) = 0;
+    virtual ze_result_t beginGraphCapture() = 0;
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) = 0;
+    virtual ze_result_t appendGraph(ze_command_list_handle_t hGraph) = 0;
+
     static CommandList *create(uint32_t productFamily, Device *device, NEO::EngineGroupType engineGroupType,
                                ze_command_list_flags_t flags, ze_result_t &resultValue);
     static CommandList *createImmediate(uint32_t productFamily, Device *device,
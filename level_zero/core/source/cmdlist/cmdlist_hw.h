@@ -14,12 +14,14 @@
 #include "shared/source/kernel/kernel_arg_descriptor.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/helpers/mutable_cmd_helpers.h"
 
 #include "igfxfmid.h"
 
 namespace NEO {
 enum class MemoryPool;
 enum class ImageType;
+struct EncodeDispatchKernelArgs;
 } // namespace NEO
 
 namespace L0 {
@@ -170,6 +172,16 @@ struct CommandListCoreFamily : CommandListImp {
                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
+    ze_result_t enableMutableCommands() override;
+    ze_result_t getNextMutableCommandId(uint64_t *pCommandId) override;
+    ze_result_t updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) override;
+    ze_result_t updateMutableGroupCount(uint64_t commandId, const ze_group_count_t *pGroupCount) override;
+    ze_result_t updateMutableGroupSize(uint64_t commandId, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ) override;
+    ze_result_t updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) override;
+    ze_result_t beginGraphCapture() override;
+    ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) override;
+    ze_result_t appendGraph(ze_command_list_handle_t hGraph) override;
+
     ze_result_t appendSignalEvent(ze_event_handle_t hEvent) override;
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) override;
     void appendWaitOnInOrderDependency(std::shared_ptr<InOrderExecInfo> &inOrderExecInfo, uint64_t waitValue, uint32_t offset, bool relaxedOrderingAllowed, bool implicitDependency);
@@ -340,9 +352,18 @@ struct CommandListCoreFamily : CommandListImp {
     bool hasInOrderDependencies() const;
 
     void addCmdForPatching(std::shared_ptr<InOrderExecInfo> *externalInOrderExecInfo, void *cmd1, void *cmd2, uint64_t counterValue, InOrderPatchCommandHelpers::PatchCmdType patchCmdType);
+    void appendPublishRelativeInOrderCounter(uint64_t relativeValue, bool waitForRelativeValue);
+    void appendRelativeInOrderCountersEpilogue();
 
     InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
 
+    void addMutableKernelDispatch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, Event *patchableSignalEvent);
+    MutableCommandHelpers::MutableKernelDispatch<GfxFamily> *getMutableKernelDispatch(uint64_t commandId);
+    void programMutableKernelDispatch(MutableCommandHelpers::MutableKernelDispatch<GfxFamily> &mutableDispatch);
+
+    MutableKernelDispatchesContainer<GfxFamily> mutableKernelDispatches;
+    bool mutableCommandsEnabled = false;
+
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
 };
 
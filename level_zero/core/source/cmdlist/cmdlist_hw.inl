@@ -143,6 +143,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
 
     if (inOrderExecInfo) {
         inOrderExecInfo->inOrderDependencyCounter = 0;
+        if (isRelativeInOrderCountersEnabled()) {
+            // submission base in GPU memory is cleared below, host side has to start over as well
+            inOrderExecInfo->regularCmdListSubmissionCounter = 0;
+        }
 
         auto &inOrderDependencyCounterAllocation = inOrderExecInfo->inOrderDependencyCounterAllocation;
         memset(inOrderDependencyCounterAllocation.getUnderlyingBuffer(), 0, inOrderDependencyCounterAllocation.getUnderlyingBufferSize());
@@ -151,6 +155,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
 
     this->inOrderPatchCmds.clear();
+    this->mutableKernelDispatches.clear();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -167,7 +172,12 @@ void CommandListCoreFamily<gfxCoreFamily>::handleInOrderDependencyCounter(Event
 
         inOrderAllocationOffset += offset;
 
-        UNRECOVERABLE_IF(inOrderAllocationOffset + offset >= inOrderExecInfo->inOrderDependencyCounterAllocation.getUnderlyingBufferSize());
+        size_t counterAllocationSize = inOrderExecInfo->inOrderDependencyCounterAllocation.getUnderlyingBufferSize();
+        if (isRelativeInOrderCountersEnabled()) {
+            counterAllocationSize -= InOrderExecInfo::relativeCountersStateSize;
+        }
+
+        UNRECOVERABLE_IF(inOrderAllocationOffset + offset >= counterAllocationSize);
 
         CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyCounter(); // write 1 on new offset
     }
@@ -319,6 +329,10 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
+    if (isRelativeInOrderCountersEnabled()) {
+        appendRelativeInOrderCountersEpilogue();
+    }
+
     commandContainer.removeDuplicatesFromResidencyContainer();
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
@@ -2375,6 +2389,12 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(std::sh
 
     uint64_t gpuAddress = dependencyCounterAllocation.getGpuAddress() + offset;
 
+    // Own counter is tracked relative to current submission, wait value doesn't depend on submission count
+    const bool relativeWait = implicitDependency && isRelativeInOrderCountersEnabled();
+    if (relativeWait) {
+        gpuAddress = inOrderExecInfo->getRelativeCounterGpuAddress();
+    }
+
     for (uint32_t i = 0; i < this->partitionCount; i++) {
         if (relaxedOrderingAllowed) {
             NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programConditionalDataMemBatchBufferStart(*commandContainer.getCommandStream(), 0, gpuAddress, waitValue, NEO::CompareOperation::Less, true, isQwordInOrderCounter());
@@ -2390,7 +2410,7 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(std::sh
                 auto lri1 = NEO::LriHelper<GfxFamily>::program(commandContainer.getCommandStream(), CS_GPR_R0, getLowPart(waitValue), true);
                 auto lri2 = NEO::LriHelper<GfxFamily>::program(commandContainer.getCommandStream(), CS_GPR_R0 + 4, getHighPart(waitValue), true);
 
-                if (inOrderExecInfo->isRegularCmdList) {
+                if (inOrderExecInfo->isRegularCmdList && !relativeWait) {
                     addCmdForPatching((implicitDependency ? nullptr : &inOrderExecInfo), lri1, lri2, waitValue, InOrderPatchCommandHelpers::PatchCmdType::Lri64b);
                 }
             }
@@ -2400,7 +2420,7 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(std::sh
             NEO::EncodeSemaphore<GfxFamily>::programMiSemaphoreWait(semaphoreCommand, gpuAddress, waitValue, COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD,
                                                                     false, true, isQwordInOrderCounter(), indirectMode);
 
-            if (inOrderExecInfo->isRegularCmdList && !isQwordInOrderCounter()) {
+            if (inOrderExecInfo->isRegularCmdList && !isQwordInOrderCounter() && !relativeWait) {
                 addCmdForPatching((implicitDependency ? nullptr : &inOrderExecInfo), semaphoreCommand, nullptr, waitValue, InOrderPatchCommandHelpers::PatchCmdType::Semaphore);
             }
         }
@@ -2520,13 +2540,20 @@ void CommandListCoreFamily<gfxCoreFamily>::appendSignalInOrderDependencyCounter(
     uint64_t signalValue = inOrderExecInfo->inOrderDependencyCounter + 1;
 
     uint64_t gpuVa = inOrderExecInfo->inOrderDependencyCounterAllocation.getGpuAddress() + this->inOrderAllocationOffset;
+    if (isRelativeInOrderCountersEnabled()) {
+        gpuVa = inOrderExecInfo->getRelativeCounterGpuAddress();
+    }
 
     auto miStoreCmd = reinterpret_cast<MI_STORE_DATA_IMM *>(commandContainer.getCommandStream()->getSpace(sizeof(MI_STORE_DATA_IMM)));
 
     NEO::EncodeStoreMemory<GfxFamily>::programStoreDataImm(miStoreCmd, gpuVa, getLowPart(signalValue), getHighPart(signalValue),
                                                            isQwordInOrderCounter(), (this->partitionCount > 1));
 
-    addCmdForPatching(nullptr, miStoreCmd, nullptr, signalValue, InOrderPatchCommandHelpers::PatchCmdType::Sdi);
+    if (isRelativeInOrderCountersEnabled()) {
+        appendPublishRelativeInOrderCounter(signalValue, false);
+    } else {
+        addCmdForPatching(nullptr, miStoreCmd, nullptr, signalValue, InOrderPatchCommandHelpers::PatchCmdType::Sdi);
+    }
 
     if (NEO::EncodeUserInterruptHelper::isOperationAllowed(NEO::EncodeUserInterruptHelper::onSignalingFenceMask)) {
         NEO::EnodeUserInterrupt<GfxFamily>::encode(*commandContainer.getCommandStream());
@@ -3574,6 +3601,56 @@ void CommandListCoreFamily<gfxCoreFamily>::patchInOrderCmds() {
         }
     }
 }
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendPublishRelativeInOrderCounter(uint64_t relativeValue, bool waitForRelativeValue) {
+    if (waitForRelativeValue) {
+        CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(inOrderExecInfo, relativeValue, this->inOrderAllocationOffset, false, true);
+    }
+
+    auto cmdStream = commandContainer.getCommandStream();
+    auto submissionBaseGpuVa = inOrderExecInfo->getSubmissionBaseGpuAddress();
+
+    NEO::EncodeSetMMIO<GfxFamily>::encodeMEM(*cmdStream, CS_GPR_R0, submissionBaseGpuVa);
+    NEO::EncodeSetMMIO<GfxFamily>::encodeMEM(*cmdStream, CS_GPR_R0 + 4, submissionBaseGpuVa + 4);
+    NEO::LriHelper<GfxFamily>::program(cmdStream, CS_GPR_R1, getLowPart(relativeValue), true);
+    NEO::LriHelper<GfxFamily>::program(cmdStream, CS_GPR_R1 + 4, getHighPart(relativeValue), true);
+    NEO::EncodeMath<GfxFamily>::addition(*cmdStream, AluRegisters::R_0, AluRegisters::R_1, AluRegisters::R_2);
+
+    uint64_t counterGpuVa = inOrderExecInfo->inOrderDependencyCounterAllocation.getGpuAddress() + this->inOrderAllocationOffset;
+
+    NEO::EncodeStoreMMIO<GfxFamily>::encode(*cmdStream, CS_GPR_R2, counterGpuVa, false);
+    if (isQwordInOrderCounter()) {
+        NEO::EncodeStoreMMIO<GfxFamily>::encode(*cmdStream, CS_GPR_R2 + 4, counterGpuVa + 4, false);
+    }
+
+    commandContainer.addToResidencyContainer(&inOrderExecInfo->inOrderDependencyCounterAllocation);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendRelativeInOrderCountersEpilogue() {
+    const uint64_t counterIncrement = inOrderExecInfo->inOrderDependencyCounter;
+    if (counterIncrement == 0) {
+        return;
+    }
+
+    auto cmdStream = commandContainer.getCommandStream();
+    auto submissionBaseGpuVa = inOrderExecInfo->getSubmissionBaseGpuAddress();
+
+    // Next submission continues from where this one ends, same as getAppendCounterValue() on host side
+    NEO::EncodeSetMMIO<GfxFamily>::encodeMEM(*cmdStream, CS_GPR_R0, submissionBaseGpuVa);
+    NEO::EncodeSetMMIO<GfxFamily>::encodeMEM(*cmdStream, CS_GPR_R0 + 4, submissionBaseGpuVa + 4);
+    NEO::LriHelper<GfxFamily>::program(cmdStream, CS_GPR_R1, getLowPart(counterIncrement), true);
+    NEO::LriHelper<GfxFamily>::program(cmdStream, CS_GPR_R1 + 4, getHighPart(counterIncrement), true);
+    NEO::EncodeMath<GfxFamily>::addition(*cmdStream, AluRegisters::R_0, AluRegisters::R_1, AluRegisters::R_2);
+    NEO::EncodeStoreMMIO<GfxFamily>::encode(*cmdStream, CS_GPR_R2, submissionBaseGpuVa, false);
+    NEO::EncodeStoreMMIO<GfxFamily>::encode(*cmdStream, CS_GPR_R2 + 4, submissionBaseGpuVa + 4, false);
+
+    // All walkers signaling the local counter were waited for when publishing their values
+    NEO::EncodeStoreMemory<GfxFamily>::programStoreDataImm(*cmdStream, inOrderExecInfo->getRelativeCounterGpuAddress(), 0, 0, true, false);
+
+    commandContainer.addToResidencyContainer(&inOrderExecInfo->inOrderDependencyCounterAllocation);
+}
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamily<gfxCoreFamily>::hasInOrderDependencies() const {
     return (inOrderExecInfo.get() && inOrderExecInfo->inOrderDependencyCounter > 0);
@@ -3594,4 +3671,279 @@ void CommandListCoreFamily<gfxCoreFamily>::handleCounterBasedEventTransition(Eve
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::enableMutableCommands() {
+    if (!GfxFamily::walkerPostSyncSupport || (this->cmdListType != TYPE_REGULAR)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    this->mutableCommandsEnabled = true;
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::getNextMutableCommandId(uint64_t *pCommandId) {
+    if (!this->mutableCommandsEnabled) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (nullptr == pCommandId) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    *pCommandId = this->mutableKernelDispatches.size();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::addMutableKernelDispatch(Kernel *kernel, const ze_group_count_t &threadGroupDimensions, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, Event *patchableSignalEvent) {
+    UNRECOVERABLE_IF(!dispatchKernelArgs.outWalkerPtr);
+
+    auto &mutableDispatch = this->mutableKernelDispatches.emplace_back(kernel, dispatchKernelArgs.outWalkerPtr, dispatchKernelArgs.outIndirectDataPtr,
+                                                                        kernel->getCrossThreadData(), kernel->getCrossThreadDataSize());
+    auto groupSize = kernel->getGroupSize();
+    mutableDispatch.groupSize[0] = groupSize[0];
+    mutableDispatch.groupSize[1] = groupSize[1];
+    mutableDispatch.groupSize[2] = groupSize[2];
+    mutableDispatch.groupCount[0] = threadGroupDimensions.groupCountX;
+    mutableDispatch.groupCount[1] = threadGroupDimensions.groupCountY;
+    mutableDispatch.groupCount[2] = threadGroupDimensions.groupCountZ;
+    mutableDispatch.numThreadsPerThreadGroup = kernel->getNumThreadsPerThreadGroup();
+    mutableDispatch.threadExecutionMask = MutableCommandHelpers::getThreadExecutionMask(kernel->getKernelDescriptor().kernelAttributes.simdSize,
+                                                                                        groupSize[0] * groupSize[1] * groupSize[2]);
+    mutableDispatch.requiredWorkgroupOrder = kernel->getRequiredWorkgroupOrder();
+    mutableDispatch.partitionCount = dispatchKernelArgs.partitionCount;
+    mutableDispatch.slmTotalSize = kernel->getSlmTotalSize();
+    mutableDispatch.slmPolicy = kernel->getSlmPolicy();
+    mutableDispatch.isIndirect = dispatchKernelArgs.isIndirect;
+    mutableDispatch.localIdsGenerationByRuntime = kernel->requiresGenerationOfLocalIdsByRuntime();
+    mutableDispatch.hasImplicitArgs = (kernel->getImplicitArgs() != nullptr);
+    if (patchableSignalEvent) {
+        mutableDispatch.signalEventAddress = dispatchKernelArgs.eventAddress;
+        mutableDispatch.isTimestampEvent = dispatchKernelArgs.isTimestampEvent;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+MutableCommandHelpers::MutableKernelDispatch<typename CommandListCoreFamily<gfxCoreFamily>::GfxFamily> *CommandListCoreFamily<gfxCoreFamily>::getMutableKernelDispatch(uint64_t commandId) {
+    if (!this->mutableCommandsEnabled || (commandId >= this->mutableKernelDispatches.size())) {
+        return nullptr;
+    }
+    return &this->mutableKernelDispatches[static_cast<size_t>(commandId)];
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programMutableKernelDispatch(MutableCommandHelpers::MutableKernelDispatch<GfxFamily> &mutableDispatch) {
+    if constexpr (GfxFamily::walkerPostSyncSupport) {
+        auto walkerCmd = reinterpret_cast<typename GfxFamily::COMPUTE_WALKER *>(mutableDispatch.walker);
+        if (!mutableDispatch.isIndirect) {
+            walkerCmd->setThreadGroupIdXDimension(mutableDispatch.groupCount[0]);
+            walkerCmd->setThreadGroupIdYDimension(mutableDispatch.groupCount[1]);
+            walkerCmd->setThreadGroupIdZDimension(mutableDispatch.groupCount[2]);
+        }
+        walkerCmd->setExecutionMask(mutableDispatch.threadExecutionMask);
+        if (walkerCmd->getGenerateLocalId()) {
+            walkerCmd->setLocalXMaximum(mutableDispatch.groupSize[0] - 1);
+            walkerCmd->setLocalYMaximum(mutableDispatch.groupSize[1] - 1);
+            walkerCmd->setLocalZMaximum(mutableDispatch.groupSize[2] - 1);
+        }
+        if (mutableDispatch.signalEventAddress != 0) {
+            walkerCmd->getPostSync().setDestinationAddress(mutableDispatch.signalEventAddress);
+        }
+
+        auto neoDevice = device->getNEODevice();
+        const auto &kernelDescriptor = mutableDispatch.kernel->getKernelDescriptor();
+        auto &idd = walkerCmd->getInterfaceDescriptor();
+        idd.setNumberOfThreadsInGpgpuThreadGroup(mutableDispatch.numThreadsPerThreadGroup);
+        auto threadGroupCount = walkerCmd->getThreadGroupIdXDimension() * walkerCmd->getThreadGroupIdYDimension() * walkerCmd->getThreadGroupIdZDimension();
+        NEO::EncodeDispatchKernel<GfxFamily>::adjustInterfaceDescriptorData(idd, *neoDevice, neoDevice->getHardwareInfo(), threadGroupCount,
+                                                                            kernelDescriptor.kernelAttributes.numGrfRequired, *walkerCmd);
+        NEO::EncodeDispatchKernel<GfxFamily>::appendAdditionalIDDFields(&idd, neoDevice->getRootDeviceEnvironment(), mutableDispatch.numThreadsPerThreadGroup,
+                                                                        mutableDispatch.slmTotalSize, mutableDispatch.slmPolicy);
+    }
+    mutableDispatch.writeCrossThreadData();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableKernelArgument(uint64_t commandId, uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if (nullptr == mutableDispatch) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto &explicitArgs = mutableDispatch->kernel->getKernelDescriptor().payloadMappings.explicitArgs;
+    if (argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    const auto &arg = explicitArgs[argIndex];
+    auto crossThreadData = ArrayRef<uint8_t>(mutableDispatch->crossThreadData);
+
+    if (arg.is<NEO::ArgDescriptor::ArgTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            if (element.sourceOffset >= argSize) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            size_t bytesToCopy = std::min(static_cast<size_t>(element.size), argSize - element.sourceOffset);
+            auto pDst = ptrOffset(crossThreadData.begin(), element.offset);
+            if (pArgValue) {
+                memcpy_s(pDst, element.size, ptrOffset(pArgValue, element.sourceOffset), bytesToCopy);
+            } else {
+                memset(pDst, 0, bytesToCopy);
+            }
+        }
+    } else if (arg.is<NEO::ArgDescriptor::ArgTPointer>()) {
+        // Only stateless pointers can be patched in place, surface states and SLM layout are not tracked
+        const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+        if ((arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal) ||
+            NEO::isValidOffset(argAsPtr.bindful) || NEO::isValidOffset(argAsPtr.bindless) || NEO::isUndefinedOffset(argAsPtr.stateless)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+
+        uintptr_t gpuAddress = 0u;
+        if (pArgValue) {
+            const auto requestedAddress = *reinterpret_cast<void *const *>(pArgValue);
+            const auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+            auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(requestedAddress);
+            auto alloc = driverHandle->getDriverSystemMemoryAllocation(requestedAddress, 1u, device->getRootDeviceIndex(), &gpuAddress);
+            if (allocData) {
+                if (alloc == nullptr) {
+                    return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+                }
+                if (driverHandle->isRemoteResourceNeeded(requestedAddress, alloc, allocData, device) ||
+                    allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+                    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                }
+                commandContainer.addToResidencyContainer(alloc);
+                if (allocData->virtualReservationData) {
+                    for (const auto &mappedAllocationData : allocData->virtualReservationData->mappedAllocations) {
+                        commandContainer.addToResidencyContainer(mappedAllocationData.second->mappedAllocation->allocation);
+                    }
+                }
+            } else if (NEO::DebugManager.flags.DisableSystemPointerKernelArgument.get() != 1) {
+                gpuAddress = reinterpret_cast<uintptr_t>(requestedAddress);
+            } else {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        NEO::patchPointer(crossThreadData, argAsPtr, gpuAddress);
+    } else {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    mutableDispatch->writeCrossThreadData();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupCount(uint64_t commandId, const ze_group_count_t *pGroupCount) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if ((nullptr == mutableDispatch) || (nullptr == pGroupCount)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    // Partitioned, indirect and cooperative dispatches derive other state from group count
+    if (mutableDispatch->isIndirect || (mutableDispatch->partitionCount > 1) || mutableDispatch->hasImplicitArgs || mutableDispatch->kernel->usesSyncBuffer()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    mutableDispatch->groupCount[0] = pGroupCount->groupCountX;
+    mutableDispatch->groupCount[1] = pGroupCount->groupCountY;
+    mutableDispatch->groupCount[2] = pGroupCount->groupCountZ;
+    mutableDispatch->patchDispatchTraits(mutableDispatch->kernel->getKernelDescriptor());
+    programMutableKernelDispatch(*mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableGroupSize(uint64_t commandId, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if ((nullptr == mutableDispatch) || (0 == groupSizeX) || (0 == groupSizeY) || (0 == groupSizeZ)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    const auto &kernelDescriptor = mutableDispatch->kernel->getKernelDescriptor();
+    const auto &kernelAttributes = kernelDescriptor.kernelAttributes;
+    uint32_t groupSize[3] = {groupSizeX, groupSizeY, groupSizeZ};
+    auto itemsInGroup = groupSizeX * groupSizeY * groupSizeZ;
+    auto &gfxCoreHelper = device->getGfxCoreHelper();
+    if (itemsInGroup > gfxCoreHelper.calculateMaxWorkGroupSize(kernelDescriptor, static_cast<uint32_t>(device->getDeviceInfo().maxWorkGroupSize))) {
+        return ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION;
+    }
+    for (uint32_t i = 0u; i < 3u; i++) {
+        if ((kernelAttributes.requiredWorkgroupSize[i] != 0) && (kernelAttributes.requiredWorkgroupSize[i] != groupSize[i])) {
+            return ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION;
+        }
+    }
+
+    // Local ids generated by runtime are part of indirect data, size of which is fixed at append
+    if (mutableDispatch->isIndirect || mutableDispatch->hasImplicitArgs || mutableDispatch->localIdsGenerationByRuntime) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (kernelAttributes.numLocalIdChannels > 0) {
+        size_t localWorkSizes[3] = {groupSizeX, groupSizeY, groupSizeZ};
+        uint32_t requiredWorkgroupOrder = 0u;
+        bool localIdsGenerationByRuntime = NEO::EncodeDispatchKernel<GfxFamily>::isRuntimeLocalIdsGenerationRequired(
+            kernelAttributes.numLocalIdChannels,
+            localWorkSizes,
+            std::array<uint8_t, 3>{{kernelAttributes.workgroupWalkOrder[0], kernelAttributes.workgroupWalkOrder[1], kernelAttributes.workgroupWalkOrder[2]}},
+            kernelAttributes.flags.requiresWorkgroupWalkOrder,
+            requiredWorkgroupOrder,
+            kernelAttributes.simdSize);
+        if (localIdsGenerationByRuntime || (requiredWorkgroupOrder != mutableDispatch->requiredWorkgroupOrder)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    std::copy(std::begin(groupSize), std::end(groupSize), mutableDispatch->groupSize);
+    mutableDispatch->numThreadsPerThreadGroup = gfxCoreHelper.calculateNumThreadsPerThreadGroup(kernelAttributes.simdSize, itemsInGroup,
+                                                                                                 device->getHwInfo().capabilityTable.grfSize, true);
+    mutableDispatch->threadExecutionMask = MutableCommandHelpers::getThreadExecutionMask(kernelAttributes.simdSize, itemsInGroup);
+    mutableDispatch->patchDispatchTraits(kernelDescriptor);
+    programMutableKernelDispatch(*mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateMutableSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    auto mutableDispatch = getMutableKernelDispatch(commandId);
+    if ((nullptr == mutableDispatch) || (nullptr == hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Only events signaled by walker post sync alone can be replaced, without adding or removing commands
+    auto event = Event::fromHandle(hSignalEvent);
+    if ((mutableDispatch->signalEventAddress == 0) ||
+        (event->isUsingContextEndOffset() != mutableDispatch->isTimestampEvent) ||
+        event->isCounterBased() ||
+        getDcFlushRequired(event->isSignalScope()) ||
+        (this->signalAllEventPackets && (event->getMaxPacketsCount() > 1))) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    event->resetKernelCountAndPacketUsedCount();
+    event->setPacketsInUse(1u);
+    if (mutableDispatch->kernel->getPrintfBufferAllocation() != nullptr) {
+        event->setKernelForPrintf(mutableDispatch->kernel);
+    }
+    commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
+    addToMappedEventList(event);
+
+    mutableDispatch->signalEventAddress = event->getPacketAddress(this->device);
+    programMutableKernelDispatch(*mutableDispatch);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::beginGraphCapture() {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendGraph(ze_command_list_handle_t hGraph) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 } // namespace L0
@@ -427,6 +427,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     const CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numWaitEvents, phWaitEvents, launchParams, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
 
@@ -478,6 +482,10 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t &pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -512,6 +520,10 @@ bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isSkippingInOrderBarrierAllo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     bool isStallingOperation = true;
@@ -547,6 +559,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -605,6 +621,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch,
+                                                                     hSignalEvent, numWaitEvents, phWaitEvents, false, forceDisableCopyOnlyInOrderSignaling);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -659,6 +680,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -673,6 +698,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendSignalEvent(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -683,6 +712,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendEventReset(hSignalEvent);
+    }
+
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -723,6 +756,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingAllowed, bool trackDependencies, bool signalInOrderCompletion) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendWaitOnEvents(numEvents, phWaitEvents, false, trackDependencies, signalInOrderCompletion);
+    }
+
     bool allSignaled = true;
     for (auto i = 0u; i < numEvents; i++) {
         allSignaled &= (!this->dcFlushSupport && Event::fromHandle(phWaitEvents[i])->isAlreadyCompleted());
@@ -744,6 +781,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTime
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
 
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
     if (this->isFlushTaskSubmissionEnabled) {
         checkWaitEventsState(numWaitEvents, phWaitEvents);
@@ -780,6 +821,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     auto estimatedSize = commonImmediateCommandSize;
@@ -809,6 +854,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -830,6 +879,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -850,6 +903,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     checkAvailableSpace(numWaitEvents, false, commonImmediateCommandSize);
     if (this->isFlushTaskSubmissionEnabled) {
         checkWaitEventsState(numWaitEvents, phWaitEvents);
@@ -864,6 +921,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
                                                                                          ze_event_handle_t hSignalEvent,
                                                                                          uint32_t numWaitEvents,
                                                                                          ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendLaunchCooperativeKernel(kernelHandle, launchKernelArgs, hSignalEvent, numWaitEvents, waitEventHandles, false);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -878,6 +939,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchCooperati
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint32_t data, ze_event_handle_t signalEventHandle) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendWaitOnMemory(desc, ptr, data, signalEventHandle);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(desc, ptr, data, signalEventHandle);
     return flushImmediate(ret, true, false, false, false, signalEventHandle);
@@ -885,11 +950,57 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnMemory(vo
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteToMemory(void *desc, void *ptr, uint64_t data) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendWriteToMemory(desc, ptr, data);
+    }
+
     checkAvailableSpace(0, false, commonImmediateCommandSize);
     auto ret = CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(desc, ptr, data);
     return flushImmediate(ret, true, false, false, false, nullptr);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(uint32_t numKernels,
+                                                                                               const ze_kernel_handle_t *kernelHandles,
+                                                                                               const uint32_t *pNumLaunchArguments,
+                                                                                               const ze_group_count_t *pLaunchArgumentsBuffer,
+                                                                                               ze_event_handle_t hEvent,
+                                                                                               uint32_t numWaitEvents,
+                                                                                               ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer,
+                                                                                  hEvent, numWaitEvents, phWaitEvents, false);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsIndirect(numKernels, kernelHandles, pNumLaunchArguments, pLaunchArgumentsBuffer,
+                                                                                     hEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size, ze_memory_advice_t advice) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemAdvise(hDevice, ptr, size, advice);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(hDevice, ptr, size, advice);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr, size_t count) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendMemoryPrefetch(ptr, count);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(ptr, count);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
+                                                                                       const size_t *pOffsets, ze_event_handle_t hSignalEvent,
+                                                                                       uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    if (this->graphCaptureCommandList) {
+        return this->graphCaptureCommandList->appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+    return CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, TaskCountType taskCount, bool handlePostWaitOperations) {
     ze_result_t status = ZE_RESULT_SUCCESS;
@@ -1361,4 +1472,70 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::allocateOrReuseKernelPrivate
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    // Replayed graph would not advance in-order dependency counter of this command list
+    if (isInOrderExecutionEnabled()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (this->graphCaptureCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto productFamily = this->device->getHwInfo().platform.eProductFamily;
+    this->graphCaptureCommandList = CommandList::create(productFamily, this->device, this->engineGroupType, 0u, returnValue);
+    return returnValue;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    if (nullptr == phGraph) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (nullptr == this->graphCaptureCommandList) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto graph = this->graphCaptureCommandList;
+    this->graphCaptureCommandList = nullptr;
+
+    auto ret = graph->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        graph->destroy();
+        return ret;
+    }
+    *phGraph = graph->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendGraph(ze_command_list_handle_t hGraph) {
+    if (nullptr == hGraph) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    auto graph = CommandList::fromHandle(hGraph);
+    if ((graph->getCmdListType() != CommandList::CommandListType::TYPE_REGULAR) || (graph->isCopyOnly() != isCopyOnly())) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (isInOrderExecutionEnabled() || this->graphCaptureCommandList) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto ret = this->cmdQImmediate->executeCommandLists(1, &hGraph, nullptr, true);
+    if ((ret == ZE_RESULT_SUCCESS) && this->isSyncModeQueue) {
+        ret = hostSynchronize(std::numeric_limits<uint64_t>::max());
+    }
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    if (this->graphCaptureCommandList) {
+        this->graphCaptureCommandList->destroy();
+        this->graphCaptureCommandList = nullptr;
+    }
+    return BaseClass::destroy();
+}
+
 } // namespace L0
@@ -280,6 +280,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         dsh,                                                    // dynamicStateHeap
         reinterpret_cast<const void *>(&threadGroupDimensions), // threadGroupDimensions
         nullptr,                                                // outWalkerPtr
+        nullptr,                                                // outIndirectDataPtr
         &additionalCommands,                                    // additionalCommands
         kernelPreemptionMode,                                   // preemptionMode
         this->partitionCount,                                   // partitionCount
@@ -305,6 +306,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
             dispatchEventPostSyncOperation(eventForInOrderExec, Event::STATE_CLEARED, false, false, false, false);
         } else {
             dispatchKernelArgs.eventAddress = inOrderExecInfo->inOrderDependencyCounterAllocation.getGpuAddress() + this->inOrderAllocationOffset;
+            if (isRelativeInOrderCountersEnabled()) {
+                dispatchKernelArgs.eventAddress = inOrderExecInfo->getRelativeCounterGpuAddress();
+            }
             dispatchKernelArgs.postSyncImmValue = inOrderExecInfo->inOrderDependencyCounter + 1;
         }
     }
@@ -327,6 +331,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         }
     }
 
+    if (this->mutableCommandsEnabled && !launchParams.isBuiltInKernel && !launchParams.isKernelSplitOperation) {
+        // Signal event can be replaced later only when walker post sync is the sole command signaling it
+        bool patchableSignalEvent = event && (eventAddress != 0) && (dispatchKernelArgs.eventAddress == eventAddress) &&
+                                    !l3FlushEnable && (partitionCount == 1) &&
+                                    !(this->signalAllEventPackets && (event->getPacketsInUse() < event->getMaxPacketsCount()));
+        addMutableKernelDispatch(kernel, threadGroupDimensions, dispatchKernelArgs, patchableSignalEvent ? event : nullptr);
+    }
+
     if (inOrderExecSignalRequired) {
         if (inOrderNonWalkerSignalling) {
             if (!launchParams.skipInOrderNonWalkerSignaling) {
@@ -335,7 +347,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
             }
         } else {
             UNRECOVERABLE_IF(!dispatchKernelArgs.outWalkerPtr);
-            addCmdForPatching(nullptr, dispatchKernelArgs.outWalkerPtr, nullptr, dispatchKernelArgs.postSyncImmValue, InOrderPatchCommandHelpers::PatchCmdType::Walker);
+            if (isRelativeInOrderCountersEnabled()) {
+                appendPublishRelativeInOrderCounter(dispatchKernelArgs.postSyncImmValue, true);
+            } else {
+                addCmdForPatching(nullptr, dispatchKernelArgs.outWalkerPtr, nullptr, dispatchKernelArgs.postSyncImmValue, InOrderPatchCommandHelpers::PatchCmdType::Walker);
+            }
         }
     }
 
@@ -237,6 +237,9 @@ void CommandListImp::enableInOrderExecution() {
     memset(inOrderDependencyCounterAllocation->getUnderlyingBuffer(), 0, inOrderDependencyCounterAllocation->getUnderlyingBufferSize());
 
     inOrderExecInfo = std::make_shared<InOrderExecInfo>(*inOrderDependencyCounterAllocation, *device->getMemoryManager(), (this->cmdListType == TYPE_REGULAR));
+
+    relativeInOrderCounters = (NEO::DebugManager.flags.EnableInOrderRelativeCounters.get() == 1) && (this->cmdListType == TYPE_REGULAR) &&
+                              !isCopyOnly() && (this->partitionCount == 1);
 }
 
 void CommandListImp::storeReferenceTsToMappedEvents(bool isClearEnabled) {
@@ -32,6 +32,7 @@ struct CommandListImp : CommandList {
     void setStreamPropertiesDefaultSettings(NEO::StreamProperties &streamProperties);
     void enableInOrderExecution();
     bool isInOrderExecutionEnabled() const { return inOrderExecInfo.get(); }
+    bool isRelativeInOrderCountersEnabled() const { return relativeInOrderCounters; }
     void storeReferenceTsToMappedEvents(bool clear);
     void addToMappedEventList(Event *event);
     const std::vector<Event *> &peekMappedEventList() { return mappedTsEventList; }
@@ -41,6 +42,7 @@ struct CommandListImp : CommandList {
   protected:
     std::shared_ptr<InOrderExecInfo> inOrderExecInfo;
     uint32_t inOrderAllocationOffset = 0;
+    bool relativeInOrderCounters = false;
 
     ~CommandListImp() override = default;
 
@@ -9,7 +9,9 @@
 
 #include "shared/source/compiler_interface/default_cache_config.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/os_interface/debug_env_reader.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
@@ -20,6 +22,8 @@
 namespace NEO {
 CompilerCacheConfig getDefaultCompilerCacheConfig() {
     NEO::CompilerCacheConfig ret;
+    ret.memoryTierSize = getDefaultCompilerCacheMemoryTierSize();
+    ret.mapCachedBinaries = DebugManager.flags.BinaryCacheZeroCopyLoad.get();
 
     std::string keyName = L0::registryPath;
     keyName += "l0_cache_dir";
@@ -36,6 +40,11 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
         ret.cacheFileExtension = ".l0_cache";
     }
 
+    NEO::EnvironmentVariableReader envReader;
+    if (envReader.getSetting("NEO_CACHE_INDEXED_PACK", false)) {
+        ret.format = CompilerCacheFormat::indexedPack;
+    }
+
     return ret;
 }
 
@@ -223,6 +223,22 @@ ze_result_t DeviceImp::createCommandList(const ze_command_list_desc_t *desc,
     auto createCommandList = getCmdListCreateFunc(desc);
     *commandList = createCommandList(productFamily, this, engineGroupType, desc->flags, returnValue);
 
+    bool mutableCommandsRequested = false;
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        if (extendedDesc->stype == ZE_STRUCTURE_INTEL_MUTABLE_COMMAND_LIST_EXP_DESC) {
+            mutableCommandsRequested = true;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    if (mutableCommandsRequested && (*commandList != nullptr)) {
+        returnValue = CommandList::fromHandle(*commandList)->enableMutableCommands();
+        if (returnValue != ZE_RESULT_SUCCESS) {
+            CommandList::fromHandle(*commandList)->destroy();
+            *commandList = nullptr;
+        }
+    }
+
     return returnValue;
 }
 
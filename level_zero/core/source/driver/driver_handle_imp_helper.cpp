@@ -30,5 +30,8 @@ const std::vector<std::pair<std::string, uint32_t>> DriverHandleImp::extensionsS
     {ZE_RTAS_BUILDER_EXP_NAME, ZE_RTAS_BUILDER_EXP_VERSION_CURRENT},
 
     // Driver experimental extensions
-    {ZE_INTEL_DEVICE_MODULE_DP_PROPERTIES_EXP_NAME, ZE_INTEL_DEVICE_MODULE_DP_PROPERTIES_EXP_VERSION_CURRENT}};
+    {ZE_INTEL_DEVICE_MODULE_DP_PROPERTIES_EXP_NAME, ZE_INTEL_DEVICE_MODULE_DP_PROPERTIES_EXP_VERSION_CURRENT},
+    {ZE_INTEL_MODULE_ASYNC_BUILD_EXP_NAME, ZE_INTEL_MODULE_ASYNC_BUILD_EXP_VERSION_CURRENT},
+    {ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_NAME, ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_VERSION_CURRENT},
+    {ZE_INTEL_GRAPH_CAPTURE_EXP_NAME, ZE_INTEL_GRAPH_CAPTURE_EXP_VERSION_CURRENT}};
 } // namespace L0
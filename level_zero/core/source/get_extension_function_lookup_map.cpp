@@ -19,12 +19,21 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexDriverGetHostPointerBaseAddress);
 
     addToMap(lookupMap, zexKernelGetBaseAddress);
+    addToMap(lookupMap, zexModuleBuildSynchronize);
 
     addToMap(lookupMap, zexMemGetIpcHandles);
     addToMap(lookupMap, zexMemOpenIpcHandles);
 
     addToMap(lookupMap, zexCommandListAppendWaitOnMemory);
     addToMap(lookupMap, zexCommandListAppendWriteToMemory);
+    addToMap(lookupMap, zexCommandListGetNextCommandId);
+    addToMap(lookupMap, zexCommandListUpdateMutableKernelArgument);
+    addToMap(lookupMap, zexCommandListUpdateMutableGroupCount);
+    addToMap(lookupMap, zexCommandListUpdateMutableGroupSize);
+    addToMap(lookupMap, zexCommandListUpdateMutableSignalEvent);
+    addToMap(lookupMap, zexCommandListBeginGraphCapture);
+    addToMap(lookupMap, zexCommandListEndGraphCapture);
+    addToMap(lookupMap, zexCommandListAppendGraph);
 #undef addToMap
 
     return lookupMap;
@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/helpers/in_order_cmd_helpers.h"
 
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
 #include <cstdint>
@@ -22,4 +23,12 @@ InOrderExecInfo::InOrderExecInfo(NEO::GraphicsAllocation &inOrderDependencyCount
     : inOrderDependencyCounterAllocation(inOrderDependencyCounterAllocation), memoryManager(memoryManager), isRegularCmdList(isRegularCmdList) {
 }
 
+uint64_t InOrderExecInfo::getSubmissionBaseGpuAddress() const {
+    return inOrderDependencyCounterAllocation.getGpuAddress() + inOrderDependencyCounterAllocation.getUnderlyingBufferSize() - relativeCountersStateSize;
+}
+
+uint64_t InOrderExecInfo::getRelativeCounterGpuAddress() const {
+    return getSubmissionBaseGpuAddress() + sizeof(uint64_t);
+}
+
 } // namespace L0
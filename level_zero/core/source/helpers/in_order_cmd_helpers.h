@@ -28,6 +28,11 @@ struct InOrderExecInfo : public NEO::NonCopyableClass {
 
     InOrderExecInfo(NEO::GraphicsAllocation &inOrderDependencyCounterAllocation, NEO::MemoryManager &memoryManager, bool isRegularCmdList);
 
+    // Relative counters mode keeps submission base and cmdlist-local counter at the end of the allocation
+    static constexpr size_t relativeCountersStateSize = 2 * sizeof(uint64_t);
+    uint64_t getSubmissionBaseGpuAddress() const;
+    uint64_t getRelativeCounterGpuAddress() const;
+
     NEO::GraphicsAllocation &inOrderDependencyCounterAllocation;
     NEO::MemoryManager &memoryManager;
     uint64_t inOrderDependencyCounter = 0;
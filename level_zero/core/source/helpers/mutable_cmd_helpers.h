@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/simd_helper.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/kernel_arg_descriptor.h"
+#include "shared/source/kernel/kernel_descriptor.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace L0 {
+struct Kernel;
+
+namespace MutableCommandHelpers {
+inline uint32_t getThreadExecutionMask(uint32_t simdSize, uint32_t itemsInGroup) {
+    auto remainderSimdLanes = itemsInGroup & (simdSize - 1u);
+    auto threadExecutionMask = static_cast<uint32_t>(maxNBitValue(remainderSimdLanes));
+    if (!threadExecutionMask) {
+        threadExecutionMask = static_cast<uint32_t>(maxNBitValue((isSimd1(simdSize)) ? 32 : simdSize));
+    }
+    return threadExecutionMask;
+}
+
+// Kernel dispatch appended to mutable command list.
+// Cross-thread data is kept as encoded - first inlineDataSize bytes are in walker inline data, the remainder in indirect heap.
+template <typename GfxFamily>
+struct MutableKernelDispatch {
+    MutableKernelDispatch(Kernel *kernel, void *walker, void *indirectData, const uint8_t *crossThreadData, size_t crossThreadDataSize)
+        : kernel(kernel), walker(walker), indirectData(indirectData), crossThreadData(crossThreadData, crossThreadData + crossThreadDataSize) {
+        if constexpr (GfxFamily::walkerPostSyncSupport) {
+            auto walkerCmd = reinterpret_cast<typename GfxFamily::COMPUTE_WALKER *>(walker);
+            if (walkerCmd->getEmitInlineParameter()) {
+                inlineDataSize = std::min(sizeof(typename GfxFamily::INLINE_DATA), crossThreadDataSize);
+            }
+        }
+    }
+
+    void patchDispatchTraits(const NEO::KernelDescriptor &kernelDescriptor) {
+        auto dst = ArrayRef<uint8_t>(crossThreadData);
+        const auto &dispatchTraits = kernelDescriptor.payloadMappings.dispatchTraits;
+
+        uint32_t globalWorkSize[3] = {groupCount[0] * groupSize[0], groupCount[1] * groupSize[1], groupCount[2] * groupSize[2]};
+        NEO::patchVecNonPointer(dst, dispatchTraits.globalWorkSize, globalWorkSize);
+        NEO::patchVecNonPointer(dst, dispatchTraits.numWorkGroups, groupCount);
+        NEO::patchVecNonPointer(dst, dispatchTraits.localWorkSize, groupSize);
+        NEO::patchVecNonPointer(dst, dispatchTraits.localWorkSize2, groupSize);
+        NEO::patchVecNonPointer(dst, dispatchTraits.enqueuedLocalWorkSize, groupSize);
+
+        uint32_t workDim = 1;
+        if (globalWorkSize[2] > 1) {
+            workDim = 3;
+        } else if (globalWorkSize[1] > 1) {
+            workDim = 2;
+        }
+        NEO::patchNonPointer<uint32_t, uint32_t>(dst, dispatchTraits.workDim, workDim);
+    }
+
+    void writeCrossThreadData() {
+        if constexpr (GfxFamily::walkerPostSyncSupport) {
+            if (inlineDataSize > 0) {
+                auto walkerCmd = reinterpret_cast<typename GfxFamily::COMPUTE_WALKER *>(walker);
+                memcpy_s(walkerCmd->getInlineDataPointer(), inlineDataSize, crossThreadData.data(), inlineDataSize);
+            }
+        }
+        auto indirectDataSize = crossThreadData.size() - inlineDataSize;
+        if (indirectDataSize > 0) {
+            memcpy_s(indirectData, indirectDataSize, crossThreadData.data() + inlineDataSize, indirectDataSize);
+        }
+    }
+
+    Kernel *kernel = nullptr;
+    void *walker = nullptr;
+    void *indirectData = nullptr;
+    std::vector<uint8_t> crossThreadData;
+    size_t inlineDataSize = 0u;
+    uint64_t signalEventAddress = 0u;
+    uint32_t groupSize[3] = {};
+    uint32_t groupCount[3] = {};
+    uint32_t numThreadsPerThreadGroup = 0u;
+    uint32_t threadExecutionMask = 0u;
+    uint32_t requiredWorkgroupOrder = 0u;
+    uint32_t partitionCount = 1u;
+    uint32_t slmTotalSize = 0u;
+    NEO::SlmPolicy slmPolicy = NEO::SlmPolicy::SlmPolicyNone;
+    bool isIndirect = false;
+    bool isTimestampEvent = false;
+    bool localIdsGenerationByRuntime = false;
+    bool hasImplicitArgs = false;
+
+  protected:
+    MutableKernelDispatch() = delete;
+};
+
+} // namespace MutableCommandHelpers
+
+template <typename GfxFamily>
+using MutableKernelDispatchesContainer = std::vector<MutableCommandHelpers::MutableKernelDispatch<GfxFamily>>;
+
+} // namespace L0
@@ -39,6 +39,13 @@ struct KernelImmutableData {
                                             NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer,
                                             bool internalKernel);
 
+    // Binds kernel info without reading its metadata, initialize() has to be called before kernel is created
+    void initializeDeferred(NEO::KernelInfo *kernelInfo);
+
+    bool isInitializationDeferred() const {
+        return initializationDeferred;
+    }
+
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
     }
@@ -103,6 +110,7 @@ struct KernelImmutableData {
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     bool isaCopiedToAllocation = false;
+    bool initializationDeferred = false;
 };
 
 struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
@@ -72,6 +72,11 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
     this->kernelInfo = kernelInfo;
     this->kernelDescriptor = &kernelInfo->kernelDescriptor;
 
+    if (false == kernelInfo->kernelDescriptor.decodeDeferredMetadata()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
+    this->initializationDeferred = false;
+
     DeviceImp *deviceImp = static_cast<DeviceImp *>(device);
     auto neoDevice = deviceImp->getActiveDevice();
 
@@ -151,6 +156,13 @@ ze_result_t KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device
     return ZE_RESULT_SUCCESS;
 }
 
+void KernelImmutableData::initializeDeferred(NEO::KernelInfo *kernelInfo) {
+    UNRECOVERABLE_IF(kernelInfo == nullptr);
+    this->kernelInfo = kernelInfo;
+    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+    this->initializationDeferred = true;
+}
+
 void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer) {
     NEO::Linker::SegmentInfo globalData;
@@ -10,6 +10,7 @@
 #include "shared/source/command_stream/thread_arbitration_policy.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_walker_template_cache.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -181,6 +182,7 @@ struct KernelImp : Kernel {
     ze_result_t setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) override;
 
     NEO::ImplicitArgs *getImplicitArgs() const override { return pImplicitArgs.get(); }
+    NEO::DispatchWalkerTemplateCache *getWalkerTemplateCache() override { return &walkerTemplateCache; }
 
     KernelExt *getExtension(uint32_t extensionType);
 
@@ -258,6 +260,8 @@ struct KernelImp : Kernel {
         SuggestGroupSizeCacheEntry(size_t groupSize[3], uint32_t slmArgsTotalSize, size_t suggestedGroupSize[3]) : groupSize(groupSize), slmArgsTotalSize(slmArgsTotalSize), suggestedGroupSize(suggestedGroupSize){};
     };
     std::vector<SuggestGroupSizeCacheEntry> suggestGroupSizeCache;
+
+    NEO::DispatchWalkerTemplateCache walkerTemplateCache;
 };
 
 } // namespace L0
@@ -52,6 +52,7 @@ struct Module : _ze_module_handle_t {
                                        uint32_t numModules,
                                        ze_module_handle_t *phModules,
                                        ze_module_build_log_handle_t *phLog) = 0;
+    virtual ze_result_t synchronizeBuild(uint64_t timeout) = 0;
 
     virtual const KernelImmutableData *getKernelImmutableData(const char *kernelName) const = 0;
     virtual const std::vector<std::unique_ptr<KernelImmutableData>> &getKernelImmutableDataVector() const = 0;
@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/module/module_imp.h"
 
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/compiler_options_extra.h"
 #include "shared/source/compiler_interface/compiler_warnings/compiler_warnings.h"
@@ -39,6 +40,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -46,12 +48,15 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
+#include "level_zero/include/ze_intel_gpu.h"
 
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <chrono>
 #include <list>
 #include <memory>
+#include <tuple>
 #include <unordered_map>
 namespace L0 {
 
@@ -194,6 +199,7 @@ ze_result_t ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput &input
     }
 
     inputArgs.specializedValues = this->specConstantsValues;
+    inputArgs.allowCachedBinaryView = true;
 
     NEO::TranslationOutput compilerOuput = {};
     NEO::TranslationOutput::ErrorCode compilerErr;
@@ -216,6 +222,7 @@ ze_result_t ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput &input
     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
     this->unpackedDeviceBinary = std::move(compilerOuput.deviceBinary.mem);
     this->unpackedDeviceBinarySize = compilerOuput.deviceBinary.size;
+    this->cachedDeviceBinary = std::move(compilerOuput.cachedDeviceBinary);
     this->debugData = std::move(compilerOuput.debugData.mem);
     this->debugDataSize = compilerOuput.debugData.size;
 
@@ -362,7 +369,7 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    auto blob = getUnpackedDeviceBinary();
     NEO::SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
@@ -429,10 +436,14 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
         return ZE_RESULT_SUCCESS;
     }
 
+    if (this->cachedDeviceBinary != nullptr && NEO::isAnyPackedDeviceBinaryFormat(blob)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
     NEO::SingleDeviceBinary singleDeviceBinary = {};
     singleDeviceBinary.targetDevice = NEO::getTargetDevice(device->getNEODevice()->getRootDeviceEnvironment());
     singleDeviceBinary.buildOptions = this->options;
-    singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->unpackedDeviceBinary.get()), this->unpackedDeviceBinarySize);
+    singleDeviceBinary.deviceBinary = blob;
     singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
     singleDeviceBinary.debugData = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->debugData.get()), this->debugDataSize);
     std::string packWarnings;
@@ -449,6 +460,21 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     return ZE_RESULT_SUCCESS;
 }
 
+ArrayRef<const uint8_t> ModuleTranslationUnit::getUnpackedDeviceBinary() const {
+    if (this->cachedDeviceBinary != nullptr) {
+        return ArrayRef<const uint8_t>::fromAny(this->cachedDeviceBinary->getData().begin(), this->cachedDeviceBinary->getSize());
+    }
+    return ArrayRef<const uint8_t>::fromAny(this->unpackedDeviceBinary.get(), this->unpackedDeviceBinarySize);
+}
+
+ArrayRef<const uint8_t> ModuleTranslationUnit::getPackedDeviceBinary() const {
+    if (this->packedDeviceBinary == nullptr && this->cachedDeviceBinary != nullptr) {
+        // packed formats are not repacked when decoded in place from compiler cache
+        return getUnpackedDeviceBinary();
+    }
+    return ArrayRef<const uint8_t>::fromAny(this->packedDeviceBinary.get(), this->packedDeviceBinarySize);
+}
+
 void ModuleTranslationUnit::updateBuildLog(const std::string &newLogEntry) {
     if (newLogEntry.empty() || ('\0' == newLogEntry[0])) {
         return;
@@ -507,6 +533,7 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    this->waitForBuild();
     this->kernelImmDatas.clear();
     if (this->kernelsIsaParentRegion) {
         DEBUG_BREAK_IF(this->device->getNEODevice()->getMemoryManager() == nullptr);
@@ -523,13 +550,147 @@ NEO::Zebin::Debug::Segments ModuleImp::getZebinSegments() {
     return NEO::Zebin::Debug::Segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
 }
 
+ze_result_t getModuleDescExtensions(const ze_module_desc_t *desc, ModuleDescExtensions &extensions) {
+    auto extendedDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
+    while (extendedDesc) {
+        if (extendedDesc->stype == ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC) {
+            extensions.programExpDesc = reinterpret_cast<const ze_module_program_exp_desc_t *>(extendedDesc);
+        } else if (extendedDesc->stype == ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC) {
+            extensions.asyncBuildDesc = extendedDesc;
+        } else {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        extendedDesc = reinterpret_cast<const ze_base_desc_t *>(extendedDesc->pNext);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void ModuleBuildInputs::copyFrom(const ze_module_desc_t &srcDesc, const ze_module_program_exp_desc_t *srcProgramExpDesc) {
+    desc = srcDesc;
+    desc.pNext = nullptr;
+    desc.pConstants = nullptr;
+    if (srcDesc.pInputModule) {
+        inputModule.assign(srcDesc.pInputModule, srcDesc.pInputModule + srcDesc.inputSize);
+        desc.pInputModule = inputModule.data();
+    }
+    if (srcDesc.pBuildFlags) {
+        buildFlags = srcDesc.pBuildFlags;
+        desc.pBuildFlags = buildFlags.c_str();
+    }
+
+    if (srcProgramExpDesc == nullptr) {
+        return;
+    }
+    const auto count = srcProgramExpDesc->count;
+    programInputSizes.assign(srcProgramExpDesc->inputSizes, srcProgramExpDesc->inputSizes + count);
+    programInputModules.resize(count);
+    programInputModulePtrs.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        programInputModules[i].assign(srcProgramExpDesc->pInputModules[i], srcProgramExpDesc->pInputModules[i] + programInputSizes[i]);
+        programInputModulePtrs[i] = programInputModules[i].data();
+    }
+
+    programExpDesc = *srcProgramExpDesc;
+    programExpDesc.pNext = nullptr;
+    programExpDesc.pConstants = nullptr;
+    programExpDesc.inputSizes = programInputSizes.data();
+    programExpDesc.pInputModules = programInputModulePtrs.data();
+    if (srcProgramExpDesc->pBuildFlags) {
+        programBuildFlags.resize(count);
+        programBuildFlagPtrs.resize(count, nullptr);
+        for (uint32_t i = 0; i < count; i++) {
+            if (srcProgramExpDesc->pBuildFlags[i]) {
+                programBuildFlags[i] = srcProgramExpDesc->pBuildFlags[i];
+                programBuildFlagPtrs[i] = programBuildFlags[i].c_str();
+            }
+        }
+        programExpDesc.pBuildFlags = programBuildFlagPtrs.data();
+    }
+    desc.pNext = &programExpDesc;
+}
+
 ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
+    ModuleDescExtensions extensions;
+    if (auto result = getModuleDescExtensions(desc, extensions); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    if (extensions.asyncBuildDesc && this->type == ModuleType::User) {
+        return this->initializeAsync(desc, extensions, neoDevice);
+    }
+    return this->initializeModule(desc, neoDevice);
+}
+
+ze_result_t ModuleImp::initializeAsync(const ze_module_desc_t *desc, const ModuleDescExtensions &extensions, NEO::Device *neoDevice) {
+    auto buildInputs = std::make_unique<ModuleBuildInputs>();
+    buildInputs->copyFrom(*desc, extensions.programExpDesc);
+
+    // Sizes of specialization constants are known only to the compiler, so their values are read
+    // from user memory before returning to the caller
+    std::vector<std::tuple<const ze_module_constants_t *, const uint8_t *, size_t>> specConstants;
+    if (extensions.programExpDesc && extensions.programExpDesc->pConstants) {
+        for (uint32_t i = 0; i < extensions.programExpDesc->count; i++) {
+            specConstants.emplace_back(extensions.programExpDesc->pConstants[i], extensions.programExpDesc->pInputModules[i], extensions.programExpDesc->inputSizes[i]);
+        }
+    } else if (extensions.programExpDesc == nullptr && desc->format == ZE_MODULE_FORMAT_IL_SPIRV) {
+        specConstants.emplace_back(desc->pConstants, desc->pInputModule, desc->inputSize);
+    }
+    for (auto &[constants, input, inputSize] : specConstants) {
+        if (constants == nullptr) {
+            continue;
+        }
+        auto compilerInterface = neoDevice->getCompilerInterface();
+        if (!compilerInterface) {
+            return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
+        }
+        if (!this->translationUnit->processSpecConstantInfo(compilerInterface, constants, reinterpret_cast<const char *>(input), static_cast<uint32_t>(inputSize))) {
+            return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+        }
+    }
+
+    this->asyncBuildInputs = std::move(buildInputs);
+    auto threadPool = neoDevice->getExecutionEnvironment()->getBuildThreadPool();
+    auto build = [this, neoDevice]() {
+        this->buildResult = this->initializeModule(&this->asyncBuildInputs->desc, neoDevice);
+        this->asyncBuildInputs.reset();
+    };
+    this->asyncBuild = threadPool->enqueue(build).share();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ModuleImp::synchronizeBuild(uint64_t timeout) {
+    if (this->asyncBuild.valid()) {
+        auto build = this->asyncBuild;
+        if (timeout >= static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+            build.wait();
+        } else if (build.wait_for(std::chrono::nanoseconds(timeout)) != std::future_status::ready) {
+            return ZE_RESULT_NOT_READY;
+        }
+    }
+    return this->buildResult;
+}
+
+ze_result_t ModuleImp::waitForBuild() {
+    return this->synchronizeBuild(std::numeric_limits<uint64_t>::max());
+}
+
+ze_result_t ModuleImp::initializeModule(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
     bool linkageSuccessful = true;
     ze_result_t result = ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
 
+    auto phaseStart = std::chrono::steady_clock::now();
+    auto printPhaseTime = [&phaseStart](const char *phaseName) {
+        if (NEO::DebugManager.flags.PrintModuleLoadTimes.get()) {
+            auto phaseEnd = std::chrono::steady_clock::now();
+            auto elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(phaseEnd - phaseStart).count();
+            NEO::printDebugString(true, stdout, "Module load phase %s: %lld us\n", phaseName, static_cast<long long>(elapsedTime));
+            phaseStart = phaseEnd;
+        }
+    };
+
     if (result = this->initializeTranslationUnit(desc, neoDevice); result != ZE_RESULT_SUCCESS) {
         return result;
     }
+    printPhaseTime("translation unit");
     this->updateBuildLog(neoDevice);
     this->verifyDebugCapabilities();
     if (result = this->checkIfBuildShouldBeFailed(neoDevice); result != ZE_RESULT_SUCCESS) {
@@ -538,8 +699,9 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
     if (result = this->initializeKernelImmutableDatas(); result != ZE_RESULT_SUCCESS) {
         return result;
     }
+    printPhaseTime("kernel immutable data");
 
-    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
+    auto refBin = translationUnit->getUnpackedDeviceBinary();
     if (NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Zebin>(refBin)) {
         isZebinBinary = true;
     }
@@ -558,9 +720,11 @@ ze_result_t ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neo
 
     linkageSuccessful &= populateHostGlobalSymbolsMap(this->translationUnit->programInfo.globalsDeviceToHostNameMap);
     this->updateBuildLog(neoDevice);
+    printPhaseTime("linking");
 
     if ((this->isFullyLinked && this->type == ModuleType::User) || (this->kernelsIsaParentRegion && this->type == ModuleType::Builtin)) {
         this->transferIsaSegmentsToAllocation(neoDevice, nullptr);
+        printPhaseTime("ISA upload");
 
         if (device->getL0Debugger()) {
             auto allocs = getModuleAllocations();
@@ -607,6 +771,7 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->setIsaCopiedToAllocation();
         }
     } else {
+        std::vector<size_t> cpuTransfers;
         for (auto &kernelImmData : kernelImmDatas) {
             if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
                 continue;
@@ -614,8 +779,14 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->getIsaGraphicsAllocation()->setAubWritable(true, std::numeric_limits<uint32_t>::max());
             kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
 
+            auto useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation());
+            if (!useBlitter) {
+                // Copies done by CPU touch only their own allocation and can be executed in parallel
+                cpuTransfers.push_back(&kernelImmData - &this->kernelImmDatas[0]);
+                continue;
+            }
             auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
+            NEO::MemoryTransferHelper::transferMemoryToAllocation(useBlitter,
                                                                   *neoDevice,
                                                                   kernelImmData->getIsaGraphicsAllocation(),
                                                                   0u,
@@ -623,6 +794,34 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
                                                                   kernelHeapSize);
             kernelImmData->setIsaCopiedToAllocation();
         }
+
+        this->forEachKernel(cpuTransfers.size(), [&](size_t i) {
+            auto &kernelImmData = this->kernelImmDatas[cpuTransfers[i]];
+            auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
+            NEO::MemoryTransferHelper::transferMemoryToAllocation(false,
+                                                                  *neoDevice,
+                                                                  kernelImmData->getIsaGraphicsAllocation(),
+                                                                  0u,
+                                                                  kernelHeapPtr,
+                                                                  kernelHeapSize);
+            kernelImmData->setIsaCopiedToAllocation();
+        });
+    }
+}
+
+void ModuleImp::forEachKernel(size_t kernelsCount, const std::function<void(size_t)> &task) {
+    constexpr size_t minKernelsCountForParallelInitialization = 16u;
+    auto parallelInitialization = kernelsCount >= minKernelsCountForParallelInitialization;
+    if (NEO::DebugManager.flags.ParallelModuleInitialization.get() != -1) {
+        parallelInitialization = !!NEO::DebugManager.flags.ParallelModuleInitialization.get();
+    }
+
+    if (parallelInitialization) {
+        this->device->getNEODevice()->getExecutionEnvironment()->getBuildThreadPool()->parallelFor(kernelsCount, task);
+        return;
+    }
+    for (size_t i = 0lu; i < kernelsCount; i++) {
+        task(i);
     }
 }
 
@@ -642,17 +841,17 @@ inline ze_result_t ModuleImp::initializeTranslationUnit(const ze_module_desc_t *
     std::string buildOptions;
     std::string internalBuildOptions;
 
-    if (desc->pNext) {
-        const ze_base_desc_t *expDesc = reinterpret_cast<const ze_base_desc_t *>(desc->pNext);
-        if (expDesc->stype != ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC) {
-            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
-        }
+    ModuleDescExtensions extensions;
+    if (auto result = getModuleDescExtensions(desc, extensions); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    if (extensions.programExpDesc) {
         if (desc->format != ZE_MODULE_FORMAT_IL_SPIRV) {
             return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
         this->builtFromSPIRv = true;
-        const ze_module_program_exp_desc_t *programExpDesc =
-            reinterpret_cast<const ze_module_program_exp_desc_t *>(expDesc);
+        const ze_module_program_exp_desc_t *programExpDesc = extensions.programExpDesc;
         std::vector<const char *> inputSpirVs;
         std::vector<uint32_t> inputModuleSizes;
         std::vector<const ze_module_constants_t *> specConstants;
@@ -737,13 +936,13 @@ inline ze_result_t ModuleImp::initializeTranslationUnit(const ze_module_desc_t *
 
 inline ze_result_t ModuleImp::checkIfBuildShouldBeFailed(NEO::Device *neoDevice) {
     auto &rootDeviceEnvironment = neoDevice->getRootDeviceEnvironment();
-    auto containsStatefulAccess = NEO::AddressingModeHelper::containsStatefulAccess(translationUnit->programInfo.kernelInfos, false);
     auto isUserKernel = (type == ModuleType::User);
     auto isGeneratedByIgc = translationUnit->isGeneratedByIgc;
-    auto failBuildProgram = containsStatefulAccess &&
-                            isUserKernel &&
+    // Stateful access check is evaluated last as it may force decoding of deferred kernel metadata
+    auto failBuildProgram = isUserKernel &&
                             NEO::AddressingModeHelper::failBuildProgramWithStatefulAccess(rootDeviceEnvironment) &&
-                            isGeneratedByIgc;
+                            isGeneratedByIgc &&
+                            NEO::AddressingModeHelper::containsStatefulAccess(translationUnit->programInfo.kernelInfos, false);
     if (failBuildProgram) {
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     }
@@ -756,22 +955,58 @@ ze_result_t ModuleImp::initializeKernelImmutableDatas() {
         if (result = this->allocateKernelImmutableDatas(kernelsCount); result != ZE_RESULT_SUCCESS) {
             return result;
         }
+        auto computeUnitsUsedForScratch = device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch;
+        // Kernels with deferred metadata are initialized on first kernel creation, builtins and kernels under debugger are initialized upfront
+        auto allowDeferredInitialization = (this->type == ModuleType::User) && (nullptr == device->getNEODevice()->getDebugger());
+        auto results = std::vector<ze_result_t>(kernelsCount, ZE_RESULT_SUCCESS);
+        this->forEachKernel(kernelsCount, [&](size_t i) {
+            auto kernelInfo = this->translationUnit->programInfo.kernelInfos[i];
+            if (allowDeferredInitialization && kernelInfo->kernelDescriptor.hasDeferredMetadata()) {
+                kernelImmDatas[i]->initializeDeferred(kernelInfo);
+                return;
+            }
+            results[i] = kernelImmDatas[i]->initialize(kernelInfo,
+                                                       device,
+                                                       computeUnitsUsedForScratch,
+                                                       this->translationUnit->globalConstBuffer,
+                                                       this->translationUnit->globalVarBuffer,
+                                                       this->type == ModuleType::Builtin);
+        });
+        // Failure is reported for the first failing kernel, independently of execution order
         for (size_t i = 0lu; i < kernelsCount; i++) {
-            result = kernelImmDatas[i]->initialize(this->translationUnit->programInfo.kernelInfos[i],
-                                                   device,
-                                                   device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                                   this->translationUnit->globalConstBuffer,
-                                                   this->translationUnit->globalVarBuffer,
-                                                   this->type == ModuleType::Builtin);
-            if (result != ZE_RESULT_SUCCESS) {
+            if (results[i] != ZE_RESULT_SUCCESS) {
                 kernelImmDatas[i].reset();
-                return result;
+                return results[i];
             }
         }
     }
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t ModuleImp::initializeDeferredKernelImmutableData(const char *kernelName) {
+    // Called with deferredKernelsMtx acquired
+    if (nullptr == kernelName) {
+        return ZE_RESULT_SUCCESS;
+    }
+    for (size_t i = 0lu; i < this->kernelImmDatas.size(); i++) {
+        auto &kernelImmData = this->kernelImmDatas[i];
+        if (false == kernelImmData->isInitializationDeferred() || kernelImmData->getDescriptor().kernelMetadata.kernelName.compare(kernelName) != 0) {
+            continue;
+        }
+        auto result = kernelImmData->initialize(this->translationUnit->programInfo.kernelInfos[i],
+                                                device,
+                                                device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
+                                                this->translationUnit->globalConstBuffer,
+                                                this->translationUnit->globalVarBuffer,
+                                                false);
+        if (result == ZE_RESULT_SUCCESS) {
+            checkIfPrivateMemoryPerDispatchIsNeeded();
+        }
+        return result;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
     if (this->kernelImmDatas.size() == kernelsCount) {
         return ZE_RESULT_SUCCESS;
@@ -843,7 +1078,7 @@ NEO::GraphicsAllocation *ModuleImp::allocateKernelsIsaMemory(size_t size) {
 }
 
 void ModuleImp::createDebugZebin() {
-    auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
+    auto refBin = translationUnit->getUnpackedDeviceBinary();
     auto segments = getZebinSegments();
     auto debugZebin = NEO::Zebin::Debug::createDebugZebin(refBin, segments);
 
@@ -945,12 +1180,22 @@ void ModuleImp::updateBuildLog(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
                                     ze_kernel_handle_t *kernelHandle) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     ze_result_t res;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
     if (!isFullyLinked) {
         driverHandle->clearErrorDescription();
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
     }
+    std::unique_lock<std::mutex> lock(this->deferredKernelsMtx);
+    if (res = this->initializeDeferredKernelImmutableData(desc->pKernelName); res != ZE_RESULT_SUCCESS) {
+        driverHandle->clearErrorDescription();
+        return res;
+    }
+    lock.unlock();
+
     auto kernel = Kernel::create(productFamily, this, desc, &res);
 
     if (res == ZE_RESULT_SUCCESS) {
@@ -960,6 +1205,7 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
     }
 
     auto localMemSize = static_cast<uint32_t>(this->getDevice()->getNEODevice()->getDeviceInfo().localMemSize);
+    lock.lock();
     for (const auto &kernelImmutableData : this->getKernelImmutableDataVector()) {
         auto slmInlineSize = kernelImmutableData->getDescriptor().kernelAttributes.slmInlineSize;
         if (slmInlineSize > 0 && localMemSize < slmInlineSize) {
@@ -974,16 +1220,22 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
-    auto genBinary = this->translationUnit->packedDeviceBinary.get();
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+    auto genBinary = this->translationUnit->getPackedDeviceBinary();
 
-    *pSize = this->translationUnit->packedDeviceBinarySize;
+    *pSize = genBinary.size();
     if (pModuleNativeBinary != nullptr) {
-        memcpy_s(pModuleNativeBinary, this->translationUnit->packedDeviceBinarySize, genBinary, this->translationUnit->packedDeviceBinarySize);
+        memcpy_s(pModuleNativeBinary, genBinary.size(), genBinary.begin(), genBinary.size());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     if (translationUnit == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
@@ -1116,6 +1368,9 @@ bool ModuleImp::linkBinary() {
 }
 
 ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnFunction) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
     // Check if the function is in the exported symbol table
     auto symbolIt = symbols.find(pFunctionName);
@@ -1150,6 +1405,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
 }
 
 ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize, void **pPtr) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     uint64_t address;
     size_t size;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
@@ -1200,6 +1458,9 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     auto &kernelImmDatas = this->getKernelImmutableDataVector();
     if (*pCount == 0) {
         *pCount = static_cast<uint32_t>(kernelImmDatas.size());
@@ -1228,6 +1489,7 @@ void ModuleImp::verifyDebugCapabilities() {
     if (debugCapabilities) {
         // verify all kernels are debuggable
         for (auto kernelInfo : this->translationUnit->programInfo.kernelInfos) {
+            kernelInfo->kernelDescriptor.decodeDeferredMetadata();
             bool systemThreadSurfaceAvailable = NEO::isValidOffset(kernelInfo->kernelDescriptor.payloadMappings.implicitArgs.systemThreadSurfaceAddress.bindful) ||
                                                 NEO::isValidOffset(kernelInfo->kernelDescriptor.payloadMappings.implicitArgs.systemThreadSurfaceAddress.bindless);
 
@@ -1247,14 +1509,18 @@ void ModuleImp::checkIfPrivateMemoryPerDispatchIsNeeded() {
         modulePrivateMemorySize += kernelPrivateMemorySize;
     }
 
-    this->allocatePrivateMemoryPerDispatch = false;
+    bool privateMemoryPerDispatchNeeded = false;
     if (modulePrivateMemorySize > 0U) {
         auto globalMemorySize = device->getNEODevice()->getRootDevice()->getGlobalMemorySize(static_cast<uint32_t>(device->getNEODevice()->getDeviceBitfield().to_ulong()));
-        this->allocatePrivateMemoryPerDispatch = modulePrivateMemorySize > globalMemorySize;
+        privateMemoryPerDispatchNeeded = modulePrivateMemorySize > globalMemorySize;
     }
+    this->allocatePrivateMemoryPerDispatch = privateMemoryPerDispatchNeeded;
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
+    if (auto result = this->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
     pModuleProperties->flags = 0;
 
     if (!unresolvedExternalsInfo.empty()) {
@@ -1269,6 +1535,11 @@ ze_result_t ModuleImp::inspectLinkage(
     uint32_t numModules,
     ze_module_handle_t *phModules,
     ze_module_build_log_handle_t *phLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        if (auto result = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
     ModuleBuildLog *moduleLinkageLog = nullptr;
     moduleLinkageLog = ModuleBuildLog::create();
     *phLog = moduleLinkageLog->toHandle();
@@ -1339,6 +1610,11 @@ ze_result_t ModuleImp::inspectLinkage(
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        if (auto result = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuild(); result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
     std::map<void *, std::map<void *, void *>> dependencies;
     ModuleBuildLog *moduleLinkLog = nullptr;
     const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
@@ -1494,6 +1770,8 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 }
 
 ze_result_t ModuleImp::destroy() {
+    this->waitForBuild();
+
     notifyModuleDestroy();
 
     auto tempHandle = debugModuleHandle;
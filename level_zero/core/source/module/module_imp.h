@@ -15,8 +15,11 @@
 
 #include "igfxfmid.h"
 
+#include <functional>
+#include <future>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -53,6 +56,8 @@ struct ModuleTranslationUnit {
                                                  std::vector<const ze_module_constants_t *> specConstants);
     MOCKABLE_VIRTUAL ze_result_t createFromNativeBinary(const char *input, size_t inputSize);
     MOCKABLE_VIRTUAL ze_result_t processUnpackedBinary();
+    ArrayRef<const uint8_t> getUnpackedDeviceBinary() const;
+    ArrayRef<const uint8_t> getPackedDeviceBinary() const;
     std::vector<uint8_t> generateElfFromSpirV(std::vector<const char *> inputSpirVs, std::vector<uint32_t> inputModuleSizes);
     bool processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize);
     std::string generateCompilerOptions(const char *buildOptions, const char *internalBuildOptions);
@@ -75,6 +80,7 @@ struct ModuleTranslationUnit {
 
     std::unique_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
+    std::shared_ptr<const NEO::CachedBinary> cachedDeviceBinary;
 
     std::unique_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
@@ -88,6 +94,29 @@ struct ModuleTranslationUnit {
     bool isGeneratedByIgc{true};
 };
 
+struct ModuleDescExtensions {
+    const ze_module_program_exp_desc_t *programExpDesc = nullptr;
+    const ze_base_desc_t *asyncBuildDesc = nullptr;
+};
+
+ze_result_t getModuleDescExtensions(const ze_module_desc_t *desc, ModuleDescExtensions &extensions);
+
+// Owning copy of module descriptor and of user memory it references, kept alive until asynchronous build completes.
+// Specialization constants are not copied - their values are resolved before the build is scheduled.
+struct ModuleBuildInputs {
+    void copyFrom(const ze_module_desc_t &srcDesc, const ze_module_program_exp_desc_t *srcProgramExpDesc);
+
+    ze_module_desc_t desc = {};
+    ze_module_program_exp_desc_t programExpDesc = {};
+    std::vector<uint8_t> inputModule;
+    std::string buildFlags;
+    std::vector<std::vector<uint8_t>> programInputModules;
+    std::vector<const uint8_t *> programInputModulePtrs;
+    std::vector<size_t> programInputSizes;
+    std::vector<std::string> programBuildFlags;
+    std::vector<const char *> programBuildFlagPtrs;
+};
+
 struct ModuleImp : public Module {
     ModuleImp() = delete;
 
@@ -121,6 +150,8 @@ struct ModuleImp : public Module {
 
     ze_result_t getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) override;
 
+    ze_result_t synchronizeBuild(uint64_t timeout) override;
+
     const KernelImmutableData *getKernelImmutableData(const char *kernelName) const override;
 
     const std::vector<std::unique_ptr<KernelImmutableData>> &getKernelImmutableDataVector() const override { return kernelImmDatas; }
@@ -156,10 +187,14 @@ struct ModuleImp : public Module {
     }
 
   protected:
+    ze_result_t initializeModule(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    ze_result_t initializeAsync(const ze_module_desc_t *desc, const ModuleDescExtensions &extensions, NEO::Device *neoDevice);
+    ze_result_t waitForBuild();
     MOCKABLE_VIRTUAL ze_result_t initializeTranslationUnit(const ze_module_desc_t *desc, NEO::Device *neoDevice);
     ze_result_t checkIfBuildShouldBeFailed(NEO::Device *neoDevice);
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
+    ze_result_t initializeDeferredKernelImmutableData(const char *kernelName);
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
@@ -171,6 +206,7 @@ struct ModuleImp : public Module {
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
+    void forEachKernel(size_t kernelsCount, const std::function<void(size_t)> &task);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize);
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *allocateKernelsIsaMemory(size_t size);
@@ -210,6 +246,12 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    std::unique_ptr<ModuleBuildInputs> asyncBuildInputs;
+    std::shared_future<void> asyncBuild;
+    ze_result_t buildResult = ZE_RESULT_SUCCESS;
+
+    std::mutex deferredKernelsMtx;
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
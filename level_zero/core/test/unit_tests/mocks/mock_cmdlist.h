@@ -90,6 +90,8 @@ struct WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>
     using BaseClass::isTbxMode;
     using BaseClass::isTimestampEventForMultiTile;
     using BaseClass::latestOperationRequiredNonWalkerInOrderCmdsChaining;
+    using BaseClass::mutableCommandsEnabled;
+    using BaseClass::mutableKernelDispatches;
     using BaseClass::partitionCount;
     using BaseClass::patternAllocations;
     using BaseClass::pipeControlMultiKernelEventSync;
@@ -181,6 +183,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::frontEndStateTracking;
     using BaseClass::getDcFlushRequired;
     using BaseClass::getHostPtrAlloc;
+    using BaseClass::graphCaptureCommandList;
     using BaseClass::hostSynchronize;
     using BaseClass::immediateCmdListHeapSharing;
     using BaseClass::inOrderExecInfo;
@@ -522,6 +525,32 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(hostSynchronize, ze_result_t, ZE_RESULT_SUCCESS,
                      (uint64_t timeout));
 
+    ADDMETHOD_NOBASE(enableMutableCommands, ze_result_t, ZE_RESULT_SUCCESS, ());
+    ADDMETHOD_NOBASE(getNextMutableCommandId, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t * pCommandId));
+    ADDMETHOD_NOBASE(updateMutableKernelArgument, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      uint32_t argIndex,
+                      size_t argSize,
+                      const void *pArgValue));
+    ADDMETHOD_NOBASE(updateMutableGroupCount, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      const ze_group_count_t *pGroupCount));
+    ADDMETHOD_NOBASE(updateMutableGroupSize, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      uint32_t groupSizeX,
+                      uint32_t groupSizeY,
+                      uint32_t groupSizeZ));
+    ADDMETHOD_NOBASE(updateMutableSignalEvent, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint64_t commandId,
+                      ze_event_handle_t hSignalEvent));
+    ADDMETHOD_NOBASE(beginGraphCapture, ze_result_t, ZE_RESULT_SUCCESS,
+                     ());
+    ADDMETHOD_NOBASE(endGraphCapture, ze_result_t, ZE_RESULT_SUCCESS,
+                     (ze_command_list_handle_t * phGraph));
+    ADDMETHOD_NOBASE(appendGraph, ze_result_t, ZE_RESULT_SUCCESS,
+                     (ze_command_list_handle_t hGraph));
+
     uint8_t *batchBuffer = nullptr;
     NEO::GraphicsAllocation *mockAllocation = nullptr;
 };
@@ -191,6 +191,7 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                              // dynamicStateHeap
         threadGroupDimensions,                // threadGroupDimensions
         nullptr,                              // outWalkerPtr
+        nullptr,                              // outIndirectDataPtr
         nullptr,                              // additionalCommands
         PreemptionMode::MidBatch,             // preemptionMode
         0,                                    // partitionCount
@@ -619,6 +620,28 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenCommandListWhenAppendLaunchKernelS
     EXPECT_EQ(1u, event->getPacketsInUse());
 }
 
+HWTEST2_F(CommandListAppendLaunchKernel, givenWalkerTemplateCacheEnabledWhenAppendingKernelSeveralTimesThenWalkerTemplateIsProgrammedOncePerGroupSize, IsAtLeastXeHpCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWalkerTemplateCache.set(1);
+
+    createKernel();
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    for (uint32_t i = 0; i < 4; i++) {
+        auto result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    }
+    EXPECT_EQ(1u, kernel->walkerTemplateCache.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel->setGroupSize(kernel->groupSize[0] * 2, 1, 1));
+    auto result = commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(2u, kernel->walkerTemplateCache.size());
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, givenIndirectDispatchWhenAppendingThenWorkGroupCountAndGlobalWorkSizeAndWorkDimIsSetInCrossThreadData) {
     using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
     using MI_LOAD_REGISTER_REG = typename FamilyType::MI_LOAD_REGISTER_REG;
@@ -637,6 +637,7 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenNotEnoughSpaceInCommandStreamWhenA
         nullptr,                              // dynamicStateHeap
         threadGroupDimensions,                // threadGroupDimensions
         nullptr,                              // outWalkerPtr
+        nullptr,                              // outIndirectDataPtr
         nullptr,                              // additionalCommands
         PreemptionMode::MidBatch,             // preemptionMode
         0,                                    // partitionCount
@@ -4890,6 +4891,104 @@ HWTEST2_F(InOrderRegularCmdListTests, givenDebugFlagSetWhenUsingRegularCmdListTh
     EXPECT_EQ(0u, regularCmdList->inOrderPatchCmds.size());
 }
 
+HWTEST2_F(InOrderRegularCmdListTests, givenRelativeCountersEnabledWhenUsingRegularCmdListThenSignalRelativeCounterAndPublishItWithoutPatching, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+    using MI_STORE_REGISTER_MEM = typename FamilyType::MI_STORE_REGISTER_MEM;
+    using MI_MATH = typename FamilyType::MI_MATH;
+
+    DebugManager.flags.EnableInOrderRelativeCounters.set(1);
+
+    ze_command_queue_desc_t desc = {};
+
+    auto mockCmdQHw = makeZeUniquePtr<MockCommandQueueHw<gfxCoreFamily>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQHw->initialize(true, false, false);
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+
+    if (regularCmdList->partitionCount > 1) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(regularCmdList->isRelativeInOrderCountersEnabled());
+
+    auto cmdStream = regularCmdList->getCmdContainer().getCommandStream();
+    auto inOrderExecInfo = regularCmdList->inOrderExecInfo;
+    uint64_t counterGpuVa = inOrderExecInfo->inOrderDependencyCounterAllocation.getGpuAddress();
+
+    regularCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    regularCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+
+    EXPECT_EQ(0u, regularCmdList->inOrderPatchCmds.size());
+    EXPECT_EQ(2u, inOrderExecInfo->inOrderDependencyCounter);
+
+    regularCmdList->close();
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, cmdStream->getCpuBase(), cmdStream->getUsed()));
+
+    auto walkers = findAll<COMPUTE_WALKER *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, walkers.size());
+    for (uint32_t i = 0; i < walkers.size(); i++) {
+        auto walker = genCmdCast<COMPUTE_WALKER *>(*walkers[i]);
+        EXPECT_EQ(inOrderExecInfo->getRelativeCounterGpuAddress(), walker->getPostSync().getDestinationAddress());
+        EXPECT_EQ(i + 1u, walker->getPostSync().getImmediateData());
+    }
+
+    EXPECT_LE(3u, findAll<MI_MATH *>(cmdList.begin(), cmdList.end()).size());
+
+    uint32_t countersPublished = 0;
+    uint32_t baseUpdates = 0;
+    for (auto &srmIt : findAll<MI_STORE_REGISTER_MEM *>(cmdList.begin(), cmdList.end())) {
+        auto srm = genCmdCast<MI_STORE_REGISTER_MEM *>(*srmIt);
+        if (srm->getMemoryAddress() == counterGpuVa) {
+            countersPublished++;
+        } else if (srm->getMemoryAddress() == inOrderExecInfo->getSubmissionBaseGpuAddress()) {
+            baseUpdates++;
+        }
+    }
+    EXPECT_EQ(2u, countersPublished);
+    EXPECT_EQ(1u, baseUpdates);
+
+    auto handle = regularCmdList->toHandle();
+    mockCmdQHw->executeCommandLists(1, &handle, nullptr, false);
+    mockCmdQHw->executeCommandLists(1, &handle, nullptr, false);
+
+    auto walker = genCmdCast<COMPUTE_WALKER *>(*walkers[1]);
+    EXPECT_EQ(2u, walker->getPostSync().getImmediateData());
+}
+
+HWTEST2_F(InOrderRegularCmdListTests, givenRelativeCountersEnabledWhenCmdListIsResetThenSubmissionCounterStartsOver, IsAtLeastXeHpCore) {
+    DebugManager.flags.EnableInOrderRelativeCounters.set(1);
+
+    ze_command_queue_desc_t desc = {};
+
+    auto mockCmdQHw = makeZeUniquePtr<MockCommandQueueHw<gfxCoreFamily>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQHw->initialize(true, false, false);
+    auto regularCmdList = createRegularCmdList<gfxCoreFamily>(false);
+
+    if (!regularCmdList->isRelativeInOrderCountersEnabled()) {
+        GTEST_SKIP();
+    }
+
+    regularCmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false);
+    regularCmdList->close();
+
+    auto handle = regularCmdList->toHandle();
+    mockCmdQHw->executeCommandLists(1, &handle, nullptr, false);
+    mockCmdQHw->executeCommandLists(1, &handle, nullptr, false);
+    EXPECT_EQ(2u, regularCmdList->inOrderExecInfo->regularCmdListSubmissionCounter);
+
+    regularCmdList->reset();
+
+    EXPECT_EQ(0u, regularCmdList->inOrderExecInfo->regularCmdListSubmissionCounter);
+    EXPECT_EQ(0u, InOrderPatchCommandHelpers::getAppendCounterValue(*regularCmdList->inOrderExecInfo));
+}
+
+HWTEST2_F(InOrderRegularCmdListTests, givenRelativeCountersEnabledWhenUsingCopyOnlyRegularCmdListThenRelativeCountersAreNotUsed, IsAtLeastXeHpCore) {
+    DebugManager.flags.EnableInOrderRelativeCounters.set(1);
+
+    auto regularCopyOnlyCmdList = createRegularCmdList<gfxCoreFamily>(true);
+    EXPECT_FALSE(regularCopyOnlyCmdList->isRelativeInOrderCountersEnabled());
+}
+
 HWTEST2_F(InOrderRegularCmdListTests, whenUsingRegularCmdListThenAddWalkerToPatch, IsAtLeastXeHpCore) {
     using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
 
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+namespace L0 {
+namespace ult {
+
+struct GraphCaptureFixture : public DeviceFixture {
+    void setUp() {
+        DeviceFixture::setUp();
+        mockModule = std::make_unique<Mock<Module>>(device, nullptr);
+        kernel = std::make_unique<Mock<::L0::KernelImp>>();
+        kernel->module = mockModule.get();
+    }
+
+    void tearDown() {
+        kernel.reset();
+        mockModule.reset();
+        DeviceFixture::tearDown();
+    }
+
+    CommandList *createImmediateCmdList(ze_command_queue_flags_t flags) {
+        ze_command_queue_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+        desc.flags = flags;
+        ze_result_t returnValue = ZE_RESULT_SUCCESS;
+        auto commandList = CommandList::createImmediate(productFamily, device, &desc, false, NEO::EngineGroupType::RenderCompute, returnValue);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+        return commandList;
+    }
+
+    std::unique_ptr<Mock<Module>> mockModule;
+    std::unique_ptr<Mock<::L0::KernelImp>> kernel;
+    ze_group_count_t groupCount = {1u, 1u, 1u};
+};
+
+using GraphCaptureTest = Test<GraphCaptureFixture>;
+
+TEST_F(GraphCaptureTest, givenRegularCommandListWhenGraphCaptureIsUsedThenUnsupportedFeatureIsReturned) {
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue);
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->endGraphCapture(&hGraph));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->appendGraph(commandList->toHandle()));
+    commandList->destroy();
+}
+
+HWTEST_F(GraphCaptureTest, givenImmediateCommandListWhenCapturingThenAppendsAreRecordedAndSubmittedOnlyWhenGraphIsAppended) {
+    auto commandList = createImmediateCmdList(0u);
+    ASSERT_NE(nullptr, commandList);
+    auto whiteBoxCmdList = static_cast<WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>> *>(commandList);
+    auto csr = whiteBoxCmdList->csr;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->endGraphCapture(&hGraph));
+    ASSERT_NE(nullptr, hGraph);
+    auto graph = CommandList::fromHandle(hGraph);
+    EXPECT_EQ(CommandList::CommandListType::TYPE_REGULAR, graph->getCmdListType());
+    EXPECT_EQ(nullptr, whiteBoxCmdList->graphCaptureCommandList);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendGraph(hGraph));
+    auto taskCountAfterFirstReplay = csr->peekTaskCount();
+    EXPECT_LT(taskCountBeforeCapture, taskCountAfterFirstReplay);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendGraph(hGraph));
+    EXPECT_LT(taskCountAfterFirstReplay, csr->peekTaskCount());
+
+    graph->destroy();
+    commandList->destroy();
+}
+
+HWTEST_F(GraphCaptureTest, givenImmediateCommandListWhenCapturingThenPrefetchAdviseTimestampQueryAndMultipleIndirectLaunchAreRecorded) {
+    auto commandList = createImmediateCmdList(0u);
+    ASSERT_NE(nullptr, commandList);
+    auto whiteBoxCmdList = static_cast<WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>> *>(commandList);
+
+    MockCommandList captureCommandList;
+    whiteBoxCmdList->graphCaptureCommandList = &captureCommandList;
+
+    int data = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemoryPrefetch(&data, sizeof(data)));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendMemAdvise(device->toHandle(), &data, sizeof(data), ZE_MEMORY_ADVICE_SET_READ_MOSTLY));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendQueryKernelTimestamps(0u, nullptr, &data, nullptr, nullptr, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchMultipleKernelsIndirect(0u, nullptr, nullptr, nullptr, nullptr, 0u, nullptr, false));
+
+    EXPECT_EQ(1u, captureCommandList.appendMemoryPrefetchCalled);
+    EXPECT_EQ(1u, captureCommandList.appendMemAdviseCalled);
+    EXPECT_EQ(1u, captureCommandList.appendQueryKernelTimestampsCalled);
+    EXPECT_EQ(1u, captureCommandList.appendLaunchMultipleKernelsIndirectCalled);
+
+    whiteBoxCmdList->graphCaptureCommandList = nullptr;
+    commandList->destroy();
+}
+
+TEST_F(GraphCaptureTest, givenImmediateCommandListWhenGraphCaptureIsMisusedThenErrorIsReturned) {
+    auto commandList = createImmediateCmdList(0u);
+    ASSERT_NE(nullptr, commandList);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->endGraphCapture(&hGraph));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, commandList->appendGraph(nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->appendGraph(commandList->toHandle()));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->endGraphCapture(nullptr));
+
+    // graph still being captured is released together with command list
+    commandList->destroy();
+}
+
+TEST_F(GraphCaptureTest, givenImmediateCommandListWhileCapturingWhenAppendingGraphThenUnsupportedFeatureIsReturned) {
+    auto commandList = createImmediateCmdList(0u);
+    ASSERT_NE(nullptr, commandList);
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    auto graph = CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue);
+    ASSERT_NE(nullptr, graph);
+    graph->close();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->beginGraphCapture());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->appendGraph(graph->toHandle()));
+
+    graph->destroy();
+    commandList->destroy();
+}
+
+TEST_F(GraphCaptureTest, givenInOrderImmediateCommandListWhenBeginningGraphCaptureThenUnsupportedFeatureIsReturned) {
+    auto commandList = createImmediateCmdList(ZE_COMMAND_QUEUE_FLAG_IN_ORDER);
+    ASSERT_NE(nullptr, commandList);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->beginGraphCapture());
+    commandList->destroy();
+}
+
+} // namespace ult
+} // namespace L0
@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+namespace L0 {
+namespace ult {
+
+struct MutableCommandListFixture : public DeviceFixture {
+    void setUp() {
+        DeviceFixture::setUp();
+        mockModule = std::make_unique<Mock<Module>>(device, nullptr);
+        kernel = std::make_unique<Mock<::L0::KernelImp>>();
+        kernel->module = mockModule.get();
+        kernel->crossThreadDataSize = 0x60u;
+        kernel->groupSize[0] = 8u;
+        kernel->groupSize[1] = 1u;
+        kernel->groupSize[2] = 1u;
+        kernel->numThreadsPerThreadGroup = 1u;
+        kernel->descriptor.kernelAttributes.flags.passInlineData = true;
+        memset(kernel->crossThreadData.get(), 0, kernel->crossThreadDataSize);
+    }
+
+    void tearDown() {
+        kernel.reset();
+        mockModule.reset();
+        DeviceFixture::tearDown();
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<L0::CommandListCoreFamily<gfxCoreFamily>>> createMutableCmdList() {
+        auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamily<gfxCoreFamily>>>();
+        commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->enableMutableCommands());
+        return commandList;
+    }
+
+    template <typename FamilyType>
+    uint32_t readCrossThreadData(const MutableCommandHelpers::MutableKernelDispatch<FamilyType> &mutableDispatch, size_t offset) {
+        uint32_t value = 0u;
+        if (offset < mutableDispatch.inlineDataSize) {
+            auto walkerCmd = reinterpret_cast<typename FamilyType::COMPUTE_WALKER *>(mutableDispatch.walker);
+            memcpy(&value, ptrOffset(walkerCmd->getInlineDataPointer(), offset), sizeof(value));
+        } else {
+            memcpy(&value, ptrOffset(mutableDispatch.indirectData, offset - mutableDispatch.inlineDataSize), sizeof(value));
+        }
+        return value;
+    }
+
+    std::unique_ptr<Mock<Module>> mockModule;
+    std::unique_ptr<Mock<::L0::KernelImp>> kernel;
+    ze_group_count_t groupCount = {2u, 1u, 1u};
+};
+
+using MutableCommandListTest = Test<MutableCommandListFixture>;
+
+HWTEST2_F(MutableCommandListTest, givenImmediateCommandListWhenEnablingMutableCommandsThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->enableMutableCommands());
+    EXPECT_FALSE(commandList->mutableCommandsEnabled);
+}
+
+HWTEST2_F(MutableCommandListTest, givenPlatformWithoutComputeWalkerWhenEnablingMutableCommandsThenUnsupportedFeatureIsReturned, IsAtMostGen12lp) {
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamily<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::Compute, 0u);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->enableMutableCommands());
+
+    uint64_t commandId = 0u;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextMutableCommandId(&commandId));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableCommandListWhenAppendingKernelThenDispatchIsRecordedUnderNextCommandId, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+
+    uint64_t commandId = std::numeric_limits<uint64_t>::max();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getNextMutableCommandId(&commandId));
+    EXPECT_EQ(0u, commandId);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->getNextMutableCommandId(nullptr));
+
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+    EXPECT_EQ(kernel.get(), mutableDispatch.kernel);
+    EXPECT_NE(nullptr, mutableDispatch.walker);
+    EXPECT_NE(nullptr, mutableDispatch.indirectData);
+    EXPECT_EQ(kernel->crossThreadDataSize, mutableDispatch.crossThreadData.size());
+    EXPECT_EQ(2u, mutableDispatch.groupCount[0]);
+    EXPECT_EQ(8u, mutableDispatch.groupSize[0]);
+    EXPECT_EQ(0u, mutableDispatch.signalEventAddress);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->getNextMutableCommandId(&commandId));
+    EXPECT_EQ(1u, commandId);
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->mutableKernelDispatches.empty());
+    EXPECT_TRUE(commandList->mutableCommandsEnabled);
+}
+
+HWTEST2_F(MutableCommandListTest, givenRecordedDispatchWhenUpdatingValueArgumentThenInlineAndIndirectDataArePatched, IsAtLeastXeHpCore) {
+    constexpr uint16_t inlineOffset = 0x4u;
+    constexpr uint16_t indirectOffset = 0x50u;
+    auto valueArg = NEO::ArgDescriptor(NEO::ArgDescriptor::ArgTValue);
+    valueArg.as<NEO::ArgDescValue>().elements.push_back({inlineOffset, sizeof(uint32_t), 0u});
+    valueArg.as<NEO::ArgDescValue>().elements.push_back({indirectOffset, sizeof(uint32_t), sizeof(uint32_t)});
+    kernel->descriptor.payloadMappings.explicitArgs.push_back(valueArg);
+
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(1u, commandList->mutableKernelDispatches.size());
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+
+    uint32_t argValue[2] = {0x1234u, 0x5678u};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableKernelArgument(0u, 0u, sizeof(argValue), argValue));
+    EXPECT_EQ(0x1234u, readCrossThreadData(mutableDispatch, inlineOffset));
+    EXPECT_EQ(0x5678u, readCrossThreadData(mutableDispatch, indirectOffset));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(1u, 0u, sizeof(argValue), argValue));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableKernelArgument(0u, 1u, sizeof(argValue), argValue));
+}
+
+HWTEST2_F(MutableCommandListTest, givenRecordedDispatchWhenUpdatingStatelessPointerArgumentThenPointerIsPatched, IsAtLeastXeHpCore) {
+    constexpr uint16_t pointerOffset = 0x40u;
+    auto pointerArg = NEO::ArgDescriptor(NEO::ArgDescriptor::ArgTPointer);
+    pointerArg.as<NEO::ArgDescPointer>().stateless = pointerOffset;
+    pointerArg.as<NEO::ArgDescPointer>().pointerSize = sizeof(uint64_t);
+    kernel->descriptor.payloadMappings.explicitArgs.push_back(pointerArg);
+
+    auto surfaceArg = NEO::ArgDescriptor(NEO::ArgDescriptor::ArgTPointer);
+    surfaceArg.as<NEO::ArgDescPointer>().stateless = pointerOffset + sizeof(uint64_t);
+    surfaceArg.as<NEO::ArgDescPointer>().bindful = 0x80u;
+    surfaceArg.as<NEO::ArgDescPointer>().pointerSize = sizeof(uint64_t);
+    kernel->descriptor.payloadMappings.explicitArgs.push_back(surfaceArg);
+
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+
+    void *systemPointer = reinterpret_cast<void *>(0x1234000u);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableKernelArgument(0u, 0u, sizeof(void *), &systemPointer));
+    EXPECT_EQ(0x1234000u, readCrossThreadData(mutableDispatch, pointerOffset));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableKernelArgument(0u, 1u, sizeof(void *), &systemPointer));
+}
+
+HWTEST2_F(MutableCommandListTest, givenRecordedDispatchWhenUpdatingGroupCountThenWalkerAndDispatchTraitsArePatched, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+    constexpr uint16_t numWorkGroupsOffset = 0x10u;
+    constexpr uint16_t globalWorkSizeOffset = 0x44u;
+    kernel->descriptor.payloadMappings.dispatchTraits.numWorkGroups[0] = numWorkGroupsOffset;
+    kernel->descriptor.payloadMappings.dispatchTraits.globalWorkSize[0] = globalWorkSizeOffset;
+
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+
+    ze_group_count_t newGroupCount = {5u, 3u, 1u};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableGroupCount(0u, &newGroupCount));
+
+    auto walkerCmd = genCmdCast<COMPUTE_WALKER *>(mutableDispatch.walker);
+    ASSERT_NE(nullptr, walkerCmd);
+    EXPECT_EQ(5u, walkerCmd->getThreadGroupIdXDimension());
+    EXPECT_EQ(3u, walkerCmd->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walkerCmd->getThreadGroupIdZDimension());
+    EXPECT_EQ(5u, readCrossThreadData(mutableDispatch, numWorkGroupsOffset));
+    EXPECT_EQ(40u, readCrossThreadData(mutableDispatch, globalWorkSizeOffset));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupCount(0u, nullptr));
+    commandList->mutableKernelDispatches[0].partitionCount = 2u;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableGroupCount(0u, &newGroupCount));
+}
+
+HWTEST2_F(MutableCommandListTest, givenRecordedDispatchWhenUpdatingGroupSizeThenWalkerIsPatched, IsAtLeastXeHpCore) {
+    using COMPUTE_WALKER = typename FamilyType::COMPUTE_WALKER;
+
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    auto &mutableDispatch = commandList->mutableKernelDispatches[0];
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableGroupSize(0u, 0u, 1u, 1u));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableGroupSize(0u, 12u, 1u, 1u));
+
+    auto walkerCmd = genCmdCast<COMPUTE_WALKER *>(mutableDispatch.walker);
+    ASSERT_NE(nullptr, walkerCmd);
+    EXPECT_EQ(2u, mutableDispatch.numThreadsPerThreadGroup);
+    EXPECT_EQ(2u, walkerCmd->getInterfaceDescriptor().getNumberOfThreadsInGpgpuThreadGroup());
+    EXPECT_EQ(0xfu, walkerCmd->getExecutionMask());
+}
+
+HWTEST2_F(MutableCommandListTest, givenDispatchWithoutSignalEventWhenUpdatingSignalEventThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createMutableCmdList<gfxCoreFamily>();
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 1;
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableSignalEvent(0u, event->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableSignalEvent(1u, event->toHandle()));
+}
+
+} // namespace ult
+} // namespace L0
@@ -1102,6 +1102,15 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
+    decltype(&zexModuleBuildSynchronize) expectedModuleBuildSynchronize = L0::zexModuleBuildSynchronize;
+    decltype(&zexCommandListGetNextCommandId) expectedGetNextCommandId = L0::zexCommandListGetNextCommandId;
+    decltype(&zexCommandListUpdateMutableKernelArgument) expectedUpdateMutableKernelArgument = L0::zexCommandListUpdateMutableKernelArgument;
+    decltype(&zexCommandListUpdateMutableGroupCount) expectedUpdateMutableGroupCount = L0::zexCommandListUpdateMutableGroupCount;
+    decltype(&zexCommandListUpdateMutableGroupSize) expectedUpdateMutableGroupSize = L0::zexCommandListUpdateMutableGroupSize;
+    decltype(&zexCommandListUpdateMutableSignalEvent) expectedUpdateMutableSignalEvent = L0::zexCommandListUpdateMutableSignalEvent;
+    decltype(&zexCommandListBeginGraphCapture) expectedBeginGraphCapture = L0::zexCommandListBeginGraphCapture;
+    decltype(&zexCommandListEndGraphCapture) expectedEndGraphCapture = L0::zexCommandListEndGraphCapture;
+    decltype(&zexCommandListAppendGraph) expectedAppendGraph = L0::zexCommandListAppendGraph;
 
     void *funPtr = nullptr;
 
@@ -1120,6 +1129,42 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexModuleBuildSynchronize", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedModuleBuildSynchronize, reinterpret_cast<decltype(&zexModuleBuildSynchronize)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListGetNextCommandId", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedGetNextCommandId, reinterpret_cast<decltype(&zexCommandListGetNextCommandId)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateMutableKernelArgument", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedUpdateMutableKernelArgument, reinterpret_cast<decltype(&zexCommandListUpdateMutableKernelArgument)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateMutableGroupCount", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedUpdateMutableGroupCount, reinterpret_cast<decltype(&zexCommandListUpdateMutableGroupCount)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateMutableGroupSize", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedUpdateMutableGroupSize, reinterpret_cast<decltype(&zexCommandListUpdateMutableGroupSize)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateMutableSignalEvent", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedUpdateMutableSignalEvent, reinterpret_cast<decltype(&zexCommandListUpdateMutableSignalEvent)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListBeginGraphCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedBeginGraphCapture, reinterpret_cast<decltype(&zexCommandListBeginGraphCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListEndGraphCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEndGraphCapture, reinterpret_cast<decltype(&zexCommandListEndGraphCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListAppendGraph", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedAppendGraph, reinterpret_cast<decltype(&zexCommandListAppendGraph)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+
+namespace NEO {
+
+TEST(DefaultCacheConfigL0Tests, GivenDefaultCacheConfigThenL0ExtensionAndFilePerBinaryFormatAreUsed) {
+    VariableBackup<decltype(IoFunctions::getenvPtr)> getenvBackup(&IoFunctions::getenvPtr, [](const char *) noexcept -> char * { return nullptr; });
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_STREQ(".l0_cache", cacheConfig.cacheFileExtension.c_str());
+    EXPECT_EQ(CompilerCacheFormat::filePerBinary, cacheConfig.format);
+}
+
+TEST(DefaultCacheConfigL0Tests, GivenIndexedPackSetWhenGettingDefaultCacheConfigThenIndexedPackFormatIsUsed) {
+    VariableBackup<decltype(IoFunctions::getenvPtr)> getenvBackup(&IoFunctions::getenvPtr, [](const char *name) noexcept -> char * {
+        static char indexedPack[] = "1";
+        if (std::string(name) == "NEO_CACHE_INDEXED_PACK") {
+            return indexedPack;
+        }
+        return nullptr;
+    });
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_STREQ(".l0_cache", cacheConfig.cacheFileExtension.c_str());
+    EXPECT_EQ(CompilerCacheFormat::indexedPack, cacheConfig.format);
+}
+
+} // namespace NEO
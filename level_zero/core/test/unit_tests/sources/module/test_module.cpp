@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/command_container/encode_surface_state.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/compiler_warnings/compiler_warnings.h"
@@ -32,6 +33,7 @@
 #include "shared/test/common/mocks/mock_modules_zebin.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_module.h"
 #include "level_zero/core/source/kernel/kernel_imp.h"
 #include "level_zero/core/source/module/module_build_log.h"
 #include "level_zero/core/source/module/module_imp.h"
@@ -40,6 +42,7 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_device.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+#include "level_zero/include/ze_intel_gpu.h"
 
 namespace L0 {
 namespace ult {
@@ -2987,6 +2990,24 @@ HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZebinThenAppendAllowZebinFla
     EXPECT_STREQ(expectedOptions.c_str(), moduleTu.options.c_str());
 }
 
+HWTEST_F(ModuleTranslationUnitTest, GivenCachedDeviceBinaryViewWhenProcessingUnpackedBinaryThenBinaryIsDecodedInPlaceAndNotRepacked) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    moduleTu.cachedDeviceBinary = std::make_shared<NEO::HeapCachedBinary>(makeCopy<char>(zebin.storage.data(), zebin.storage.size()), zebin.storage.size());
+    moduleTu.unpackedDeviceBinarySize = zebin.storage.size();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, moduleTu.processUnpackedBinary());
+    EXPECT_EQ(nullptr, moduleTu.unpackedDeviceBinary);
+    EXPECT_EQ(nullptr, moduleTu.packedDeviceBinary);
+
+    auto cachedData = moduleTu.cachedDeviceBinary->getData();
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(cachedData.begin()), moduleTu.getUnpackedDeviceBinary().begin());
+    EXPECT_EQ(reinterpret_cast<const uint8_t *>(cachedData.begin()), moduleTu.getPackedDeviceBinary().begin());
+    EXPECT_EQ(zebin.storage.size(), moduleTu.getPackedDeviceBinary().size());
+}
+
 HWTEST2_F(ModuleTranslationUnitTest, givenLargeGrfAndSimd16WhenProcessingBinaryThenKernelGroupSizeReducedToFitWithinSubslice, IsWithinXeGfxFamily) {
     std::string validZeInfo = std::string("version :\'") + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + R"===('
 kernels:
@@ -3932,6 +3953,102 @@ TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenMultipleKernelIsasWhenKernel
     this->givenMultipleKernelIsasWhenKernelInitializationFailsThenItIsProperlyCleanedAndPreviouslyInitializedKernelsLeftUntouched();
 }
 
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenParallelModuleInitializationEnabledWhenKernelImmutableDatasAreInitializedThenEachKernelIsInitializedWithItsKernelInfo) {
+    DebugManager.flags.ParallelModuleInitialization.set(1);
+    DebugManager.flags.BuildThreadPoolSize.set(4);
+
+    constexpr size_t kernelsCount = 32u;
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+    }
+
+    auto result = this->mockModule->initializeKernelImmutableDatas();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVector();
+    ASSERT_EQ(kernelsCount, kernelImmDatas.size());
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        ASSERT_NE(nullptr, kernelImmDatas[i].get());
+        EXPECT_EQ(this->mockModule->translationUnit->programInfo.kernelInfos[i], kernelImmDatas[i]->getKernelInfo());
+    }
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenParallelModuleInitializationEnabledWhenKernelInitializationFailsThenFailingKernelIsCleanedAndOtherKernelsAreInitialized) {
+    DebugManager.flags.ParallelModuleInitialization.set(1);
+    DebugManager.flags.BuildThreadPoolSize.set(4);
+
+    constexpr size_t kernelsCount = 8u;
+    auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVectorRef();
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+        kernelImmDatas.emplace_back(new ProxyKernelImmutableData(this->device));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->setIsaGraphicsAllocations());
+
+    static_cast<ProxyKernelImmutableData *>(kernelImmDatas[5].get())->initializeCallBase = false;
+    auto result = this->mockModule->initializeKernelImmutableDatas();
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, result);
+
+    for (size_t i = 0u; i < kernelsCount; i++) {
+        if (i == 5u) {
+            EXPECT_EQ(nullptr, kernelImmDatas[i].get());
+            continue;
+        }
+        ASSERT_NE(nullptr, kernelImmDatas[i].get());
+        EXPECT_EQ(1u, static_cast<ProxyKernelImmutableData *>(kernelImmDatas[i].get())->initializeCalled);
+        EXPECT_NE(nullptr, kernelImmDatas[i]->getIsaGraphicsAllocation());
+    }
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenKernelWithDeferredMetadataWhenKernelImmutableDatasAreInitializedThenMetadataIsDecodedOnlyWhenKernelIsCreated) {
+    this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+    this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+    auto &kernelInfos = this->mockModule->translationUnit->programInfo.kernelInfos;
+    kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName = "eager";
+    kernelInfos[1]->kernelDescriptor.kernelMetadata.kernelName = "deferred";
+
+    uint32_t decodeCalled = 0u;
+    auto &deferredDescriptor = kernelInfos[1]->kernelDescriptor;
+    deferredDescriptor.deferredMetadata.deferred = true;
+    deferredDescriptor.deferredMetadata.decode = [&decodeCalled](KernelDescriptor &kernelDescriptor) {
+        decodeCalled++;
+        kernelDescriptor.kernelAttributes.simdSize = 16u;
+        return true;
+    };
+
+    auto result = this->mockModule->initializeKernelImmutableDatas();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVector();
+    EXPECT_FALSE(kernelImmDatas[0]->isInitializationDeferred());
+    EXPECT_TRUE(kernelImmDatas[1]->isInitializationDeferred());
+    EXPECT_EQ(kernelInfos[1], kernelImmDatas[1]->getKernelInfo());
+    EXPECT_EQ(0u, decodeCalled);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeDeferredKernelImmutableData("deferred"));
+    EXPECT_FALSE(kernelImmDatas[1]->isInitializationDeferred());
+    EXPECT_EQ(1u, decodeCalled);
+    EXPECT_EQ(16u, kernelImmDatas[1]->getDescriptor().kernelAttributes.simdSize);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeDeferredKernelImmutableData("deferred"));
+    EXPECT_EQ(1u, decodeCalled);
+}
+
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenKernelWithDeferredMetadataWhenDecodingFailsThenKernelInitializationFailsAndStaysDeferred) {
+    this->prepareKernelInfoAndAddToTranslationUnit(0x40);
+    auto &kernelDescriptor = this->mockModule->translationUnit->programInfo.kernelInfos[0]->kernelDescriptor;
+    kernelDescriptor.kernelMetadata.kernelName = "deferred";
+    kernelDescriptor.deferredMetadata.deferred = true;
+    kernelDescriptor.deferredMetadata.decode = [](KernelDescriptor &) { return false; };
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeKernelImmutableDatas());
+
+    auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVector();
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, this->mockModule->initializeDeferredKernelImmutableData("deferred"));
+    EXPECT_TRUE(kernelImmDatas[0]->isInitializationDeferred());
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, this->mockModule->initializeDeferredKernelImmutableData("deferred"));
+}
+
 using ModuleInitializeTest = Test<DeviceFixture>;
 
 TEST_F(ModuleInitializeTest, whenModuleInitializeIsCalledThenCorrectResultIsReturned) {
@@ -4653,5 +4770,156 @@ TEST_F(ModuleKernelImmDatasTest, givenDeviceOOMWhenMemoryManagerFailsToAllocateM
     auto result = module->initialize(&moduleDesc, neoDevice);
     EXPECT_EQ(result, ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY);
 };
+
+using ModuleAsyncBuildTest = Test<DeviceFixture>;
+
+TEST_F(ModuleAsyncBuildTest, givenAsyncBuildDescWhenModuleIsCreatedThenInputIsCopiedAndBuildCompletesInBackground) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.FailBuildProgramWithStatefulAccess.set(0);
+    DebugManager.flags.BuildThreadPoolSize.set(1);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    std::vector<uint8_t> src(zebinData->storage.begin(), zebinData->storage.end());
+
+    ze_intel_module_async_build_exp_desc_t asyncBuildDesc = {ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC};
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.pNext = &asyncBuildDesc;
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = src.data();
+    moduleDesc.inputSize = src.size();
+
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto module = Module::create(device, &moduleDesc, nullptr, ModuleType::User, &result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, module);
+    std::fill(src.begin(), src.end(), 0u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexModuleBuildSynchronize(module->toHandle(), std::numeric_limits<uint64_t>::max()));
+
+    uint32_t kernelsCount = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->getKernelNames(&kernelsCount, nullptr));
+    EXPECT_EQ(static_cast<uint32_t>(zebinData->numOfKernels), kernelsCount);
+    EXPECT_NE(nullptr, module->getKernelImmutableData("test"));
+    module->destroy();
+}
+
+TEST_F(ModuleAsyncBuildTest, givenAsyncBuildDescAndInvalidBinaryWhenModuleIsCreatedThenBuildFailureIsReportedWhenModuleIsUsed) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.BuildThreadPoolSize.set(1);
+
+    uint8_t invalidBinary[16] = {};
+    ze_intel_module_async_build_exp_desc_t asyncBuildDesc = {ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC};
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.pNext = &asyncBuildDesc;
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = invalidBinary;
+    moduleDesc.inputSize = sizeof(invalidBinary);
+
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto module = Module::create(device, &moduleDesc, nullptr, ModuleType::User, &result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, module);
+
+    auto buildResult = module->synchronizeBuild(std::numeric_limits<uint64_t>::max());
+    EXPECT_NE(ZE_RESULT_SUCCESS, buildResult);
+
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "test";
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(buildResult, module->createKernel(&kernelDesc, &kernelHandle));
+    EXPECT_EQ(nullptr, kernelHandle);
+
+    uint32_t kernelsCount = 0u;
+    EXPECT_EQ(buildResult, module->getKernelNames(&kernelsCount, nullptr));
+    module->destroy();
+}
+
+TEST_F(ModuleAsyncBuildTest, givenBuildThreadPoolWithoutThreadsWhenAsyncBuildIsRequestedThenBuildIsCompletedBeforeModuleCreateReturns) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.FailBuildProgramWithStatefulAccess.set(0);
+    DebugManager.flags.BuildThreadPoolSize.set(0);
+
+    auto zebinData = std::make_unique<ZebinTestData::ZebinWithL0TestCommonModule>(device->getHwInfo());
+    const auto &src = zebinData->storage;
+
+    ze_intel_module_async_build_exp_desc_t asyncBuildDesc = {ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC};
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.pNext = &asyncBuildDesc;
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = src.data();
+    moduleDesc.inputSize = src.size();
+
+    ze_result_t result = ZE_RESULT_ERROR_UNKNOWN;
+    auto module = Module::create(device, &moduleDesc, nullptr, ModuleType::User, &result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, module);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->synchronizeBuild(0u));
+    module->destroy();
+}
+
+TEST_F(ModuleAsyncBuildTest, givenUnknownExtensionInModuleDescChainWhenModuleIsCreatedThenInvalidArgumentIsReturned) {
+    ze_intel_module_async_build_exp_desc_t asyncBuildDesc = {ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC};
+    ze_base_desc_t unknownDesc = {ZE_STRUCTURE_TYPE_FORCE_UINT32};
+    asyncBuildDesc.pNext = &unknownDesc;
+
+    uint8_t binary[16] = {};
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.pNext = &asyncBuildDesc;
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = sizeof(binary);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto module = Module::create(device, &moduleDesc, nullptr, ModuleType::User, &result);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, result);
+    EXPECT_EQ(nullptr, module);
+}
+
+TEST(ModuleBuildInputsTest, givenModuleDescWithProgramExpDescWhenCopyingThenAllInputsAreOwnedAndSpecConstantsAreDropped) {
+    std::vector<uint8_t> module0 = {1, 2, 3};
+    std::vector<uint8_t> module1 = {4, 5};
+    std::vector<const uint8_t *> inputModules = {module0.data(), module1.data()};
+    std::vector<size_t> inputSizes = {module0.size(), module1.size()};
+    std::vector<const char *> buildFlags = {"-flag0", nullptr};
+    ze_module_constants_t specConstants = {};
+    std::vector<const ze_module_constants_t *> pConstants = {&specConstants, &specConstants};
+
+    ze_module_program_exp_desc_t programExpDesc = {ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC};
+    programExpDesc.count = 2;
+    programExpDesc.inputSizes = inputSizes.data();
+    programExpDesc.pInputModules = inputModules.data();
+    programExpDesc.pBuildFlags = buildFlags.data();
+    programExpDesc.pConstants = pConstants.data();
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.pNext = &programExpDesc;
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pBuildFlags = "-options";
+    moduleDesc.pConstants = &specConstants;
+
+    ModuleBuildInputs buildInputs;
+    buildInputs.copyFrom(moduleDesc, &programExpDesc);
+    module0.assign(module0.size(), 0u);
+    module1.assign(module1.size(), 0u);
+
+    EXPECT_EQ(ZE_MODULE_FORMAT_IL_SPIRV, buildInputs.desc.format);
+    EXPECT_EQ(nullptr, buildInputs.desc.pConstants);
+    EXPECT_NE(moduleDesc.pBuildFlags, buildInputs.desc.pBuildFlags);
+    EXPECT_STREQ("-options", buildInputs.desc.pBuildFlags);
+    ASSERT_EQ(&buildInputs.programExpDesc, buildInputs.desc.pNext);
+
+    auto &copiedProgramExpDesc = buildInputs.programExpDesc;
+    EXPECT_EQ(nullptr, copiedProgramExpDesc.pNext);
+    EXPECT_EQ(nullptr, copiedProgramExpDesc.pConstants);
+    ASSERT_EQ(2u, copiedProgramExpDesc.count);
+    EXPECT_EQ(3u, copiedProgramExpDesc.inputSizes[0]);
+    EXPECT_EQ(2u, copiedProgramExpDesc.inputSizes[1]);
+    EXPECT_EQ(0, memcmp(std::array<uint8_t, 3>{1, 2, 3}.data(), copiedProgramExpDesc.pInputModules[0], 3));
+    EXPECT_EQ(0, memcmp(std::array<uint8_t, 2>{4, 5}.data(), copiedProgramExpDesc.pInputModules[1], 2));
+    EXPECT_STREQ("-flag0", copiedProgramExpDesc.pBuildFlags[0]);
+    EXPECT_EQ(nullptr, copiedProgramExpDesc.pBuildFlags[1]);
+}
+
 } // namespace ult
 } // namespace L0
@@ -62,6 +62,103 @@ typedef struct _ze_intel_device_module_dp_exp_properties_t {
     ze_intel_device_module_dp_exp_flags_t flags;                                    ///< [out] 0 (none) or a valid combination of ::ze_intel_device_module_dp_flag_t
 } ze_intel_device_module_dp_exp_properties_t;
 
+///////////////////////////////////////////////////////////////////////////////
+#ifndef ZE_INTEL_MODULE_ASYNC_BUILD_EXP_NAME
+/// @brief Module asynchronous build driver extension name
+#define ZE_INTEL_MODULE_ASYNC_BUILD_EXP_NAME "ZE_intel_experimental_module_async_build"
+#endif // ZE_INTEL_MODULE_ASYNC_BUILD_EXP_NAME
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Module asynchronous build driver extension Version(s)
+typedef enum _ze_intel_module_async_build_exp_version_t {
+    ZE_INTEL_MODULE_ASYNC_BUILD_EXP_VERSION_1_0 = ZE_MAKE_VERSION(1, 0),     ///< version 1.0
+    ZE_INTEL_MODULE_ASYNC_BUILD_EXP_VERSION_CURRENT = ZE_MAKE_VERSION(1, 0), ///< latest known version
+    ZE_INTEL_MODULE_ASYNC_BUILD_EXP_VERSION_FORCE_UINT32 = 0x7fffffff
+
+} ze_intel_module_async_build_exp_version_t;
+
+///////////////////////////////////////////////////////////////////////////////
+#define ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC (ze_structure_type_t)0x00030014
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Module asynchronous build descriptor
+///
+/// @details
+///     - This structure may be passed to ::zeModuleCreate, via `pNext` member
+///       of ::ze_module_desc_t.
+///     - ::zeModuleCreate returns as soon as the module inputs are validated and
+///       the build is executed by driver's background threads.
+///     - Result of the build is returned by ::zexModuleBuildSynchronize.
+///       Functions operating on the module wait for the build to complete.
+///     - Build log passed to ::zeModuleCreate is filled when the build completes
+///       and must not be accessed or destroyed before that.
+typedef struct _ze_intel_module_async_build_exp_desc_t {
+    ze_structure_type_t stype = ZE_STRUCTURE_INTEL_MODULE_ASYNC_BUILD_EXP_DESC; ///< [in] type of this structure
+    const void *pNext;                                                          ///< [in][optional] must be null or a pointer to an extension-specific
+                                                                                ///< structure (i.e. contains sType and pNext).
+} ze_intel_module_async_build_exp_desc_t;
+
+///////////////////////////////////////////////////////////////////////////////
+#ifndef ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_NAME
+/// @brief Mutable command list driver extension name
+#define ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_NAME "ZE_intel_experimental_mutable_command_list"
+#endif // ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_NAME
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Mutable command list driver extension Version(s)
+typedef enum _ze_intel_mutable_command_list_exp_version_t {
+    ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_VERSION_1_0 = ZE_MAKE_VERSION(1, 0),     ///< version 1.0
+    ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_VERSION_CURRENT = ZE_MAKE_VERSION(1, 0), ///< latest known version
+    ZE_INTEL_MUTABLE_COMMAND_LIST_EXP_VERSION_FORCE_UINT32 = 0x7fffffff
+
+} ze_intel_mutable_command_list_exp_version_t;
+
+///////////////////////////////////////////////////////////////////////////////
+#define ZE_STRUCTURE_INTEL_MUTABLE_COMMAND_LIST_EXP_DESC (ze_structure_type_t)0x00030015
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Mutable command list descriptor
+///
+/// @details
+///     - This structure may be passed to ::zeCommandListCreate, via `pNext`
+///       member of ::ze_command_list_desc_t.
+///     - Each kernel appended to the command list gets a command id, which is
+///       returned by ::zexCommandListGetNextCommandId before the append.
+///     - Kernel arguments, group count, group size and signal event of
+///       appended kernels may be updated with zexCommandListUpdateMutable*
+///       functions, without resetting the command list. Updates are written
+///       directly to the encoded commands, so they must not be made while the
+///       command list is executing.
+///     - Updates which would require re-encoding of the kernel dispatch return
+///       ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE and leave the command unchanged.
+typedef struct _ze_intel_mutable_command_list_exp_desc_t {
+    ze_structure_type_t stype = ZE_STRUCTURE_INTEL_MUTABLE_COMMAND_LIST_EXP_DESC; ///< [in] type of this structure
+    const void *pNext;                                                            ///< [in][optional] must be null or a pointer to an extension-specific
+                                                                                  ///< structure (i.e. contains sType and pNext).
+} ze_intel_mutable_command_list_exp_desc_t;
+
+#ifndef ZE_INTEL_GRAPH_CAPTURE_EXP_NAME
+/// @brief Graph capture driver extension name
+#define ZE_INTEL_GRAPH_CAPTURE_EXP_NAME "ZE_intel_experimental_graph_capture"
+#endif // ZE_INTEL_GRAPH_CAPTURE_EXP_NAME
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Graph capture driver extension Version(s)
+///
+/// @details
+///     - Operations appended to an immediate command list between
+///       zexCommandListBeginGraphCapture and zexCommandListEndGraphCapture are
+///       not submitted, but recorded with their event dependencies into a
+///       regular command list (graph) returned by zexCommandListEndGraphCapture.
+///     - The graph is replayed with a single submission by
+///       zexCommandListAppendGraph, or executed on any command queue of
+///       matching engine type. It is destroyed with ::zeCommandListDestroy.
+///     - Capture is not supported on in-order immediate command lists.
+typedef enum _ze_intel_graph_capture_exp_version_t {
+    ZE_INTEL_GRAPH_CAPTURE_EXP_VERSION_1_0 = ZE_MAKE_VERSION(1, 0),     ///< version 1.0
+    ZE_INTEL_GRAPH_CAPTURE_EXP_VERSION_CURRENT = ZE_MAKE_VERSION(1, 0), ///< latest known version
+    ZE_INTEL_GRAPH_CAPTURE_EXP_VERSION_FORCE_UINT32 = 0x7fffffff
+
+} ze_intel_graph_capture_exp_version_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
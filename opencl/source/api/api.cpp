@@ -26,6 +26,7 @@
 #include "opencl/source/api/api_enter.h"
 #include "opencl/source/built_ins/vme_builtin.h"
 #include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/cl_command_buffer.h"
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/context/driver_diagnostics.h"
@@ -55,6 +56,7 @@
 #include "config.h"
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 
 using namespace NEO;
@@ -1587,8 +1589,12 @@ cl_int CL_API_CALL clBuildProgram(cl_program program,
         retVal = Program::processInputDevices(deviceVectorPtr, numDevices, deviceList, pProgram->getDevices());
     }
     if (CL_SUCCESS == retVal) {
-        retVal = pProgram->build(*deviceVectorPtr, options);
-        pProgram->invokeCallback(funcNotify, userData);
+        if (funcNotify != nullptr && DebugManager.flags.EnableAsyncProgramBuild.get() == 1) {
+            retVal = pProgram->buildAsync(*deviceVectorPtr, options, funcNotify, userData);
+        } else {
+            retVal = pProgram->build(*deviceVectorPtr, options);
+            pProgram->invokeCallback(funcNotify, userData);
+        }
     }
 
     TRACING_EXIT(ClBuildProgram, &retVal);
@@ -1770,6 +1776,7 @@ cl_kernel CL_API_CALL clCreateKernel(cl_program clProgram,
             break;
         }
 
+        pProgram->waitForAsyncBuild();
         if (!pProgram->isBuilt()) {
             retVal = CL_INVALID_PROGRAM_EXECUTABLE;
             break;
@@ -1822,6 +1829,7 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
                    "numKernelsRet", numKernelsRet);
     auto pProgram = castToObject<Program>(clProgram);
     if (pProgram) {
+        pProgram->waitForAsyncBuild();
         auto numKernelsInProgram = pProgram->getNumKernels();
 
         if (kernels) {
@@ -1834,16 +1842,23 @@ cl_int CL_API_CALL clCreateKernelsInProgram(cl_program clProgram,
             for (unsigned int i = 0; i < numKernelsInProgram; ++i) {
                 KernelInfoContainer kernelInfos;
                 kernelInfos.resize(pProgram->getMaxRootDeviceIndex() + 1);
+                bool kernelInfosValid = true;
                 for (const auto &pClDevice : pProgram->getDevicesInProgram()) {
                     auto rootDeviceIndex = pClDevice->getRootDeviceIndex();
                     auto kernelInfo = pProgram->getKernelInfo(i, rootDeviceIndex);
                     DEBUG_BREAK_IF(kernelInfo == nullptr);
                     kernelInfos[rootDeviceIndex] = kernelInfo;
+                    kernelInfosValid &= (kernelInfo != nullptr);
+                }
+                if (kernelInfosValid) {
+                    kernels[i] = MultiDeviceKernel::create(
+                        pProgram,
+                        kernelInfos,
+                        retVal);
+                } else {
+                    kernels[i] = nullptr;
+                    retVal = CL_INVALID_PROGRAM_EXECUTABLE;
                 }
-                kernels[i] = MultiDeviceKernel::create(
-                    pProgram,
-                    kernelInfos,
-                    retVal);
                 if (nullptr == kernels[i]) {
                     UNRECOVERABLE_IF(CL_SUCCESS == retVal);
                     for (unsigned int createdIdx = 0; createdIdx < i; ++createdIdx) {
@@ -4493,6 +4508,22 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueAcquireExternalMemObjectsKHR);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueReleaseExternalMemObjectsKHR);
 
+    RETURN_FUNC_PTR_IF_EXIST(clCreateCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clFinalizeCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clRetainCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clReleaseCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clEnqueueCommandBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandBarrierWithWaitListKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyBufferRectKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyBufferToImageKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyImageKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandCopyImageToBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandFillBufferKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandFillImageKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clCommandNDRangeKernelKHR);
+    RETURN_FUNC_PTR_IF_EXIST(clGetCommandBufferInfoKHR);
+
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
         TRACING_EXIT(ClGetExtensionFunctionAddress, &ret);
@@ -6211,3 +6242,613 @@ cl_int CL_API_CALL clEnqueueReleaseExternalMemObjectsKHR(
 
     return clEnqueueExternalMemObjectsKHR(commandQueue, numMemObjects, memObjects, numEventsInWaitList, eventWaitList, event);
 }
+
+cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
+    cl_uint numQueues,
+    const cl_command_queue *queues,
+    const cl_command_buffer_properties_khr *properties,
+    cl_int *errcodeRet) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("numQueues", numQueues, "queues", queues, "properties", properties);
+
+    cl_command_buffer_khr commandBuffer = nullptr;
+    CommandQueue *pCommandQueue = nullptr;
+
+    do {
+        // Single device only, command buffer is recorded for exactly one queue
+        if ((numQueues != 1u) || (queues == nullptr)) {
+            retVal = CL_INVALID_VALUE;
+            break;
+        }
+
+        retVal = validateObjects(withCastToInternal(queues[0], &pCommandQueue));
+        if (retVal != CL_SUCCESS) {
+            break;
+        }
+
+        commandBuffer = ClCommandBuffer::create(pCommandQueue, properties, retVal);
+    } while (false);
+
+    if (errcodeRet) {
+        *errcodeRet = retVal;
+    }
+    return commandBuffer;
+}
+
+cl_int CL_API_CALL clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->finalize();
+    }
+    return retVal;
+}
+
+cl_int CL_API_CALL clRetainCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer));
+    if (retVal == CL_SUCCESS) {
+        pCommandBuffer->retain();
+    }
+    return retVal;
+}
+
+cl_int CL_API_CALL clReleaseCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer));
+    if (retVal == CL_SUCCESS) {
+        pCommandBuffer->release();
+    }
+    return retVal;
+}
+
+cl_int CL_API_CALL clEnqueueCommandBufferKHR(
+    cl_uint numQueues,
+    cl_command_queue *queues,
+    cl_command_buffer_khr commandBuffer,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("numQueues", numQueues, "queues", queues, "commandBuffer", commandBuffer,
+                   "numEventsInWaitList", numEventsInWaitList,
+                   "eventWaitList", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(eventWaitList), numEventsInWaitList),
+                   "event", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(event), 1));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             EventWaitList(numEventsInWaitList, eventWaitList));
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((numQueues == 0u) != (queues == nullptr)) {
+        return CL_INVALID_VALUE;
+    }
+
+    CommandQueue *pCommandQueue = &pCommandBuffer->getCommandQueue();
+    if (queues != nullptr) {
+        if (numQueues != 1u) {
+            return CL_INVALID_VALUE;
+        }
+        retVal = validateObjects(withCastToInternal(queues[0], &pCommandQueue));
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+        if (!pCommandBuffer->isCompatibleQueue(*pCommandQueue)) {
+            return CL_INCOMPATIBLE_COMMAND_QUEUE_KHR;
+        }
+    }
+
+    retVal = pCommandBuffer->enqueue(*pCommandQueue, numEventsInWaitList, eventWaitList, event);
+
+    DBG_LOG_INPUTS("event", getClFileLogger().getEvents(reinterpret_cast<const uintptr_t *>(event), 1u));
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "commandQueue", commandQueue,
+                   "numSyncPointsInWaitList", numSyncPointsInWaitList);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    pCommandBuffer->addCommand([](CommandQueue &queue) {
+        return queue.enqueueBarrierWithWaitList(0, nullptr, nullptr);
+    },
+                               {}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t size,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "srcBuffer", srcBuffer, "dstBuffer", dstBuffer,
+                   "srcOffset", srcOffset, "dstOffset", dstOffset, "size", size);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Buffer *pSrcBuffer = nullptr;
+    Buffer *pDstBuffer = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(srcBuffer, &pSrcBuffer),
+                             withCastToInternal(dstBuffer, &pDstBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((pSrcBuffer->getContext() != &pCommandBuffer->getContext()) || (pDstBuffer->getContext() != &pCommandBuffer->getContext())) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((size == 0) || (srcOffset + size > pSrcBuffer->getSize()) || (dstOffset + size > pDstBuffer->getSize())) {
+        return CL_INVALID_VALUE;
+    }
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueCopyBuffer(pSrcBuffer, pDstBuffer, srcOffset, dstOffset, size, 0, nullptr, nullptr);
+    },
+                               {pSrcBuffer, pDstBuffer}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyBufferRectKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    const size_t *srcOrigin,
+    const size_t *dstOrigin,
+    const size_t *region,
+    size_t srcRowPitch,
+    size_t srcSlicePitch,
+    size_t dstRowPitch,
+    size_t dstSlicePitch,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "srcBuffer", srcBuffer, "dstBuffer", dstBuffer,
+                   "srcOrigin", NEO::fileLoggerInstance().getInput(srcOrigin, 0),
+                   "dstOrigin", NEO::fileLoggerInstance().getInput(dstOrigin, 0),
+                   "region", NEO::fileLoggerInstance().getInput(region, 0));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Buffer *pSrcBuffer = nullptr;
+    Buffer *pDstBuffer = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(srcBuffer, &pSrcBuffer),
+                             withCastToInternal(dstBuffer, &pDstBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((pSrcBuffer->getContext() != &pCommandBuffer->getContext()) || (pDstBuffer->getContext() != &pCommandBuffer->getContext())) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((srcOrigin == nullptr) || (dstOrigin == nullptr) || (region == nullptr) ||
+        pSrcBuffer->bufferRectPitchSet(srcOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch, true) == false ||
+        pDstBuffer->bufferRectPitchSet(dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch, false) == false) {
+        return CL_INVALID_VALUE;
+    }
+
+    std::array<size_t, 3> srcOriginCopy = {srcOrigin[0], srcOrigin[1], srcOrigin[2]};
+    std::array<size_t, 3> dstOriginCopy = {dstOrigin[0], dstOrigin[1], dstOrigin[2]};
+    std::array<size_t, 3> regionCopy = {region[0], region[1], region[2]};
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueCopyBufferRect(pSrcBuffer, pDstBuffer, srcOriginCopy.data(), dstOriginCopy.data(), regionCopy.data(),
+                                           srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch, 0, nullptr, nullptr);
+    },
+                               {pSrcBuffer, pDstBuffer}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstImage,
+    size_t srcOffset,
+    const size_t *dstOrigin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "srcBuffer", srcBuffer, "dstImage", dstImage, "srcOffset", srcOffset,
+                   "dstOrigin", NEO::fileLoggerInstance().getInput(dstOrigin, 0),
+                   "region", NEO::fileLoggerInstance().getInput(region, 0));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Buffer *pSrcBuffer = nullptr;
+    Image *pDstImage = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(srcBuffer, &pSrcBuffer),
+                             withCastToInternal(dstImage, &pDstImage));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((pSrcBuffer->getContext() != &pCommandBuffer->getContext()) || (pDstImage->getContext() != &pCommandBuffer->getContext())) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((dstOrigin == nullptr) || (region == nullptr)) {
+        return CL_INVALID_VALUE;
+    }
+
+    std::array<size_t, 3> dstOriginCopy = {dstOrigin[0], dstOrigin[1], dstOrigin[2]};
+    std::array<size_t, 3> regionCopy = {region[0], region[1], region[2]};
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueCopyBufferToImage(pSrcBuffer, pDstImage, srcOffset, dstOriginCopy.data(), regionCopy.data(), 0, nullptr, nullptr);
+    },
+                               {pSrcBuffer, pDstImage}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcImage,
+    cl_mem dstImage,
+    const size_t *srcOrigin,
+    const size_t *dstOrigin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "srcImage", srcImage, "dstImage", dstImage,
+                   "srcOrigin", NEO::fileLoggerInstance().getInput(srcOrigin, 0),
+                   "dstOrigin", NEO::fileLoggerInstance().getInput(dstOrigin, 0),
+                   "region", NEO::fileLoggerInstance().getInput(region, 0));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Image *pSrcImage = nullptr;
+    Image *pDstImage = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(srcImage, &pSrcImage),
+                             withCastToInternal(dstImage, &pDstImage));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((pSrcImage->getContext() != &pCommandBuffer->getContext()) || (pDstImage->getContext() != &pCommandBuffer->getContext())) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((srcOrigin == nullptr) || (dstOrigin == nullptr) || (region == nullptr)) {
+        return CL_INVALID_VALUE;
+    }
+    if (memcmp(&pSrcImage->getImageFormat(), &pDstImage->getImageFormat(), sizeof(cl_image_format))) {
+        return CL_IMAGE_FORMAT_MISMATCH;
+    }
+
+    std::array<size_t, 3> srcOriginCopy = {srcOrigin[0], srcOrigin[1], srcOrigin[2]};
+    std::array<size_t, 3> dstOriginCopy = {dstOrigin[0], dstOrigin[1], dstOrigin[2]};
+    std::array<size_t, 3> regionCopy = {region[0], region[1], region[2]};
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueCopyImage(pSrcImage, pDstImage, srcOriginCopy.data(), dstOriginCopy.data(), regionCopy.data(), 0, nullptr, nullptr);
+    },
+                               {pSrcImage, pDstImage}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcImage,
+    cl_mem dstBuffer,
+    const size_t *srcOrigin,
+    const size_t *region,
+    size_t dstOffset,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "srcImage", srcImage, "dstBuffer", dstBuffer,
+                   "srcOrigin", NEO::fileLoggerInstance().getInput(srcOrigin, 0),
+                   "region", NEO::fileLoggerInstance().getInput(region, 0),
+                   "dstOffset", dstOffset);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Image *pSrcImage = nullptr;
+    Buffer *pDstBuffer = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(srcImage, &pSrcImage),
+                             withCastToInternal(dstBuffer, &pDstBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((pSrcImage->getContext() != &pCommandBuffer->getContext()) || (pDstBuffer->getContext() != &pCommandBuffer->getContext())) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((srcOrigin == nullptr) || (region == nullptr)) {
+        return CL_INVALID_VALUE;
+    }
+
+    std::array<size_t, 3> srcOriginCopy = {srcOrigin[0], srcOrigin[1], srcOrigin[2]};
+    std::array<size_t, 3> regionCopy = {region[0], region[1], region[2]};
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueCopyImageToBuffer(pSrcImage, pDstBuffer, srcOriginCopy.data(), regionCopy.data(), dstOffset, 0, nullptr, nullptr);
+    },
+                               {pSrcImage, pDstBuffer}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandFillBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem buffer,
+    const void *pattern,
+    size_t patternSize,
+    size_t offset,
+    size_t size,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "buffer", buffer,
+                   "pattern", NEO::fileLoggerInstance().infoPointerToString(pattern, patternSize), "patternSize", patternSize,
+                   "offset", offset, "size", size);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Buffer *pBuffer = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(buffer, &pBuffer),
+                             pattern,
+                             (PatternSize)patternSize);
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if (pBuffer->getContext() != &pCommandBuffer->getContext()) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((offset % patternSize != 0) || (size % patternSize != 0) || (offset + size > pBuffer->getSize())) {
+        return CL_INVALID_VALUE;
+    }
+
+    auto patternBegin = static_cast<const uint8_t *>(pattern);
+    std::vector<uint8_t> patternCopy(patternBegin, patternBegin + patternSize);
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueFillBuffer(pBuffer, patternCopy.data(), patternCopy.size(), offset, size, 0, nullptr, nullptr);
+    },
+                               {pBuffer}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandFillImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem image,
+    const void *fillColor,
+    const size_t *origin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "image", image, "fillColor", fillColor,
+                   "origin", NEO::fileLoggerInstance().getInput(origin, 0),
+                   "region", NEO::fileLoggerInstance().getInput(region, 0));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    Image *pImage = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(image, &pImage),
+                             fillColor);
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if (pImage->getContext() != &pCommandBuffer->getContext()) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((origin == nullptr) || (region == nullptr)) {
+        return CL_INVALID_VALUE;
+    }
+
+    // Fill color is always four 32-bit components
+    std::array<uint32_t, 4> fillColorCopy = {};
+    memcpy_s(fillColorCopy.data(), sizeof(fillColorCopy), fillColor, sizeof(fillColorCopy));
+    std::array<size_t, 3> originCopy = {origin[0], origin[1], origin[2]};
+    std::array<size_t, 3> regionCopy = {region[0], region[1], region[2]};
+
+    pCommandBuffer->addCommand([=](CommandQueue &queue) {
+        return queue.enqueueFillImage(pImage, fillColorCopy.data(), originCopy.data(), regionCopy.data(), 0, nullptr, nullptr);
+    },
+                               {pImage}, syncPoint);
+    return retVal;
+}
+
+cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    const cl_ndrange_kernel_command_properties_khr *properties,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "kernel", kernel, "workDim", workDim,
+                   "globalWorkSize", NEO::fileLoggerInstance().getSizes(globalWorkSize, workDim, false),
+                   "localWorkSize", NEO::fileLoggerInstance().getSizes(localWorkSize, workDim, true));
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    MultiDeviceKernel *pMultiDeviceKernel = nullptr;
+
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer),
+                             withCastToInternal(kernel, &pMultiDeviceKernel));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->validateCommand(commandQueue, numSyncPointsInWaitList, syncPointWaitList, mutableHandle);
+    }
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    if ((properties != nullptr) && (properties[0] != 0)) {
+        return CL_INVALID_VALUE;
+    }
+    if (&pMultiDeviceKernel->getContext() != &pCommandBuffer->getContext()) {
+        return CL_INVALID_CONTEXT;
+    }
+    if ((workDim == 0) || (workDim > 3)) {
+        return CL_INVALID_WORK_DIMENSION;
+    }
+    if (globalWorkSize == nullptr) {
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+    }
+
+    auto rootDeviceIndex = pCommandBuffer->getCommandQueue().getDevice().getRootDeviceIndex();
+    Kernel *pKernel = pMultiDeviceKernel->getKernel(rootDeviceIndex);
+    if (!pKernel->isPatched()) {
+        return CL_INVALID_KERNEL_ARGS;
+    }
+    if ((pKernel->getExecutionType() != KernelExecutionType::Default) ||
+        pKernel->usesSyncBuffer()) {
+        return CL_INVALID_KERNEL;
+    }
+
+    // Capture argument values set at record time
+    auto kernelClone = MultiDeviceKernel::create(pMultiDeviceKernel->getProgram(), pMultiDeviceKernel->getKernelInfos(), retVal);
+    if (kernelClone == nullptr) {
+        return retVal;
+    }
+    retVal = kernelClone->cloneKernel(pMultiDeviceKernel);
+    if (retVal != CL_SUCCESS) {
+        kernelClone->release();
+        return retVal;
+    }
+
+    retVal = pCommandBuffer->addKernelCommand(kernelClone, workDim, globalWorkOffset, globalWorkSize, localWorkSize, syncPoint);
+    if (retVal != CL_SUCCESS) {
+        kernelClone->release();
+    }
+    return retVal;
+}
+
+cl_int CL_API_CALL clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_buffer_info_khr paramName,
+    size_t paramValueSize,
+    void *paramValue,
+    size_t *paramValueSizeRet) {
+
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("commandBuffer", commandBuffer, "paramName", paramName,
+                   "paramValueSize", paramValueSize, "paramValue", paramValue,
+                   "paramValueSizeRet", paramValueSizeRet);
+
+    ClCommandBuffer *pCommandBuffer = nullptr;
+    retVal = validateObjects(withCastToInternal(commandBuffer, &pCommandBuffer));
+    if (retVal == CL_SUCCESS) {
+        retVal = pCommandBuffer->getInfo(paramName, paramValueSize, paramValue, paramValueSizeRet);
+    }
+    return retVal;
+}
@@ -1125,3 +1125,149 @@ cl_int CL_API_CALL clEnqueueReleaseExternalMemObjectsKHR(
     cl_uint numEventsInWaitList,
     const cl_event *eventWaitList,
     cl_event *event);
+
+cl_command_buffer_khr CL_API_CALL clCreateCommandBufferKHR(
+    cl_uint numQueues,
+    const cl_command_queue *queues,
+    const cl_command_buffer_properties_khr *properties,
+    cl_int *errcodeRet);
+
+cl_int CL_API_CALL clFinalizeCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer);
+
+cl_int CL_API_CALL clRetainCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer);
+
+cl_int CL_API_CALL clReleaseCommandBufferKHR(
+    cl_command_buffer_khr commandBuffer);
+
+cl_int CL_API_CALL clEnqueueCommandBufferKHR(
+    cl_uint numQueues,
+    cl_command_queue *queues,
+    cl_command_buffer_khr commandBuffer,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event);
+
+cl_int CL_API_CALL clCommandBarrierWithWaitListKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandCopyBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    size_t srcOffset,
+    size_t dstOffset,
+    size_t size,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandCopyBufferRectKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstBuffer,
+    const size_t *srcOrigin,
+    const size_t *dstOrigin,
+    const size_t *region,
+    size_t srcRowPitch,
+    size_t srcSlicePitch,
+    size_t dstRowPitch,
+    size_t dstSlicePitch,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandCopyBufferToImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcBuffer,
+    cl_mem dstImage,
+    size_t srcOffset,
+    const size_t *dstOrigin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandCopyImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcImage,
+    cl_mem dstImage,
+    const size_t *srcOrigin,
+    const size_t *dstOrigin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandCopyImageToBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem srcImage,
+    cl_mem dstBuffer,
+    const size_t *srcOrigin,
+    const size_t *region,
+    size_t dstOffset,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandFillBufferKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem buffer,
+    const void *pattern,
+    size_t patternSize,
+    size_t offset,
+    size_t size,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandFillImageKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    cl_mem image,
+    const void *fillColor,
+    const size_t *origin,
+    const size_t *region,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clCommandNDRangeKernelKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_queue commandQueue,
+    const cl_ndrange_kernel_command_properties_khr *properties,
+    cl_kernel kernel,
+    cl_uint workDim,
+    const size_t *globalWorkOffset,
+    const size_t *globalWorkSize,
+    const size_t *localWorkSize,
+    cl_uint numSyncPointsInWaitList,
+    const cl_sync_point_khr *syncPointWaitList,
+    cl_sync_point_khr *syncPoint,
+    cl_mutable_command_khr *mutableHandle);
+
+cl_int CL_API_CALL clGetCommandBufferInfoKHR(
+    cl_command_buffer_khr commandBuffer,
+    cl_command_buffer_info_khr paramName,
+    size_t paramValueSize,
+    void *paramValue,
+    size_t *paramValueSizeRet);
@@ -195,6 +195,12 @@ cl_int ClDevice::getDeviceInfo(cl_device_info paramName,
             getCap<CL_DEVICE_DEVICE_ENQUEUE_CAPABILITIES>(src, srcSize, retSize);
         }
         break;
+    case CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR:
+    case CL_DEVICE_COMMAND_BUFFER_REQUIRED_QUEUE_PROPERTIES_KHR:
+        srcSize = retSize = sizeof(cl_bitfield);
+        param.bitfield = 0u;
+        src = &param.bitfield;
+        break;
     case CL_DEVICE_NUM_SIMULTANEOUS_INTEROPS_INTEL:
         if (simultaneousInterops.size() > 1u) {
             srcSize = retSize = sizeof(cl_uint);
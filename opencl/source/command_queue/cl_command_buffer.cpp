@@ -0,0 +1,420 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+
+#include "shared/source/helpers/get_info.h"
+
+#include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/cl_device/cl_device.h"
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/context/context.h"
+#include "opencl/source/event/event.h"
+#include "opencl/source/helpers/dispatch_info_builder.h"
+#include "opencl/source/helpers/get_info_status_mapper.h"
+#include "opencl/source/kernel/multi_device_kernel.h"
+#include "opencl/source/mem_obj/mem_obj.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace NEO {
+
+ClCommandBuffer *ClCommandBuffer::create(CommandQueue *commandQueue, const cl_command_buffer_properties_khr *properties, cl_int &errcodeRet) {
+    errcodeRet = CL_SUCCESS;
+
+    // Replay relies on in-order execution of recorded commands
+    if (commandQueue->isOOQEnabled()) {
+        errcodeRet = CL_INCOMPATIBLE_COMMAND_QUEUE_KHR;
+        return nullptr;
+    }
+
+    std::vector<cl_command_buffer_properties_khr> propertiesVector;
+    if (properties != nullptr) {
+        for (size_t i = 0; properties[i] != 0; i += 2) {
+            if (properties[i] != CL_COMMAND_BUFFER_FLAGS_KHR) {
+                errcodeRet = CL_INVALID_VALUE;
+                return nullptr;
+            }
+            auto flags = static_cast<cl_command_buffer_flags_khr>(properties[i + 1]);
+            if (flags & ~static_cast<cl_command_buffer_flags_khr>(CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR)) {
+                errcodeRet = CL_INVALID_VALUE;
+                return nullptr;
+            }
+            if (flags & CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR) {
+                errcodeRet = CL_INVALID_PROPERTY;
+                return nullptr;
+            }
+            propertiesVector.push_back(properties[i]);
+            propertiesVector.push_back(properties[i + 1]);
+        }
+        propertiesVector.push_back(0);
+    }
+
+    return new ClCommandBuffer(commandQueue, std::move(propertiesVector));
+}
+
+ClCommandBuffer::ClCommandBuffer(CommandQueue *commandQueue, std::vector<cl_command_buffer_properties_khr> &&properties)
+    : propertiesVector(std::move(properties)), commandQueue(commandQueue) {
+    commandQueue->incRefInternal();
+}
+
+ClCommandBuffer::~ClCommandBuffer() {
+    if (lastSubmission) {
+        lastSubmission->release();
+    }
+    for (auto kernelClone : kernelClones) {
+        kernelClone->release();
+    }
+    for (auto memObj : memObjects) {
+        memObj->decRefInternal();
+    }
+    commandQueue->decRefInternal();
+}
+
+Context &ClCommandBuffer::getContext() const {
+    return commandQueue->getContext();
+}
+
+cl_int ClCommandBuffer::validateCommand(cl_command_queue commandQueue, cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList,
+                                        const cl_mutable_command_khr *mutableHandle) const {
+    if (commandQueue != nullptr) {
+        return CL_INVALID_COMMAND_QUEUE;
+    }
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+    if (mutableHandle != nullptr) {
+        return CL_INVALID_VALUE;
+    }
+    if ((numSyncPointsInWaitList > 0) != (syncPointWaitList != nullptr)) {
+        return CL_INVALID_SYNC_POINT_WAIT_LIST_KHR;
+    }
+    for (cl_uint i = 0; i < numSyncPointsInWaitList; i++) {
+        if ((syncPointWaitList[i] == 0) || (syncPointWaitList[i] > commands.size())) {
+            return CL_INVALID_SYNC_POINT_WAIT_LIST_KHR;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+void ClCommandBuffer::addCommand(RecordedCommand &&command, std::initializer_list<MemObj *> usedMemObjects, cl_sync_point_khr *syncPoint) {
+    for (auto memObj : usedMemObjects) {
+        memObj->incRefInternal();
+        memObjects.push_back(memObj);
+    }
+    pushCommand({std::move(command), nullptr}, syncPoint);
+}
+
+void ClCommandBuffer::pushCommand(Command &&command, cl_sync_point_khr *syncPoint) {
+    commands.push_back(std::move(command));
+
+    // Commands are submitted in order, so a sync point is always signaled before any later command starts
+    if (syncPoint) {
+        *syncPoint = static_cast<cl_sync_point_khr>(commands.size());
+    }
+}
+
+cl_int ClCommandBuffer::validateKernelCommand(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                              const size_t *localWorkSize) const {
+    if (workDim > commandQueue->getClDevice().getDeviceInfo().maxWorkItemDimensions) {
+        return CL_INVALID_WORK_DIMENSION;
+    }
+
+    const auto &kernelAttributes = kernel.getKernelInfo().kernelDescriptor.kernelAttributes;
+    const bool haveRequiredWorkGroupSize = (kernelAttributes.requiredWorkgroupSize[0] != 0);
+    size_t region[3] = {1, 1, 1};
+    size_t workOffset[3] = {0, 0, 0};
+    size_t workGroupSize[3] = {1, 1, 1};
+    size_t remainder = 0;
+    size_t totalWorkItems = 1u;
+
+    for (cl_uint i = 0; i < workDim; i++) {
+        region[i] = globalWorkSize[i];
+        workOffset[i] = globalWorkOffset ? globalWorkOffset[i] : 0u;
+
+        if (localWorkSize) {
+            if (haveRequiredWorkGroupSize && (kernelAttributes.requiredWorkgroupSize[i] != localWorkSize[i])) {
+                return CL_INVALID_WORK_GROUP_SIZE;
+            }
+            if (localWorkSize[i] == 0) {
+                return CL_INVALID_WORK_GROUP_SIZE;
+            }
+            workGroupSize[i] = kernel.getAllowNonUniform() ? std::min(localWorkSize[i], std::max(static_cast<size_t>(1), globalWorkSize[i]))
+                                                           : localWorkSize[i];
+            totalWorkItems *= localWorkSize[i];
+        }
+        remainder += region[i] % workGroupSize[i];
+    }
+
+    if (remainder != 0 && !kernel.getAllowNonUniform()) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+    if (totalWorkItems > kernel.getMaxKernelWorkGroupSize()) {
+        return CL_INVALID_WORK_GROUP_SIZE;
+    }
+    if (kernel.getKernelInfo().builtinDispatchBuilder != nullptr) {
+        return kernel.getKernelInfo().builtinDispatchBuilder->validateDispatch(&kernel, workDim, Vec3<size_t>(region), Vec3<size_t>(workGroupSize), Vec3<size_t>(workOffset));
+    }
+    return CL_SUCCESS;
+}
+
+// Kernels that need per-enqueue preparation (printf, aux translation, shared object patching, memory migration)
+// or a builtin dispatch builder are replayed through enqueueKernel instead
+bool ClCommandBuffer::isKernelBatchable(Kernel &kernel) {
+    kernel.updateAuxTranslationRequired();
+    return (kernel.getKernelInfo().builtinDispatchBuilder == nullptr) &&
+           !kernel.hasPrintfOutput() &&
+           !kernel.isAuxTranslationRequired() &&
+           !kernel.isUsingSharedObjArgs() &&
+           !kernel.requiresMemoryMigration();
+}
+
+// Dispatch flags of a submission are taken from a single kernel, so only kernels that agree on them share a batch
+bool ClCommandBuffer::canShareKernelBatch(Kernel &batchKernel, Kernel &kernel) {
+    const auto &batchKernelAttributes = batchKernel.getDescriptor().kernelAttributes;
+    const auto &kernelAttributes = kernel.getDescriptor().kernelAttributes;
+    return (batchKernelAttributes.threadArbitrationPolicy == kernelAttributes.threadArbitrationPolicy) &&
+           (batchKernelAttributes.flags.requiresDisabledEUFusion == kernelAttributes.flags.requiresDisabledEUFusion) &&
+           (batchKernel.getAdditionalKernelExecInfo() == kernel.getAdditionalKernelExecInfo()) &&
+           (batchKernel.areStatelessWritesUsed() == kernel.areStatelessWritesUsed());
+}
+
+void ClCommandBuffer::retainKernelMemObjects(const Kernel &kernel) {
+    for (const auto &argument : kernel.getKernelArguments()) {
+        if (!Kernel::isMemObj(argument.type) || (argument.object == nullptr)) {
+            continue;
+        }
+        auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(argument.object));
+        auto memObj = castToObject<MemObj>(clMem);
+        if (memObj) {
+            memObj->incRefInternal();
+            memObjects.push_back(memObj);
+        }
+    }
+}
+
+cl_int ClCommandBuffer::addKernelCommand(MultiDeviceKernel *kernelClone, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                         const size_t *localWorkSize, cl_sync_point_khr *syncPoint) {
+    Kernel *kernel = kernelClone->getKernel(commandQueue->getDevice().getRootDeviceIndex());
+
+    auto retVal = validateKernelCommand(*kernel, workDim, globalWorkOffset, globalWorkSize, localWorkSize);
+    if (retVal != CL_SUCCESS) {
+        return retVal;
+    }
+
+    std::array<size_t, 3> workOffset = {0, 0, 0};
+    std::array<size_t, 3> workSize = {1, 1, 1};
+    std::array<size_t, 3> localSize = {1, 1, 1};
+    std::array<size_t, 3> enqueuedLocalSize = {0, 0, 0};
+    for (cl_uint i = 0; i < workDim; i++) {
+        workOffset[i] = globalWorkOffset ? globalWorkOffset[i] : 0u;
+        workSize[i] = globalWorkSize[i];
+        if (localWorkSize) {
+            localSize[i] = kernel->getAllowNonUniform() ? std::min(localWorkSize[i], std::max(static_cast<size_t>(1), globalWorkSize[i]))
+                                                        : localWorkSize[i];
+            enqueuedLocalSize[i] = localWorkSize[i];
+        }
+    }
+
+    Command command;
+    if (kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
+        const auto &requiredWorkgroupSize = kernel->getKernelInfo().kernelDescriptor.kernelAttributes.requiredWorkgroupSize;
+        size_t reqdWorkgroupSize[3] = {requiredWorkgroupSize[0], requiredWorkgroupSize[1], requiredWorkgroupSize[2]};
+        const size_t *localWorkSizeToPass = (requiredWorkgroupSize[0] != 0) ? reqdWorkgroupSize : (localWorkSize ? localSize.data() : nullptr);
+
+        auto kernelDispatch = std::make_unique<MultiDispatchInfo>(kernel);
+        DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder(commandQueue->getClDevice());
+        builder.setDispatchGeometry(workDim, workSize.data(), enqueuedLocalSize.data(), workOffset.data(), Vec3<size_t>{0, 0, 0}, localWorkSizeToPass);
+        builder.setKernel(kernel);
+        builder.bake(*kernelDispatch);
+
+        for (auto &dispatchInfo : *kernelDispatch) {
+            auto &nwgs = dispatchInfo.getNumberOfWorkgroups();
+            for (cl_uint i = 0; i < workDim; i++) {
+                if (static_cast<uint64_t>(nwgs[i]) > std::numeric_limits<uint32_t>::max()) {
+                    return CL_INVALID_GLOBAL_WORK_SIZE;
+                }
+            }
+        }
+
+        if (isKernelBatchable(*kernel)) {
+            command.kernelDispatch = std::move(kernelDispatch);
+        }
+    }
+
+    if (!command.kernelDispatch) {
+        bool localSizeSpecified = (localWorkSize != nullptr);
+        command.replay = [=](CommandQueue &queue) {
+            return queue.enqueueKernel(kernel, workDim, workOffset.data(), workSize.data(),
+                                       localSizeSpecified ? enqueuedLocalSize.data() : nullptr, 0, nullptr, nullptr);
+        };
+    }
+
+    // The clone holds only handles to its memory arguments, the command buffer keeps them alive
+    retainKernelMemObjects(*kernel);
+    kernelClones.push_back(kernelClone);
+    pushCommand(std::move(command), syncPoint);
+    return CL_SUCCESS;
+}
+
+cl_int ClCommandBuffer::finalize() {
+    if (finalized) {
+        return CL_INVALID_OPERATION;
+    }
+
+    // Runs of consecutive kernel commands are merged into one multi-dispatch, so each run is programmed and flushed by a single enqueue
+    Kernel *batchKernel = nullptr;
+    for (auto &command : commands) {
+        if (!command.kernelDispatch) {
+            submissions.push_back({command.replay, nullptr});
+            batchKernel = nullptr;
+            continue;
+        }
+        if (command.kernelDispatch->empty()) {
+            continue;
+        }
+
+        auto kernel = command.kernelDispatch->peekMainKernel();
+        if ((batchKernel == nullptr) || !canShareKernelBatch(*batchKernel, *kernel)) {
+            submissions.push_back({nullptr, std::make_unique<MultiDispatchInfo>(kernel)});
+            batchKernel = kernel;
+        }
+        for (auto &dispatchInfo : *command.kernelDispatch) {
+            submissions.back().kernelDispatch->push(dispatchInfo);
+        }
+    }
+
+    finalized = true;
+    return CL_SUCCESS;
+}
+
+bool ClCommandBuffer::isCompatibleQueue(const CommandQueue &queue) const {
+    return (&queue.getClDevice() == &commandQueue->getClDevice()) &&
+           (&queue.getContext() == &commandQueue->getContext()) &&
+           !queue.isOOQEnabled();
+}
+
+cl_command_buffer_state_khr ClCommandBuffer::getState() const {
+    if (!finalized) {
+        return CL_COMMAND_BUFFER_STATE_RECORDING_KHR;
+    }
+    if (lastSubmission && (lastSubmission->updateEventAndReturnCurrentStatus() > CL_COMPLETE)) {
+        return CL_COMMAND_BUFFER_STATE_PENDING_KHR;
+    }
+    return CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR;
+}
+
+cl_int ClCommandBuffer::enqueue(CommandQueue &queue, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) {
+    // Everything that can be rejected is checked before the first submission, so a failed enqueue submits nothing
+    auto state = getState();
+    if (state != CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR) {
+        return CL_INVALID_OPERATION;
+    }
+    for (cl_uint i = 0; i < numEventsInWaitList; i++) {
+        auto waitEvent = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (waitEvent->getContext() != &queue.getContext()) {
+            return CL_INVALID_CONTEXT;
+        }
+    }
+
+    TakeOwnershipWrapper<CommandQueue> queueOwnership(queue);
+
+    // Kernel batches take the wait list and signal the submission event themselves, markers are needed only around replayed commands
+    const bool firstSubmissionWaits = !submissions.empty() && (submissions.front().kernelDispatch != nullptr);
+    const bool lastSubmissionSignals = !submissions.empty() && (submissions.back().kernelDispatch != nullptr);
+
+    cl_int retVal = CL_SUCCESS;
+    if ((numEventsInWaitList > 0) && !firstSubmissionWaits) {
+        retVal = queue.enqueueMarkerWithWaitList(numEventsInWaitList, eventWaitList, nullptr);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+
+    cl_event submissionEvent = nullptr;
+    for (size_t i = 0; i < submissions.size(); i++) {
+        auto &submission = submissions[i];
+        if (submission.kernelDispatch) {
+            const bool isFirst = (i == 0);
+            const bool isLast = (i + 1 == submissions.size());
+            retVal = queue.enqueueKernelBatch(*submission.kernelDispatch,
+                                              isFirst ? numEventsInWaitList : 0u, isFirst ? eventWaitList : nullptr,
+                                              isLast ? &submissionEvent : nullptr);
+        } else {
+            retVal = submission.replay(queue);
+        }
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+
+    if (!lastSubmissionSignals) {
+        retVal = queue.enqueueMarkerWithWaitList(0, nullptr, &submissionEvent);
+        if (retVal != CL_SUCCESS) {
+            return retVal;
+        }
+    }
+
+    if (lastSubmission) {
+        lastSubmission->release();
+        lastSubmission = nullptr;
+    }
+    lastSubmission = castToObject<Event>(submissionEvent);
+    if (lastSubmission) {
+        lastSubmission->setCmdType(CL_COMMAND_COMMAND_BUFFER_KHR);
+        if (event) {
+            lastSubmission->retain();
+            *event = submissionEvent;
+        }
+    }
+    return CL_SUCCESS;
+}
+
+cl_int ClCommandBuffer::getInfo(cl_command_buffer_info_khr paramName, size_t paramValueSize, void *paramValue, size_t *paramValueSizeRet) const {
+    size_t srcSize = GetInfo::invalidSourceSize;
+    const void *srcParam = nullptr;
+    cl_uint numQueues = 1u;
+    cl_uint refCount = 0u;
+    cl_command_buffer_state_khr state = 0u;
+    cl_command_queue queue = commandQueue;
+
+    switch (paramName) {
+    case CL_COMMAND_BUFFER_QUEUES_KHR:
+        srcSize = sizeof(queue);
+        srcParam = &queue;
+        break;
+    case CL_COMMAND_BUFFER_NUM_QUEUES_KHR:
+        srcSize = sizeof(numQueues);
+        srcParam = &numQueues;
+        break;
+    case CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR:
+        refCount = static_cast<cl_uint>(getReference());
+        srcSize = sizeof(refCount);
+        srcParam = &refCount;
+        break;
+    case CL_COMMAND_BUFFER_STATE_KHR:
+        state = getState();
+        srcSize = sizeof(state);
+        srcParam = &state;
+        break;
+    case CL_COMMAND_BUFFER_PROPERTIES_ARRAY_KHR:
+        srcSize = propertiesVector.size() * sizeof(cl_command_buffer_properties_khr);
+        srcParam = propertiesVector.data();
+        break;
+    default:
+        break;
+    }
+
+    auto getInfoStatus = GetInfo::getInfo(paramValue, paramValueSize, srcParam, srcSize);
+    auto retVal = changeGetInfoStatusToCLResultType(getInfoStatus);
+    GetInfo::setParamValueReturnSize(paramValueSizeRet, srcSize, getInfoStatus);
+    return retVal;
+}
+
+} // namespace NEO
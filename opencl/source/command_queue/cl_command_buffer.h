@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/api/cl_types.h"
+#include "opencl/source/helpers/base_object.h"
+#include "opencl/source/helpers/dispatch_info.h"
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace NEO {
+class CommandQueue;
+class Context;
+class Event;
+class Kernel;
+class MemObj;
+class MultiDeviceKernel;
+
+template <>
+struct OpenCLObjectMapper<_cl_command_buffer_khr> {
+    typedef class ClCommandBuffer DerivedType;
+};
+
+// cl_khr_command_buffer object.
+// Commands are recorded for replay, nothing is pre-encoded: every enqueue programs walkers and flushes
+// through the regular command queue path. Commands are validated once at record time. Finalize merges
+// runs of consecutive kernel commands into single multi-dispatches, which are submitted with one enqueue
+// each; other commands are replayed back-to-back on the queue, without API validation, user events or
+// intermediate synchronization. Mutable dispatch is not supported.
+// Recorded kernels are clones, so argument values set on the original kernel after recording
+// do not affect the command buffer.
+class ClCommandBuffer : public BaseObject<_cl_command_buffer_khr> {
+  public:
+    static const cl_ulong objectMagic = 0x6B3C84E0D5A19F27LL;
+
+    using RecordedCommand = std::function<cl_int(CommandQueue &)>;
+
+    static ClCommandBuffer *create(CommandQueue *commandQueue, const cl_command_buffer_properties_khr *properties, cl_int &errcodeRet);
+
+    ~ClCommandBuffer() override;
+
+    cl_int validateCommand(cl_command_queue commandQueue, cl_uint numSyncPointsInWaitList, const cl_sync_point_khr *syncPointWaitList,
+                           const cl_mutable_command_khr *mutableHandle) const;
+    void addCommand(RecordedCommand &&command, std::initializer_list<MemObj *> memObjects, cl_sync_point_khr *syncPoint);
+    cl_int addKernelCommand(MultiDeviceKernel *kernelClone, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                            const size_t *localWorkSize, cl_sync_point_khr *syncPoint);
+
+    cl_int finalize();
+    cl_int enqueue(CommandQueue &commandQueue, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event);
+    bool isCompatibleQueue(const CommandQueue &queue) const;
+
+    cl_command_buffer_state_khr getState() const;
+    CommandQueue &getCommandQueue() const { return *commandQueue; }
+    Context &getContext() const;
+    size_t getNumCommands() const { return commands.size(); }
+    size_t getNumSubmissions() const { return submissions.size(); }
+
+    cl_int getInfo(cl_command_buffer_info_khr paramName, size_t paramValueSize, void *paramValue, size_t *paramValueSizeRet) const;
+
+  protected:
+    struct Command {
+        RecordedCommand replay;
+        std::unique_ptr<MultiDispatchInfo> kernelDispatch;
+    };
+
+    ClCommandBuffer(CommandQueue *commandQueue, std::vector<cl_command_buffer_properties_khr> &&properties);
+
+    cl_int validateKernelCommand(Kernel &kernel, cl_uint workDim, const size_t *globalWorkOffset, const size_t *globalWorkSize,
+                                 const size_t *localWorkSize) const;
+    static bool isKernelBatchable(Kernel &kernel);
+    static bool canShareKernelBatch(Kernel &batchKernel, Kernel &kernel);
+    void retainKernelMemObjects(const Kernel &kernel);
+    void pushCommand(Command &&command, cl_sync_point_khr *syncPoint);
+
+    std::vector<Command> commands;
+    std::vector<Command> submissions;
+    std::vector<MemObj *> memObjects;
+    std::vector<MultiDeviceKernel *> kernelClones;
+    std::vector<cl_command_buffer_properties_khr> propertiesVector;
+    CommandQueue *commandQueue = nullptr;
+    Event *lastSubmission = nullptr;
+    bool finalized = false;
+};
+} // namespace NEO
@@ -169,6 +169,11 @@ class CommandQueueHw : public CommandQueue {
                          const cl_event *eventWaitList,
                          cl_event *event) override;
 
+    cl_int enqueueKernelBatch(MultiDispatchInfo &multiDispatchInfo,
+                              cl_uint numEventsInWaitList,
+                              const cl_event *eventWaitList,
+                              cl_event *event) override;
+
     cl_int enqueueSVMMap(cl_bool blockingMap,
                          cl_map_flags mapFlags,
                          void *svmPtr,
@@ -460,6 +465,8 @@ class CommandQueueHw : public CommandQueue {
 
     MOCKABLE_VIRTUAL void dispatchAuxTranslationBuiltin(MultiDispatchInfo &multiDispatchInfo, AuxTranslationDirection auxTranslationDirection);
     void setupBlitAuxTranslation(MultiDispatchInfo &multiDispatchInfo);
+    static void dispatchBarrierBetweenKernels(LinearStream &commandStream, TimestampPacketDependencies *timestampPacketDependencies, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static size_t getSizeForBarrierBetweenKernels(size_t, const RootDeviceEnvironment &rootDeviceEnvironment, bool);
 
     MOCKABLE_VIRTUAL bool forceStateless(size_t size);
 
@@ -7,6 +7,8 @@
 
 #pragma once
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/pipe_control_args.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
 #include "opencl/source/command_queue/command_queue_hw.h"
@@ -138,4 +140,39 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         event);
 }
 
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueKernelBatch(
+    MultiDispatchInfo &multiDispatchInfo,
+    cl_uint numEventsInWaitList,
+    const cl_event *eventWaitList,
+    cl_event *event) {
+
+    // Dispatches of different kernels execute in order, a walker split of a single kernel does not need a barrier
+    for (auto dispatchInfo = multiDispatchInfo.begin(); (dispatchInfo + 1) < multiDispatchInfo.end(); dispatchInfo++) {
+        if (dispatchInfo->getKernel() != (dispatchInfo + 1)->getKernel()) {
+            dispatchInfo->dispatchEpilogueCommands.registerMethod(dispatchBarrierBetweenKernels);
+            dispatchInfo->dispatchEpilogueCommands.registerCommandsSizeEstimationMethod(getSizeForBarrierBetweenKernels);
+        }
+    }
+
+    NullSurface s;
+    Surface *surfaces[] = {&s};
+
+    return enqueueHandler<CL_COMMAND_NDRANGE_KERNEL>(surfaces, false, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
+}
+
+template <typename GfxFamily>
+void CommandQueueHw<GfxFamily>::dispatchBarrierBetweenKernels(LinearStream &commandStream, TimestampPacketDependencies *, const RootDeviceEnvironment &) {
+    PipeControlArgs args;
+    args.csStallOnly = true;
+    args.hdcPipelineFlush = true;
+    args.unTypedDataPortCacheFlush = true;
+    MemorySynchronizationCommands<GfxFamily>::addSingleBarrier(commandStream, args);
+}
+
+template <typename GfxFamily>
+size_t CommandQueueHw<GfxFamily>::getSizeForBarrierBetweenKernels(size_t, const RootDeviceEnvironment &, bool) {
+    return MemorySynchronizationCommands<GfxFamily>::getSizeForSingleBarrier(false);
+}
 } // namespace NEO
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/default_cache_config.h"
 
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/os_interface/debug_env_reader.h"
 #include "shared/source/os_interface/sys_calls_common.h"
@@ -22,11 +23,14 @@ namespace NEO {
 std::string NeoCachePersistent = "NEO_CACHE_PERSISTENT";
 std::string NeoCacheMaxSize = "NEO_CACHE_MAX_SIZE";
 std::string NeoCacheDir = "NEO_CACHE_DIR";
+std::string NeoCacheIndexedPack = "NEO_CACHE_INDEXED_PACK";
 std::string ClCacheDir = "cl_cache_dir";
 
 CompilerCacheConfig getDefaultCompilerCacheConfig() {
     CompilerCacheConfig ret;
     NEO::EnvironmentVariableReader envReader;
+    ret.memoryTierSize = getDefaultCompilerCacheMemoryTierSize();
+    ret.mapCachedBinaries = DebugManager.flags.BinaryCacheZeroCopyLoad.get();
 
     if (envReader.getSetting(NeoCachePersistent.c_str(), defaultCacheEnabled()) != 0) {
         ret.enabled = true;
@@ -53,6 +57,10 @@ CompilerCacheConfig getDefaultCompilerCacheConfig() {
             ret.cacheSize = std::numeric_limits<size_t>::max();
         }
 
+        if (envReader.getSetting(NeoCacheIndexedPack.c_str(), false)) {
+            ret.format = CompilerCacheFormat::indexedPack;
+        }
+
         return ret;
     }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "CL/cl.h"
+#include "CL/cl_ext.h"
 
 template <typename Type>
 struct NullObjectErrorMapper {
@@ -14,6 +15,7 @@ struct NullObjectErrorMapper {
 };
 
 // clang-format off
+template <> struct NullObjectErrorMapper<cl_command_buffer_khr> { static const cl_int retVal = CL_INVALID_COMMAND_BUFFER_KHR; };
 template <> struct NullObjectErrorMapper<cl_command_queue> { static const cl_int retVal = CL_INVALID_COMMAND_QUEUE; };
 template <> struct NullObjectErrorMapper<cl_context> { static const cl_int retVal = CL_INVALID_CONTEXT; };
 template <> struct NullObjectErrorMapper<cl_device_id> { static const cl_int retVal = CL_INVALID_DEVICE; };
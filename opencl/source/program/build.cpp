@@ -16,6 +16,7 @@
 #include "shared/source/helpers/compiler_options_parser.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/utilities/logger.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
@@ -24,8 +25,10 @@
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/program/program.h"
 
+#include <chrono>
 #include <cstring>
 #include <iterator>
+#include <memory>
 #include <sstream>
 
 namespace NEO {
@@ -92,12 +95,7 @@ cl_int Program::build(
             std::string extensions = requiresOpenClCFeatures(options) ? defaultClDevice->peekCompilerExtensionsWithFeatures()
                                                                       : defaultClDevice->peekCompilerExtensions();
 
-            appendAdditionalExtensions(extensions, options, internalOptions);
-            CompilerOptions::concatenateAppend(internalOptions, extensions);
-
-            if (!this->getIsBuiltIn() && DebugManager.flags.InjectInternalBuildOptions.get() != "unk") {
-                NEO::CompilerOptions::concatenateAppend(internalOptions, NEO::DebugManager.flags.InjectInternalBuildOptions.get());
-            }
+            appendProgramBuildInternalOptions(internalOptions, options, extensions, this->getIsBuiltIn());
 
             if (nullptr != this->getContextPtr()) {
                 if (this->getContext().checkIfContextIsNonZebin()) {
@@ -110,12 +108,12 @@ cl_int Program::build(
             inputArgs.internalOptions = ArrayRef<const char>(internalOptions.c_str(), internalOptions.length());
             inputArgs.gtPinInput = gtpinGetIgcInit();
             inputArgs.specializedValues = this->specConstantsValues;
+            inputArgs.allowCachedBinaryView = true;
             DBG_LOG(LogApiCalls,
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
-            NEO::TranslationOutput compilerOuput = {};
-
             for (const auto &clDevice : deviceVector) {
+                NEO::TranslationOutput compilerOuput = {};
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
                     this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
@@ -136,7 +134,11 @@ cl_int Program::build(
                 if (BuildPhase::BinaryCreation == phaseReached[clDevice->getRootDeviceIndex()]) {
                     continue;
                 }
-                this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
+                if (compilerOuput.cachedDeviceBinary != nullptr) {
+                    this->setSharedDeviceBinary(std::move(compilerOuput.cachedDeviceBinary), clDevice->getRootDeviceIndex());
+                } else {
+                    this->replaceDeviceBinary(std::move(compilerOuput.deviceBinary.mem), compilerOuput.deviceBinary.size, clDevice->getRootDeviceIndex());
+                }
                 phaseReached[clDevice->getRootDeviceIndex()] = BuildPhase::BinaryCreation;
             }
             if (retVal != CL_SUCCESS) {
@@ -148,13 +150,13 @@ cl_int Program::build(
         retVal = processGenBinaries(deviceVector, phaseReached);
 
         auto skipLastExplicitArg = isGTPinInitialized;
-        auto containsStatefulAccess = AddressingModeHelper::containsStatefulAccess(buildInfos[clDevices[0]->getRootDeviceIndex()].kernelInfoArray, skipLastExplicitArg);
         auto isUserKernel = !isBuiltIn;
 
-        auto failBuildProgram = containsStatefulAccess &&
-                                isUserKernel &&
+        // Stateful access check is evaluated last as it may force decoding of deferred kernel metadata
+        auto failBuildProgram = isUserKernel &&
                                 AddressingModeHelper::failBuildProgramWithStatefulAccess(clDevices[0]->getRootDeviceEnvironment()) &&
-                                isGeneratedByIgc;
+                                isGeneratedByIgc &&
+                                AddressingModeHelper::containsStatefulAccess(buildInfos[clDevices[0]->getRootDeviceIndex()].kernelInfoArray, skipLastExplicitArg);
 
         if (failBuildProgram) {
             retVal = CL_BUILD_PROGRAM_FAILURE;
@@ -199,6 +201,47 @@ cl_int Program::build(const ClDeviceVector &deviceVector, const char *buildOptio
     return ret;
 }
 
+cl_int Program::buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions,
+                           void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData) {
+    // Build is marked as completed before notification, so that callback can query build results and create kernels
+    auto buildCompleted = std::make_shared<std::promise<void>>();
+    {
+        std::lock_guard<std::mutex> lock(asyncBuildMutex);
+        if (asyncBuild.valid() && asyncBuild.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+            return CL_INVALID_OPERATION;
+        }
+        asyncBuild = buildCompleted->get_future().share();
+    }
+
+    auto optionsCopy = buildOptions != nullptr ? std::make_shared<std::string>(buildOptions) : nullptr;
+    this->incRefInternal();
+    auto task = [this, deviceVector, optionsCopy, funcNotify, userData, buildCompleted]() {
+        this->build(deviceVector, optionsCopy ? optionsCopy->c_str() : nullptr);
+        buildCompleted->set_value();
+        this->invokeCallback(funcNotify, userData);
+        this->decRefInternal();
+    };
+    // not holding asyncBuildMutex here, a pool without workers runs the task inline and the callback may query the program
+    executionEnvironment.getBuildThreadPool()->enqueue(task);
+    return CL_SUCCESS;
+}
+
+bool Program::isAsyncBuildInProgress() const {
+    std::lock_guard<std::mutex> lock(asyncBuildMutex);
+    return asyncBuild.valid() && asyncBuild.wait_for(std::chrono::seconds(0)) != std::future_status::ready;
+}
+
+void Program::waitForAsyncBuild() const {
+    std::shared_future<void> build;
+    {
+        std::lock_guard<std::mutex> lock(asyncBuildMutex);
+        build = asyncBuild;
+    }
+    if (build.valid()) {
+        build.wait();
+    }
+}
+
 void Program::extractInternalOptions(const std::string &options, std::string &internalOptions) {
     auto tokenized = CompilerOptions::tokenize(options);
     for (auto &optionString : internalOptionsToExtract) {
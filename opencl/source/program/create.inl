@@ -135,7 +135,7 @@ T *Program::createBuiltInFromGenBinary(
 
         program = new T(context, true, deviceVector);
         for (const auto &device : deviceVector) {
-            if (program->buildInfos[device->getRootDeviceIndex()].packedDeviceBinarySize == 0) {
+            if (program->getPackedDeviceBinary(device->getRootDeviceIndex()).empty()) {
                 program->replaceDeviceBinary(std::move(makeCopy(binary, size)), size, device->getRootDeviceIndex());
             }
         }
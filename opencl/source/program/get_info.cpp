@@ -24,6 +24,7 @@ namespace NEO {
 
 cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
                         void *paramValue, size_t *paramValueSizeRet) {
+    waitForAsyncBuild();
     cl_int retVal = CL_SUCCESS;
     const void *pSrc = nullptr;
     size_t srcSize = GetInfo::invalidSourceSize;
@@ -61,8 +62,8 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
                 continue;
             }
             auto rootDeviceIndex = clDevices[i]->getRootDeviceIndex();
-            auto binarySize = buildInfos[rootDeviceIndex].packedDeviceBinarySize;
-            memcpy_s(outputBinaries[i], binarySize, buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize);
+            auto binary = getPackedDeviceBinary(rootDeviceIndex);
+            memcpy_s(outputBinaries[i], binary.size(), binary.begin(), binary.size());
         }
         GetInfo::setParamValueReturnSize(paramValueSizeRet, requiredSize, GetInfoStatus::SUCCESS);
         return CL_SUCCESS;
@@ -72,7 +73,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         for (auto i = 0u; i < clDevices.size(); i++) {
             auto rootDeviceIndex = clDevices[i]->getRootDeviceIndex();
             packDeviceBinary(*clDevices[i]);
-            binarySizes.push_back(buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+            binarySizes.push_back(getPackedDeviceBinary(rootDeviceIndex).size());
         }
 
         pSrc = binarySizes.data();
@@ -143,7 +144,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         for (auto i = 0u; i < clDevices.size(); i++) {
             auto rootDeviceIndex = clDevices[i]->getRootDeviceIndex();
             if (nullptr == buildInfos[rootDeviceIndex].debugData) {
-                auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()), buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+                auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
                 if (isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(refBin)) {
                     createDebugZebin(rootDeviceIndex);
                 } else
@@ -170,7 +171,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
         for (auto i = 0u; i < clDevices.size(); i++) {
             auto rootDeviceIndex = clDevices[i]->getRootDeviceIndex();
             if (nullptr == buildInfos[rootDeviceIndex].debugData) {
-                auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()), buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+                auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
                 if (isDeviceBinaryFormat<DeviceBinaryFormat::Zebin>(refBin)) {
                     createDebugZebin(rootDeviceIndex);
                 } else
@@ -213,10 +214,16 @@ cl_int Program::getBuildInfo(cl_device_id device, cl_program_build_info paramNam
     auto pClDev = castToObject<ClDevice>(device);
     auto rootDeviceIndex = pClDev->getRootDeviceIndex();
 
+    const cl_build_status asyncBuildStatus = CL_BUILD_IN_PROGRESS;
+    const bool asyncBuildInProgress = isAsyncBuildInProgress();
+    if (asyncBuildInProgress && paramName != CL_PROGRAM_BUILD_STATUS) {
+        waitForAsyncBuild();
+    }
+
     switch (paramName) {
     case CL_PROGRAM_BUILD_STATUS:
         srcSize = retSize = sizeof(cl_build_status);
-        pSrc = &deviceBuildInfos.at(pClDev).buildStatus;
+        pSrc = asyncBuildInProgress ? &asyncBuildStatus : &deviceBuildInfos.at(pClDev).buildStatus;
         break;
 
     case CL_PROGRAM_BUILD_OPTIONS:
@@ -52,7 +52,10 @@ const KernelInfo *Program::getKernelInfo(
     auto it = std::find_if(kernelInfoArray.begin(), kernelInfoArray.end(),
                            [=](const KernelInfo *kInfo) { return (0 == strcmp(kInfo->kernelDescriptor.kernelMetadata.kernelName.c_str(), kernelName)); });
 
-    return (it != kernelInfoArray.end()) ? *it : nullptr;
+    if (it == kernelInfoArray.end() || false == (*it)->kernelDescriptor.decodeDeferredMetadata()) {
+        return nullptr;
+    }
+    return *it;
 }
 
 size_t Program::getNumKernels() const {
@@ -70,6 +73,9 @@ const KernelInfo *Program::getKernelInfo(size_t ordinal, uint32_t rootDeviceInde
         ordinal++;
     }
     DEBUG_BREAK_IF(ordinal >= kernelInfoArray.size());
+    if (false == kernelInfoArray[ordinal]->kernelDescriptor.decodeDeferredMetadata()) {
+        return nullptr;
+    }
     return kernelInfoArray[ordinal];
 }
 
@@ -179,8 +185,8 @@ cl_int Program::processGenBinaries(const ClDeviceVector &clDevices, std::unorder
 
 cl_int Program::processGenBinary(const ClDevice &clDevice) {
     auto rootDeviceIndex = clDevice.getRootDeviceIndex();
-    if (nullptr == this->buildInfos[rootDeviceIndex].unpackedDeviceBinary) {
-        ArrayRef<const uint8_t> archive(reinterpret_cast<uint8_t *>(this->buildInfos[rootDeviceIndex].packedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+    if (getUnpackedDeviceBinary(rootDeviceIndex).empty()) {
+        auto archive = getPackedDeviceBinary(rootDeviceIndex);
         if (isAnyPackedDeviceBinaryFormat(archive)) {
             std::string outErrReason, outWarning;
             auto productAbbreviation = NEO::hardwarePrefix[clDevice.getHardwareInfo().platform.eProductFamily];
@@ -210,7 +216,7 @@ cl_int Program::processGenBinary(const ClDevice &clDevice) {
     }
 
     ProgramInfo programInfo;
-    auto blob = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
+    auto blob = getUnpackedDeviceBinary(rootDeviceIndex);
     SingleDeviceBinary binary = {};
     binary.deviceBinary = blob;
     binary.targetDevice = NEO::getTargetDevice(clDevice.getRootDeviceEnvironment());
@@ -338,7 +344,7 @@ void Program::createDebugZebin(uint32_t rootDeviceIndex) {
     auto &debugDataRef = this->buildInfos[rootDeviceIndex].debugData;
     auto &debugDataSizeRef = this->buildInfos[rootDeviceIndex].debugDataSize;
 
-    auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()), buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+    auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
     auto segments = getZebinSegments(rootDeviceIndex);
     auto debugZebin = Zebin::Debug::createDebugZebin(refBin, segments);
 
@@ -350,8 +356,7 @@ void Program::createDebugZebin(uint32_t rootDeviceIndex) {
 
 void Program::createDebugData(ClDevice *clDevice) {
     auto rootDeviceIndex = clDevice->getRootDeviceIndex();
-    auto &buildInfo = this->buildInfos[rootDeviceIndex];
-    auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
+    auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
     if (NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Zebin>(refBin)) {
         createDebugZebin(rootDeviceIndex);
     } else {
@@ -362,7 +367,7 @@ void Program::createDebugData(ClDevice *clDevice) {
 void Program::callPopulateZebinExtendedArgsMetadataOnce(uint32_t rootDeviceIndex) {
     auto &buildInfo = this->buildInfos[rootDeviceIndex];
     auto extractAndDecodeMetadata = [&]() {
-        auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
+        auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
         if (false == NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Zebin>(refBin)) {
             return;
         }
@@ -388,7 +393,8 @@ void Program::callGenerateDefaultExtendedArgsMetadataOnce(uint32_t rootDeviceInd
     auto &buildInfo = this->buildInfos[rootDeviceIndex];
     auto generateDefaultMetadata = [&]() {
         for (const auto &kernelInfo : buildInfo.kernelInfoArray) {
-            if (false == kernelInfo->kernelDescriptor.explicitArgsExtendedMetadata.empty()) {
+            if (false == kernelInfo->kernelDescriptor.decodeDeferredMetadata() ||
+                false == kernelInfo->kernelDescriptor.explicitArgsExtendedMetadata.empty()) {
                 continue;
             }
             size_t argIndex = 0u;
@@ -8,6 +8,7 @@
 #include "program.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/compiler_options_extra.h"
 #include "shared/source/compiler_interface/external_functions.h"
@@ -63,53 +64,20 @@ Program::Program(Context *context, bool isBuiltIn, const ClDeviceVector &clDevic
 
 std::string Program::getInternalOptions() const {
     auto pClDevice = clDevices[0];
-    auto force32BitAddressess = pClDevice->getSharedDeviceInfo().force32BitAddressess;
-    auto internalOptions = getOclVersionCompilerInternalOption(pClDevice->getEnabledClVersion());
-
-    if (force32BitAddressess && !isBuiltIn) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::arch32bit);
-    }
-
     auto &hwInfo = pClDevice->getHardwareInfo();
     const auto &compilerProductHelper = pClDevice->getRootDeviceEnvironment().getHelper<CompilerProductHelper>();
-    auto forceToStatelessRequired = compilerProductHelper.isForceToStatelessRequired();
-    auto disableStatelessToStatefulOptimization = DebugManager.flags.DisableStatelessToStatefulOptimization.get();
-
-    if ((isBuiltIn && is32bit) || forceToStatelessRequired || disableStatelessToStatefulOptimization) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::greaterThan4gbBuffersRequired);
-    }
-
-    if (ApiSpecificConfig::getBindlessMode(nullptr)) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::bindlessMode);
-    }
-
-    auto enableStatelessToStatefulWithOffset = pClDevice->getGfxCoreHelper().isStatelessToStatefulWithOffsetSupported();
-    if (DebugManager.flags.EnableStatelessToStatefulBufferOffsetOpt.get() != -1) {
-        enableStatelessToStatefulWithOffset = DebugManager.flags.EnableStatelessToStatefulBufferOffsetOpt.get() != 0;
-    }
-
-    if (enableStatelessToStatefulWithOffset) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::hasBufferOffsetArg);
-    }
-
-    const auto &productHelper = pClDevice->getProductHelper();
-    if (productHelper.isForceEmuInt32DivRemSPWARequired(hwInfo)) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::forceEmuInt32DivRemSP);
-    }
-
-    if (hwInfo.capabilityTable.supportsImages) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::enableImageSupport);
-    }
 
-    if (pClDevice->getDevice().getExecutionEnvironment()->isFP64EmulationEnabled()) {
-        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::enableFP64GenEmu);
-    }
-
-    CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::preserveVec3Type);
-    auto isDebuggerActive = pClDevice->getDevice().getDebugger() != nullptr;
-    CompilerOptions::concatenateAppend(internalOptions, compilerProductHelper.getCachingPolicyOptions(isDebuggerActive));
-    CompilerOptions::applyExtraInternalOptions(internalOptions, compilerProductHelper);
-    return internalOptions;
+    ProgramInternalOptionsArgs args;
+    args.clVersion = pClDevice->getEnabledClVersion();
+    args.force32BitAddressing = pClDevice->getSharedDeviceInfo().force32BitAddressess && !isBuiltIn;
+    args.greaterThan4gbBuffersRequired = (isBuiltIn && is32bit) || compilerProductHelper.isForceToStatelessRequired();
+    args.bindlessMode = ApiSpecificConfig::getBindlessMode(nullptr);
+    args.statelessToStatefulWithOffsetSupported = pClDevice->getGfxCoreHelper().isStatelessToStatefulWithOffsetSupported();
+    args.forceEmuInt32DivRemSP = pClDevice->getProductHelper().isForceEmuInt32DivRemSPWARequired(hwInfo);
+    args.supportsImages = hwInfo.capabilityTable.supportsImages;
+    args.fp64Emulation = pClDevice->getDevice().getExecutionEnvironment()->isFP64EmulationEnabled();
+    args.debuggerActive = pClDevice->getDevice().getDebugger() != nullptr;
+    return getProgramInternalOptions(args, compilerProductHelper);
 }
 
 Program::~Program() {
@@ -156,6 +124,9 @@ cl_int Program::createProgramFromBinary(
     this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = 0U;
     this->buildInfos[rootDeviceIndex].packedDeviceBinary.reset();
     this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = 0U;
+    this->buildInfos[rootDeviceIndex].sharedDeviceBinary.reset();
+    this->buildInfos[rootDeviceIndex].unpackedDeviceBinaryView = {};
+    this->buildInfos[rootDeviceIndex].packedDeviceBinaryView = {};
     this->createdFrom = CreatedFrom::BINARY;
 
     ArrayRef<const uint8_t> archive(reinterpret_cast<const uint8_t *>(pBinary), binarySize);
@@ -208,10 +179,9 @@ cl_int Program::createProgramFromBinary(
                 return CL_INVALID_BINARY;
             }
             if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
-                this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
-                this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
-                this->buildInfos[rootDeviceIndex].packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = archive.size();
+                // For fat binaries keep only the member matching this device instead of the whole archive
+                auto packedBinary = singleDeviceBinary.packedTargetDeviceBinary.empty() ? archive : singleDeviceBinary.packedTargetDeviceBinary;
+                setDeviceBinaryCopy(packedBinary, singleDeviceBinary.deviceBinary, rootDeviceIndex);
 
             } else {
                 this->isCreatedFromBinary = false;
@@ -374,6 +344,9 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
 }
 
 void Program::replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
+    this->buildInfos[rootDeviceIndex].sharedDeviceBinary.reset();
+    this->buildInfos[rootDeviceIndex].unpackedDeviceBinaryView = {};
+    this->buildInfos[rootDeviceIndex].packedDeviceBinaryView = {};
     if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(newBinary);
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = newBinarySize;
@@ -391,19 +364,73 @@ void Program::replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t ne
     }
 }
 
+void Program::setSharedDeviceBinary(std::shared_ptr<const CachedBinary> &&binary, uint32_t rootDeviceIndex) {
+    auto &buildInfo = this->buildInfos[rootDeviceIndex];
+    buildInfo.unpackedDeviceBinary.reset();
+    buildInfo.unpackedDeviceBinarySize = 0U;
+    buildInfo.packedDeviceBinary.reset();
+    buildInfo.packedDeviceBinarySize = 0U;
+
+    auto blob = ArrayRef<const uint8_t>::fromAny(binary->getData().begin(), binary->getSize());
+    buildInfo.packedDeviceBinaryView = isAnyPackedDeviceBinaryFormat(blob) ? blob : ArrayRef<const uint8_t>();
+    buildInfo.unpackedDeviceBinaryView = isAnySingleDeviceBinaryFormat(blob) ? blob : ArrayRef<const uint8_t>();
+    buildInfo.sharedDeviceBinary = std::move(binary);
+}
+
+void Program::setDeviceBinaryCopy(ArrayRef<const uint8_t> packedBinary, ArrayRef<const uint8_t> unpackedBinary, uint32_t rootDeviceIndex) {
+    auto &buildInfo = this->buildInfos[rootDeviceIndex];
+    buildInfo.unpackedDeviceBinary.reset();
+    buildInfo.unpackedDeviceBinarySize = 0U;
+    buildInfo.packedDeviceBinary.reset();
+    buildInfo.packedDeviceBinarySize = 0U;
+    buildInfo.unpackedDeviceBinaryView = {};
+
+    // packed binary is copied once, unpacked binary is usually part of it (e.g. zebin member of fat binary) and then it is only a view
+    auto storage = makeCopy<char>(reinterpret_cast<const char *>(packedBinary.begin()), packedBinary.size());
+    auto packedCopy = std::make_shared<HeapCachedBinary>(std::move(storage), packedBinary.size());
+    buildInfo.packedDeviceBinaryView = ArrayRef<const uint8_t>::fromAny(packedCopy->getData().begin(), packedCopy->getSize());
+
+    const bool unpackedIsPartOfPacked = (unpackedBinary.begin() >= packedBinary.begin()) && (unpackedBinary.end() <= packedBinary.end());
+    if (unpackedIsPartOfPacked) {
+        auto offset = static_cast<size_t>(unpackedBinary.begin() - packedBinary.begin());
+        buildInfo.unpackedDeviceBinaryView = ArrayRef<const uint8_t>(buildInfo.packedDeviceBinaryView.begin() + offset, unpackedBinary.size());
+    } else {
+        buildInfo.unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(unpackedBinary.begin()), unpackedBinary.size());
+        buildInfo.unpackedDeviceBinarySize = unpackedBinary.size();
+    }
+    buildInfo.sharedDeviceBinary = std::move(packedCopy);
+}
+
+ArrayRef<const uint8_t> Program::getUnpackedDeviceBinary(uint32_t rootDeviceIndex) const {
+    auto &buildInfo = this->buildInfos[rootDeviceIndex];
+    if (nullptr != buildInfo.unpackedDeviceBinary) {
+        return ArrayRef<const uint8_t>::fromAny(buildInfo.unpackedDeviceBinary.get(), buildInfo.unpackedDeviceBinarySize);
+    }
+    return buildInfo.unpackedDeviceBinaryView;
+}
+
+ArrayRef<const uint8_t> Program::getPackedDeviceBinary(uint32_t rootDeviceIndex) const {
+    auto &buildInfo = this->buildInfos[rootDeviceIndex];
+    if (nullptr != buildInfo.packedDeviceBinary) {
+        return ArrayRef<const uint8_t>::fromAny(buildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinarySize);
+    }
+    return buildInfo.packedDeviceBinaryView;
+}
+
 cl_int Program::packDeviceBinary(ClDevice &clDevice) {
     auto rootDeviceIndex = clDevice.getRootDeviceIndex();
-    if (nullptr != buildInfos[rootDeviceIndex].packedDeviceBinary) {
+    if (false == getPackedDeviceBinary(rootDeviceIndex).empty()) {
         return CL_SUCCESS;
     }
 
     auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex];
 
-    if (nullptr != this->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()) {
+    auto unpackedDeviceBinary = getUnpackedDeviceBinary(rootDeviceIndex);
+    if (false == unpackedDeviceBinary.empty()) {
         SingleDeviceBinary singleDeviceBinary = {};
         singleDeviceBinary.targetDevice = NEO::getTargetDevice(rootDeviceEnvironment);
         singleDeviceBinary.buildOptions = this->options;
-        singleDeviceBinary.deviceBinary = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
+        singleDeviceBinary.deviceBinary = unpackedDeviceBinary;
         singleDeviceBinary.intermediateRepresentation = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->irBinary.get()), this->irBinarySize);
         singleDeviceBinary.debugData = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(this->buildInfos[rootDeviceIndex].debugData.get()), this->buildInfos[rootDeviceIndex].debugDataSize);
 
@@ -595,7 +622,7 @@ void Program::notifyModuleCreate() {
             auto debuggerL0 = device->getDevice().getL0Debugger();
             auto rootDeviceIndex = device->getRootDeviceIndex();
             auto &buildInfo = this->buildInfos[rootDeviceIndex];
-            auto refBin = ArrayRef<const uint8_t>(reinterpret_cast<const uint8_t *>(buildInfo.unpackedDeviceBinary.get()), buildInfo.unpackedDeviceBinarySize);
+            auto refBin = getUnpackedDeviceBinary(rootDeviceIndex);
 
             if (NEO::isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Zebin>(refBin)) {
 
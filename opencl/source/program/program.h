@@ -15,6 +15,7 @@
 #include "opencl/source/helpers/base_object.h"
 
 #include <functional>
+#include <future>
 
 namespace NEO {
 namespace Zebin::Debug {
@@ -133,6 +134,11 @@ class Program : public BaseObject<_cl_program> {
     cl_int build(const ClDeviceVector &deviceVector, const char *buildOptions,
                  std::unordered_map<std::string, BuiltinDispatchInfoBuilder *> &builtinsMap);
 
+    cl_int buildAsync(const ClDeviceVector &deviceVector, const char *buildOptions,
+                      void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
+    bool isAsyncBuildInProgress() const;
+    void waitForAsyncBuild() const;
+
     cl_int processGenBinaries(const ClDeviceVector &clDevices, std::unordered_map<uint32_t, BuildPhase> &phaseReached);
     MOCKABLE_VIRTUAL cl_int processGenBinary(const ClDevice &clDevice);
     MOCKABLE_VIRTUAL cl_int processProgramInfo(ProgramInfo &dst, const ClDevice &clDevice);
@@ -235,6 +241,10 @@ class Program : public BaseObject<_cl_program> {
     }
 
     MOCKABLE_VIRTUAL void replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex);
+    void setSharedDeviceBinary(std::shared_ptr<const CachedBinary> &&binary, uint32_t rootDeviceIndex);
+    void setDeviceBinaryCopy(ArrayRef<const uint8_t> packedBinary, ArrayRef<const uint8_t> unpackedBinary, uint32_t rootDeviceIndex);
+    ArrayRef<const uint8_t> getUnpackedDeviceBinary(uint32_t rootDeviceIndex) const;
+    ArrayRef<const uint8_t> getPackedDeviceBinary(uint32_t rootDeviceIndex) const;
 
     static bool isValidCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
     void invokeCallback(void(CL_CALLBACK *funcNotify)(cl_program program, void *userData), void *userData);
@@ -256,8 +266,13 @@ class Program : public BaseObject<_cl_program> {
         exposedKernels--;
     }
     bool isLocked() {
-        std::unique_lock<std::mutex> lock{lockMutex};
-        return 0 != exposedKernels;
+        {
+            std::unique_lock<std::mutex> lock{lockMutex};
+            if (0 != exposedKernels) {
+                return true;
+            }
+        }
+        return isAsyncBuildInProgress();
     }
     bool getCreatedFromBinary() const {
         return isCreatedFromBinary;
@@ -343,6 +358,12 @@ class Program : public BaseObject<_cl_program> {
 
         std::unique_ptr<char[]> packedDeviceBinary;
         size_t packedDeviceBinarySize = 0U;
+
+        // Read-only device binary shared with its other owners (e.g. compiler cache memory tier).
+        // The views point into it and are used only when the owned copies above are not set.
+        std::shared_ptr<const CachedBinary> sharedDeviceBinary;
+        ArrayRef<const uint8_t> unpackedDeviceBinaryView;
+        ArrayRef<const uint8_t> packedDeviceBinaryView;
         ProgramInfo::GlobalSurfaceInfo constStringSectionData;
 
         std::unique_ptr<char[]> debugData;
@@ -377,6 +398,9 @@ class Program : public BaseObject<_cl_program> {
     std::mutex lockMutex;
     uint32_t exposedKernels = 0;
 
+    std::shared_future<void> asyncBuild;
+    mutable std::mutex asyncBuildMutex;
+
     size_t exportedFunctionsKernelId = std::numeric_limits<size_t>::max();
 
     struct MetadataGenerationFlags {
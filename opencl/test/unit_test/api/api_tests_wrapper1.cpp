@@ -8,6 +8,7 @@
 #include "opencl/test/unit_test/api/cl_add_comment_to_aub_tests.inl"
 #include "opencl/test/unit_test/api/cl_build_program_tests.inl"
 #include "opencl/test/unit_test/api/cl_clone_kernel_tests.inl"
+#include "opencl/test/unit_test/api/cl_command_buffer_khr_tests.inl"
 #include "opencl/test/unit_test/api/cl_compile_program_tests.inl"
 #include "opencl/test/unit_test/api/cl_create_command_queue_tests.inl"
 #include "opencl/test/unit_test/api/cl_create_context_from_type_tests.inl"
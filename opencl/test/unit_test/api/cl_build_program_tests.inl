@@ -7,6 +7,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/kernel_binary_helper.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_compilers.h"
@@ -18,6 +19,9 @@
 
 #include "cl_api_tests.h"
 
+#include <atomic>
+#include <thread>
+
 using namespace NEO;
 
 struct ClBuildProgramTests : public ApiTests {
@@ -447,6 +451,93 @@ TEST_F(ClBuildProgramTests, GivenValidCallbackInputWhenBuildProgramThenCallbackI
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_F(ClBuildProgramTests, GivenAsyncProgramBuildEnabledWhenBuildProgramWithCallbackThenBuildCompletesInBackgroundAndCallbackSeesFinalStatus) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+    DebugManager.flags.BuildThreadPoolSize.set(1);
+    cl_int binaryStatus = CL_SUCCESS;
+
+    constexpr auto numBits = is32bit ? Elf::EI_CLASS_32 : Elf::EI_CLASS_64;
+    auto zebinData = std::make_unique<ZebinTestData::ZebinCopyBufferSimdModule<numBits>>(pDevice->getHardwareInfo(), 16);
+    const auto &src = zebinData->storage;
+    const size_t binarySize = src.size();
+    const unsigned char *binaries[1] = {reinterpret_cast<const unsigned char *>(src.data())};
+    cl_program pProgram = clCreateProgramWithBinary(pContext, 1, &testedClDevice, &binarySize, binaries, &binaryStatus, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, pProgram);
+
+    struct CallbackData {
+        cl_device_id device = nullptr;
+        cl_build_status buildStatus = CL_BUILD_NONE;
+        std::atomic<bool> invoked{false};
+    } callbackData;
+    callbackData.device = testedClDevice;
+
+    auto callback = [](cl_program program, void *userData) {
+        auto data = reinterpret_cast<CallbackData *>(userData);
+        clGetProgramBuildInfo(program, data->device, CL_PROGRAM_BUILD_STATUS, sizeof(cl_build_status), &data->buildStatus, nullptr);
+        data->invoked = true;
+    };
+
+    retVal = clBuildProgram(pProgram, 1, &testedClDevice, nullptr, callback, &callbackData);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto kernel = clCreateKernel(pProgram, "CopyBuffer", &retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, kernel);
+    clReleaseKernel(kernel);
+
+    while (!callbackData.invoked) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(CL_BUILD_SUCCESS, callbackData.buildStatus);
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
+TEST_F(ClBuildProgramTests, GivenAsyncProgramBuildWithoutPoolThreadsWhenCallbackQueriesProgramThenBuildRunsInlineWithoutDeadlock) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableAsyncProgramBuild.set(1);
+    DebugManager.flags.BuildThreadPoolSize.set(0);
+    cl_int binaryStatus = CL_SUCCESS;
+
+    constexpr auto numBits = is32bit ? Elf::EI_CLASS_32 : Elf::EI_CLASS_64;
+    auto zebinData = std::make_unique<ZebinTestData::ZebinCopyBufferSimdModule<numBits>>(pDevice->getHardwareInfo(), 16);
+    const auto &src = zebinData->storage;
+    const size_t binarySize = src.size();
+    const unsigned char *binaries[1] = {reinterpret_cast<const unsigned char *>(src.data())};
+    cl_program pProgram = clCreateProgramWithBinary(pContext, 1, &testedClDevice, &binarySize, binaries, &binaryStatus, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    ASSERT_NE(nullptr, pProgram);
+
+    struct CallbackData {
+        cl_device_id device = nullptr;
+        cl_build_status buildStatus = CL_BUILD_NONE;
+        cl_int createKernelRetVal = CL_INVALID_VALUE;
+        bool invoked = false;
+    } callbackData;
+    callbackData.device = testedClDevice;
+
+    auto callback = [](cl_program program, void *userData) {
+        auto data = reinterpret_cast<CallbackData *>(userData);
+        clGetProgramBuildInfo(program, data->device, CL_PROGRAM_BUILD_STATUS, sizeof(cl_build_status), &data->buildStatus, nullptr);
+        auto kernel = clCreateKernel(program, "CopyBuffer", &data->createKernelRetVal);
+        clReleaseKernel(kernel);
+        data->invoked = true;
+    };
+
+    retVal = clBuildProgram(pProgram, 1, &testedClDevice, nullptr, callback, &callbackData);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_TRUE(callbackData.invoked);
+    EXPECT_EQ(CL_BUILD_SUCCESS, callbackData.buildStatus);
+    EXPECT_EQ(CL_SUCCESS, callbackData.createKernelRetVal);
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
 TEST_F(ClBuildProgramTests, givenProgramWhenBuildingForInvalidDevicesInputThenInvalidDeviceErrorIsReturned) {
     cl_program pProgram = nullptr;
     size_t sourceSize = 0;
@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/command_queue/cl_command_buffer.h"
+#include "opencl/source/mem_obj/buffer.h"
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+struct ClCommandBufferKhrTests : public ApiTests {
+    void SetUp() override {
+        ApiTests::SetUp();
+        queue = pCommandQueue;
+        buffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, bufferSize, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        commandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+        ASSERT_EQ(CL_SUCCESS, retVal);
+        ASSERT_NE(nullptr, commandBuffer);
+    }
+
+    void TearDown() override {
+        clReleaseCommandBufferKHR(commandBuffer);
+        clReleaseMemObject(buffer);
+        ApiTests::TearDown();
+    }
+
+    void setBufferArgs(MockKernelWithInternals &mockKernel) {
+        EXPECT_EQ(CL_SUCCESS, clSetKernelArg(mockKernel.mockMultiDeviceKernel, 0, sizeof(cl_mem), &buffer));
+        EXPECT_EQ(CL_SUCCESS, clSetKernelArg(mockKernel.mockMultiDeviceKernel, 1, sizeof(cl_mem), &buffer));
+    }
+
+    cl_command_buffer_state_khr getState() {
+        cl_command_buffer_state_khr state = 0;
+        EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_STATE_KHR, sizeof(state), &state, nullptr));
+        return state;
+    }
+
+    static constexpr size_t bufferSize = 64u;
+    cl_command_queue queue = nullptr;
+    cl_mem buffer = nullptr;
+    cl_command_buffer_khr commandBuffer = nullptr;
+};
+
+namespace ULT {
+
+TEST_F(ClCommandBufferKhrTests, GivenInvalidQueuesWhenCreatingCommandBufferThenErrorIsReturned) {
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(0, &queue, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, nullptr, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    cl_command_queue invalidQueue = reinterpret_cast<cl_command_queue>(pContext);
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &invalidQueue, nullptr, &retVal));
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, retVal);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenOutOfOrderQueueWhenCreatingCommandBufferThenIncompatibleQueueErrorIsReturned) {
+    cl_queue_properties properties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    auto ooqQueue = clCreateCommandQueueWithProperties(pContext, testedClDevice, properties, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &ooqQueue, nullptr, &retVal));
+    EXPECT_EQ(CL_INCOMPATIBLE_COMMAND_QUEUE_KHR, retVal);
+
+    clReleaseCommandQueue(ooqQueue);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenUnsupportedPropertiesWhenCreatingCommandBufferThenErrorIsReturned) {
+    cl_command_buffer_properties_khr invalidKey[] = {CL_COMMAND_BUFFER_STATE_KHR, 0, 0};
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &queue, invalidKey, &retVal));
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    cl_command_buffer_properties_khr simultaneousUse[] = {CL_COMMAND_BUFFER_FLAGS_KHR, CL_COMMAND_BUFFER_SIMULTANEOUS_USE_KHR, 0};
+    EXPECT_EQ(nullptr, clCreateCommandBufferKHR(1, &queue, simultaneousUse, &retVal));
+    EXPECT_EQ(CL_INVALID_PROPERTY, retVal);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenPropertiesWhenQueryingCommandBufferInfoThenPropertiesArrayIsReturned) {
+    cl_command_buffer_properties_khr properties[] = {CL_COMMAND_BUFFER_FLAGS_KHR, 0, 0};
+    auto commandBufferWithProperties = clCreateCommandBufferKHR(1, &queue, properties, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_command_buffer_properties_khr queriedProperties[3] = {};
+    size_t sizeRet = 0;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBufferWithProperties, CL_COMMAND_BUFFER_PROPERTIES_ARRAY_KHR, sizeof(queriedProperties), queriedProperties, &sizeRet));
+    EXPECT_EQ(sizeof(properties), sizeRet);
+    EXPECT_EQ(0, memcmp(properties, queriedProperties, sizeof(properties)));
+
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_PROPERTIES_ARRAY_KHR, 0, nullptr, &sizeRet));
+    EXPECT_EQ(0u, sizeRet);
+
+    clReleaseCommandBufferKHR(commandBufferWithProperties);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenCommandBufferWhenQueryingInfoThenCorrectValuesAreReturned) {
+    cl_command_queue queriedQueue = nullptr;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_QUEUES_KHR, sizeof(queriedQueue), &queriedQueue, nullptr));
+    EXPECT_EQ(queue, queriedQueue);
+
+    cl_uint numQueues = 0;
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_NUM_QUEUES_KHR, sizeof(numQueues), &numQueues, nullptr));
+    EXPECT_EQ(1u, numQueues);
+
+    cl_uint refCount = 0;
+    EXPECT_EQ(CL_SUCCESS, clRetainCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(CL_SUCCESS, clGetCommandBufferInfoKHR(commandBuffer, CL_COMMAND_BUFFER_REFERENCE_COUNT_KHR, sizeof(refCount), &refCount, nullptr));
+    EXPECT_EQ(2u, refCount);
+    EXPECT_EQ(CL_SUCCESS, clReleaseCommandBufferKHR(commandBuffer));
+
+    EXPECT_EQ(CL_INVALID_VALUE, clGetCommandBufferInfoKHR(commandBuffer, 0, sizeof(refCount), &refCount, nullptr));
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenInvalidCommandBufferWhenCallingCommandBufferApiThenInvalidCommandBufferErrorIsReturned) {
+    cl_command_buffer_khr invalidCommandBuffer = reinterpret_cast<cl_command_buffer_khr>(pContext);
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clFinalizeCommandBufferKHR(nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clRetainCommandBufferKHR(invalidCommandBuffer));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clReleaseCommandBufferKHR(nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clEnqueueCommandBufferKHR(0, nullptr, invalidCommandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clCommandBarrierWithWaitListKHR(nullptr, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_COMMAND_BUFFER_KHR, clGetCommandBufferInfoKHR(invalidCommandBuffer, CL_COMMAND_BUFFER_STATE_KHR, 0, nullptr, nullptr));
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenCommandBufferWhenFinalizedThenStateChangesAndRecordingIsRejected) {
+    EXPECT_EQ(static_cast<cl_command_buffer_state_khr>(CL_COMMAND_BUFFER_STATE_RECORDING_KHR), getState());
+    EXPECT_EQ(CL_INVALID_OPERATION, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(static_cast<cl_command_buffer_state_khr>(CL_COMMAND_BUFFER_STATE_EXECUTABLE_KHR), getState());
+
+    EXPECT_EQ(CL_INVALID_OPERATION, clFinalizeCommandBufferKHR(commandBuffer));
+    EXPECT_EQ(CL_INVALID_OPERATION, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, nullptr));
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenInvalidCommandArgumentsWhenRecordingThenErrorIsReturned) {
+    cl_mutable_command_khr mutableHandle = nullptr;
+    cl_sync_point_khr syncPoint = 0;
+
+    EXPECT_EQ(CL_INVALID_COMMAND_QUEUE, clCommandBarrierWithWaitListKHR(commandBuffer, queue, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, nullptr, nullptr, &mutableHandle));
+    EXPECT_EQ(CL_INVALID_SYNC_POINT_WAIT_LIST_KHR, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 1, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_SYNC_POINT_WAIT_LIST_KHR, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 0, &syncPoint, nullptr, nullptr));
+
+    syncPoint = 1;
+    EXPECT_EQ(CL_INVALID_SYNC_POINT_WAIT_LIST_KHR, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 1, &syncPoint, nullptr, nullptr));
+
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandCopyBufferKHR(commandBuffer, nullptr, buffer, buffer, 0, 0, bufferSize + 1, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_MEM_OBJECT, clCommandCopyBufferKHR(commandBuffer, nullptr, nullptr, buffer, 0, 0, bufferSize, 0, nullptr, nullptr, nullptr));
+
+    uint32_t pattern = 0u;
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, 3, 0, bufferSize, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 1, sizeof(pattern), 0, nullptr, nullptr, nullptr));
+
+    auto clCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    EXPECT_EQ(0u, clCommandBuffer->getNumCommands());
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenRecordedCommandsWhenRecordingThenSyncPointsAreReturnedAndCanBeWaitedOn) {
+    cl_sync_point_khr syncPoints[2] = {};
+    uint32_t pattern = 0xABCDu;
+
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, bufferSize, 0, nullptr, &syncPoints[0], nullptr));
+    EXPECT_NE(0u, syncPoints[0]);
+    EXPECT_EQ(CL_SUCCESS, clCommandCopyBufferKHR(commandBuffer, nullptr, buffer, buffer, 0, bufferSize / 2, bufferSize / 2, 1, &syncPoints[0], &syncPoints[1], nullptr));
+    EXPECT_NE(syncPoints[0], syncPoints[1]);
+    EXPECT_EQ(CL_SUCCESS, clCommandBarrierWithWaitListKHR(commandBuffer, nullptr, 2, syncPoints, nullptr, nullptr));
+
+    auto clCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    EXPECT_EQ(3u, clCommandBuffer->getNumCommands());
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenKernelWhenRecordingNDRangeCommandThenKernelIsValidatedAtRecordTime) {
+    size_t gws[] = {1, 1, 1};
+    cl_ndrange_kernel_command_properties_khr properties[] = {1, 0, 0};
+
+    EXPECT_EQ(CL_INVALID_VALUE, clCommandNDRangeKernelKHR(commandBuffer, nullptr, properties, pMultiDeviceKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_WORK_DIMENSION, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, pMultiDeviceKernel, 4, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_GLOBAL_WORK_SIZE, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, pMultiDeviceKernel, 1, nullptr, nullptr, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_KERNEL, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, nullptr, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+
+    pKernel->isPatchedOverride = false;
+    EXPECT_EQ(CL_INVALID_KERNEL_ARGS, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, pMultiDeviceKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+
+    auto clCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    EXPECT_EQ(0u, clCommandBuffer->getNumCommands());
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenFinalizedCommandBufferWhenEnqueuedThenSuccessIsReturned) {
+    uint32_t pattern = 0u;
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, bufferSize, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(1, &queue, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clEnqueueCommandBufferKHR(1, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clEnqueueCommandBufferKHR(2, &queue, commandBuffer, 0, nullptr, nullptr));
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenQueueFromDifferentContextWhenEnqueuingCommandBufferThenIncompatibleQueueErrorIsReturned) {
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    auto otherContext = clCreateContext(nullptr, 1, &testedClDevice, nullptr, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto otherQueue = clCreateCommandQueueWithProperties(otherContext, testedClDevice, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INCOMPATIBLE_COMMAND_QUEUE_KHR, clEnqueueCommandBufferKHR(1, &otherQueue, commandBuffer, 0, nullptr, nullptr));
+
+    clReleaseCommandQueue(otherQueue);
+    clReleaseContext(otherContext);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenInvalidWorkGroupSizeWhenRecordingNDRangeCommandThenErrorIsReturnedAtRecordTime) {
+    MockKernelWithInternals mockKernel(*pDevice, pContext, true);
+    setBufferArgs(mockKernel);
+    cl_kernel kernel = mockKernel.mockMultiDeviceKernel;
+
+    size_t gws[] = {16, 1, 1};
+    size_t zeroLws[] = {0, 1, 1};
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, kernel, 1, nullptr, gws, zeroLws, 0, nullptr, nullptr, nullptr));
+
+    size_t maxWorkGroupSize = mockKernel.mockKernel->getMaxKernelWorkGroupSize();
+    size_t tooLargeGws[] = {2 * maxWorkGroupSize + 2, 1, 1};
+    size_t tooLargeLws[] = {maxWorkGroupSize + 1, 1, 1};
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, kernel, 1, nullptr, tooLargeGws, tooLargeLws, 0, nullptr, nullptr, nullptr));
+
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0] = 8;
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[1] = 1;
+    mockKernel.kernelInfo.kernelDescriptor.kernelAttributes.requiredWorkgroupSize[2] = 1;
+    size_t lws[] = {4, 1, 1};
+    EXPECT_EQ(CL_INVALID_WORK_GROUP_SIZE, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, kernel, 1, nullptr, gws, lws, 0, nullptr, nullptr, nullptr));
+
+    auto clCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    EXPECT_EQ(0u, clCommandBuffer->getNumCommands());
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenKernelWithBufferArgumentsWhenRecordingThenBuffersAreKeptAliveUntilCommandBufferIsReleased) {
+    MockKernelWithInternals mockKernel(*pDevice, pContext, true);
+    setBufferArgs(mockKernel);
+
+    auto pBuffer = castToObject<Buffer>(buffer);
+    auto refInternalCount = pBuffer->getRefInternalCount();
+
+    auto recordingCommandBuffer = clCreateCommandBufferKHR(1, &queue, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    size_t gws[] = {16, 1, 1};
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelKHR(recordingCommandBuffer, nullptr, nullptr, mockKernel.mockMultiDeviceKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(refInternalCount + 2, pBuffer->getRefInternalCount());
+
+    clReleaseCommandBufferKHR(recordingCommandBuffer);
+    EXPECT_EQ(refInternalCount, pBuffer->getRefInternalCount());
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenConsecutiveKernelCommandsWhenEnqueuingCommandBufferThenKernelsAreSubmittedAsSingleBatch) {
+    MockKernelWithInternals mockKernel(*pDevice, pContext, true);
+    setBufferArgs(mockKernel);
+    cl_kernel kernel = mockKernel.mockMultiDeviceKernel;
+
+    size_t gws[] = {16, 1, 1};
+    uint32_t pattern = 0u;
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, kernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, kernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clCommandFillBufferKHR(commandBuffer, nullptr, buffer, &pattern, sizeof(pattern), 0, bufferSize, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    auto clCommandBuffer = castToObject<ClCommandBuffer>(commandBuffer);
+    EXPECT_EQ(3u, clCommandBuffer->getNumCommands());
+    EXPECT_EQ(2u, clCommandBuffer->getNumSubmissions());
+
+    EXPECT_EQ(CL_SUCCESS, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 0, nullptr, nullptr));
+    EXPECT_EQ(1u, pCommandQueue->enqueueKernelBatchCalled);
+    EXPECT_EQ(2u, pCommandQueue->enqueueKernelBatchDispatchCount);
+}
+
+TEST_F(ClCommandBufferKhrTests, GivenWaitListEventFromDifferentContextWhenEnqueuingCommandBufferThenNothingIsSubmitted) {
+    MockKernelWithInternals mockKernel(*pDevice, pContext, true);
+    setBufferArgs(mockKernel);
+
+    size_t gws[] = {16, 1, 1};
+    EXPECT_EQ(CL_SUCCESS, clCommandNDRangeKernelKHR(commandBuffer, nullptr, nullptr, mockKernel.mockMultiDeviceKernel, 1, nullptr, gws, nullptr, 0, nullptr, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, clFinalizeCommandBufferKHR(commandBuffer));
+
+    auto otherContext = clCreateContext(nullptr, 1, &testedClDevice, nullptr, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto userEvent = clCreateUserEvent(otherContext, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(CL_INVALID_CONTEXT, clEnqueueCommandBufferKHR(0, nullptr, commandBuffer, 1, &userEvent, nullptr));
+    EXPECT_EQ(0u, pCommandQueue->enqueueKernelBatchCalled);
+
+    clReleaseEvent(userEvent);
+    clReleaseContext(otherContext);
+}
+
+} // namespace ULT
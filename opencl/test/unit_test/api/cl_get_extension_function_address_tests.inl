@@ -192,4 +192,22 @@ TEST_F(ClGetExtensionFunctionAddressTests, GivenCSlSetProgramSpecializationConst
     auto retVal = clGetExtensionFunctionAddress("clSetProgramSpecializationConstant");
     EXPECT_EQ(retVal, reinterpret_cast<void *>(clSetProgramSpecializationConstant));
 }
+
+TEST_F(ClGetExtensionFunctionAddressTests, GivenCommandBufferFunctionsWhenGettingExtensionFunctionThenCorrectAddressesAreReturned) {
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCreateCommandBufferKHR"), reinterpret_cast<void *>(clCreateCommandBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clFinalizeCommandBufferKHR"), reinterpret_cast<void *>(clFinalizeCommandBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clRetainCommandBufferKHR"), reinterpret_cast<void *>(clRetainCommandBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clReleaseCommandBufferKHR"), reinterpret_cast<void *>(clReleaseCommandBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clEnqueueCommandBufferKHR"), reinterpret_cast<void *>(clEnqueueCommandBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandBarrierWithWaitListKHR"), reinterpret_cast<void *>(clCommandBarrierWithWaitListKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandCopyBufferKHR"), reinterpret_cast<void *>(clCommandCopyBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandCopyBufferRectKHR"), reinterpret_cast<void *>(clCommandCopyBufferRectKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandCopyBufferToImageKHR"), reinterpret_cast<void *>(clCommandCopyBufferToImageKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandCopyImageKHR"), reinterpret_cast<void *>(clCommandCopyImageKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandCopyImageToBufferKHR"), reinterpret_cast<void *>(clCommandCopyImageToBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandFillBufferKHR"), reinterpret_cast<void *>(clCommandFillBufferKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandFillImageKHR"), reinterpret_cast<void *>(clCommandFillImageKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clCommandNDRangeKernelKHR"), reinterpret_cast<void *>(clCommandNDRangeKernelKHR));
+    EXPECT_EQ(clGetExtensionFunctionAddress("clGetCommandBufferInfoKHR"), reinterpret_cast<void *>(clGetCommandBufferInfoKHR));
+}
 } // namespace ULT
@@ -86,6 +86,25 @@ TEST(CompilerCache, GivenAllEnvVarWhenProperlySetThenProperConfigIsReturned) {
     EXPECT_EQ(cacheConfig.cacheDir, "ult/directory/");
 }
 
+TEST(CompilerCache, GivenIndexedPackEnvSetWhenGetCompilerCacheConfigThenIndexedPackFormatIsReturned) {
+    std::unordered_map<std::string, std::string> mockableEnvs;
+    mockableEnvs["NEO_CACHE_PERSISTENT"] = "1";
+    mockableEnvs["NEO_CACHE_DIR"] = "ult/directory/";
+    mockableEnvs["NEO_CACHE_INDEXED_PACK"] = "1";
+
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&NEO::IoFunctions::mockableEnvValues, &mockableEnvs);
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPathExists)> pathExistsBackup(&NEO::SysCalls::sysCallsPathExists, AllVariablesCorrectlySet::pathExistsMock);
+
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+
+    EXPECT_TRUE(cacheConfig.enabled);
+    EXPECT_EQ(CompilerCacheFormat::indexedPack, cacheConfig.format);
+
+    mockableEnvs.erase("NEO_CACHE_INDEXED_PACK");
+    cacheConfig = getDefaultCompilerCacheConfig();
+    EXPECT_EQ(CompilerCacheFormat::filePerBinary, cacheConfig.format);
+}
+
 namespace NonExistingPathIsSet {
 bool pathExistsMock(const std::string &path) {
     return false;
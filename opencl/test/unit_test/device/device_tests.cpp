@@ -668,6 +668,57 @@ TEST(DeviceGetEngineTest, givenDeferredContextInitializationDisabledWhenCreating
     }
 }
 
+TEST(DeviceGetEngineTest, givenDeferredContextInitializationEnabledWhenCreatingEnginesThenEngineAllocationsAreCreatedOnFirstUseOfEngine) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    const bool preemptionAllocationRequired = device->getPreemptionMode() == PreemptionMode::MidThread;
+    const bool fenceAllocationRequired = device->getGfxCoreHelper().isFenceAllocationRequired(device->getHardwareInfo());
+    for (const EngineControl &engine : device->getAllEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        EXPECT_NE(nullptr, csr->getTagAllocation());
+        if (engine.osContext->isInitialized()) {
+            EXPECT_FALSE(csr->areEngineAllocationsDeferred());
+            continue;
+        }
+
+        EXPECT_TRUE(csr->areEngineAllocationsDeferred());
+        EXPECT_EQ(nullptr, csr->getGlobalFenceAllocation());
+        EXPECT_EQ(nullptr, csr->getPreemptionAllocation());
+
+        EXPECT_TRUE(csr->initializeResources());
+        EXPECT_FALSE(csr->areEngineAllocationsDeferred());
+        EXPECT_EQ(fenceAllocationRequired, nullptr != csr->getGlobalFenceAllocation());
+        EXPECT_EQ(preemptionAllocationRequired, nullptr != csr->getPreemptionAllocation());
+    }
+}
+
+TEST(DeviceGetEngineTest, givenDeferredContextInitializationDisabledWhenCreatingEnginesThenEngineAllocationsAreNotDeferred) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(0);
+
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    const bool preemptionAllocationRequired = device->getPreemptionMode() == PreemptionMode::MidThread;
+    for (const EngineControl &engine : device->getAllEngines()) {
+        EXPECT_FALSE(engine.commandStreamReceiver->areEngineAllocationsDeferred());
+        EXPECT_EQ(preemptionAllocationRequired, nullptr != engine.commandStreamReceiver->getPreemptionAllocation());
+    }
+}
+
+TEST(DeviceGetEngineTest, givenPrintOsContextInitializationsSetWhenCreatingDeviceThenSizeOfDeferredEngineAllocationsIsPrinted) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+    DebugManager.flags.PrintOsContextInitializations.set(1);
+
+    testing::internal::CaptureStdout();
+    auto device = std::unique_ptr<Device>(MockDevice::createWithNewExecutionEnvironment<Device>(nullptr));
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("Deferred initialization of "));
+    EXPECT_NE(std::string::npos, output.find(" bytes of engine allocations not created"));
+}
+
 TEST(DeviceGetEngineTest, givenNonHwCsrModeWhenGetEngineThenDefaultEngineIsReturned) {
     DebugManagerStateRestore dbgRestorer;
     DebugManager.flags.SetCommandStreamReceiver.set(CommandStreamReceiverType::CSR_AUB);
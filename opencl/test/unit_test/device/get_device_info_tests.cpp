@@ -617,6 +617,19 @@ TEST(GetDeviceInfo, WhenQueryingDeviceEnqueueCapabilitiesThenFalseIsReturned) {
     EXPECT_FALSE(deviceEnqueueCapabilities);
 }
 
+TEST(GetDeviceInfo, WhenQueryingCommandBufferCapabilitiesThenNoOptionalCapabilitiesAreReported) {
+    UltClDeviceFactory deviceFactory{1, 0};
+
+    for (auto paramName : {CL_DEVICE_COMMAND_BUFFER_CAPABILITIES_KHR, CL_DEVICE_COMMAND_BUFFER_REQUIRED_QUEUE_PROPERTIES_KHR}) {
+        cl_bitfield value = 1u;
+        size_t paramRetSize = 0;
+        const auto retVal = deviceFactory.rootDevices[0]->getDeviceInfo(paramName, sizeof(value), &value, &paramRetSize);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(sizeof(cl_bitfield), paramRetSize);
+        EXPECT_EQ(0u, value);
+    }
+}
+
 TEST(GetDeviceInfo, WhenQueryingPipesSupportThenProperValueIsReturned) {
     UltClDeviceFactory deviceFactory{1, 0};
 
@@ -137,6 +137,12 @@ class MockCommandQueue : public CommandQueue {
                          const size_t *globalWorkSize, const size_t *localWorkSize,
                          cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override { return CL_SUCCESS; }
 
+    cl_int enqueueKernelBatch(MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event) override {
+        enqueueKernelBatchCalled++;
+        enqueueKernelBatchDispatchCount = multiDispatchInfo.size();
+        return CL_SUCCESS;
+    }
+
     cl_int enqueueBarrierWithWaitList(cl_uint numEventsInWaitList, const cl_event *eventWaitList,
                                       cl_event *event) override { return CL_SUCCESS; }
 
@@ -238,6 +244,8 @@ class MockCommandQueue : public CommandQueue {
     bool waitForTimestampsCalled = false;
     cl_int writeBufferRetValue = CL_SUCCESS;
     uint32_t isCompletedCalled = 0;
+    uint32_t enqueueKernelBatchCalled = 0;
+    size_t enqueueKernelBatchDispatchCount = 0;
     uint32_t writeBufferCounter = 0;
     bool writeBufferBlocking = false;
     size_t writeBufferOffset = 0;
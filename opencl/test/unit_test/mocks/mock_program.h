@@ -46,6 +46,7 @@ class MockProgram : public Program {
   public:
     using Program::allowNonUniform;
     using Program::areSpecializationConstantsInitialized;
+    using Program::asyncBuild;
     using Program::buildInfos;
     using Program::containsVmeUsage;
     using Program::context;
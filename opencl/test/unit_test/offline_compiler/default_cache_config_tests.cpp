@@ -1,16 +1,84 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/test.h"
 
+#include <string>
+
 TEST(CompilerCache, GivenDefaultCacheConfigThenValuesAreProperlyPopulated) {
     auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
     EXPECT_STREQ("ocloc_cache", cacheConfig.cacheDir.c_str());
     EXPECT_STREQ(".ocloc_cache", cacheConfig.cacheFileExtension.c_str());
     EXPECT_TRUE(cacheConfig.enabled);
 }
+
+TEST(CompilerCache, GivenPersistentRuntimeCacheDirWhenGettingDefaultCacheConfigThenRuntimeCacheDirAndExtensionAreUsed) {
+    VariableBackup<decltype(NEO::IoFunctions::getenvPtr)> getenvBackup(&NEO::IoFunctions::getenvPtr, [](const char *name) noexcept -> char * {
+        static char persistent[] = "1";
+        static char cacheDir[] = ".";
+        if (std::string(name) == "NEO_CACHE_PERSISTENT") {
+            return persistent;
+        }
+        if (std::string(name) == "NEO_CACHE_DIR") {
+            return cacheDir;
+        }
+        return nullptr;
+    });
+
+    auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
+    EXPECT_STREQ(".", cacheConfig.cacheDir.c_str());
+    EXPECT_STREQ(".cl_cache", cacheConfig.cacheFileExtension.c_str());
+    EXPECT_TRUE(cacheConfig.enabled);
+}
+
+TEST(CompilerCache, GivenNonExistingRuntimeCacheDirWhenGettingDefaultCacheConfigThenOclocCacheIsUsed) {
+    VariableBackup<decltype(NEO::IoFunctions::getenvPtr)> getenvBackup(&NEO::IoFunctions::getenvPtr, [](const char *name) noexcept -> char * {
+        static char persistent[] = "1";
+        static char cacheDir[] = "non_existing_cache_dir";
+        if (std::string(name) == "NEO_CACHE_PERSISTENT") {
+            return persistent;
+        }
+        if (std::string(name) == "NEO_CACHE_DIR") {
+            return cacheDir;
+        }
+        return nullptr;
+    });
+
+    auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
+    EXPECT_STREQ("ocloc_cache", cacheConfig.cacheDir.c_str());
+    EXPECT_STREQ(".ocloc_cache", cacheConfig.cacheFileExtension.c_str());
+}
+
+TEST(CompilerCache, GivenPersistentRuntimeCacheWithIndexedPackAndSizeLimitWhenGettingDefaultCacheConfigThenRuntimeFormatAndLimitAreUsed) {
+    VariableBackup<decltype(NEO::IoFunctions::getenvPtr)> getenvBackup(&NEO::IoFunctions::getenvPtr, [](const char *name) noexcept -> char * {
+        static char persistent[] = "1";
+        static char cacheDir[] = ".";
+        static char indexedPack[] = "1";
+        static char maxSize[] = "4096";
+        if (std::string(name) == "NEO_CACHE_PERSISTENT") {
+            return persistent;
+        }
+        if (std::string(name) == "NEO_CACHE_DIR") {
+            return cacheDir;
+        }
+        if (std::string(name) == "NEO_CACHE_INDEXED_PACK") {
+            return indexedPack;
+        }
+        if (std::string(name) == "NEO_CACHE_MAX_SIZE") {
+            return maxSize;
+        }
+        return nullptr;
+    });
+
+    auto cacheConfig = NEO::getDefaultCompilerCacheConfig();
+    EXPECT_TRUE(cacheConfig.sharedWithRuntime);
+    EXPECT_EQ(NEO::CompilerCacheFormat::indexedPack, cacheConfig.format);
+    EXPECT_EQ(4096u, cacheConfig.cacheSize);
+}
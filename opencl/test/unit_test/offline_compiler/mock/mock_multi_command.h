@@ -11,6 +11,8 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
+#include <map>
 #include <optional>
 #include <string>
 
@@ -20,10 +22,14 @@ class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
     using MultiCommand::lines;
+    using MultiCommand::numJobs;
+    using MultiCommand::outputFile;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
+    using MultiCommand::SingleBuild;
 
     using MultiCommand::addAdditionalOptionsToSingleCommandLine;
+    using MultiCommand::getArgHelper;
     using MultiCommand::initialize;
     using MultiCommand::printHelp;
     using MultiCommand::runBuilds;
@@ -39,19 +45,22 @@ class MockMultiCommand : public MultiCommand {
 
     ~MockMultiCommand() override = default;
 
-    int singleBuild(const std::vector<std::string> &args) override {
+    int singleBuild(SingleBuild &build) override {
         ++singleBuildCalledCount;
 
         if (callBaseSingleBuild) {
-            return MultiCommand::singleBuild(args);
+            return MultiCommand::singleBuild(build);
         }
 
-        return OCLOC_SUCCESS;
+        build.outputFileListEntry = build.outFileName;
+        auto retValIt = singleBuildRetValues.find(build.outFileName);
+        return retValIt != singleBuildRetValues.end() ? retValIt->second : OCLOC_SUCCESS;
     }
 
     std::map<std::string, std::string> filesMap{};
+    std::map<std::string, int> singleBuildRetValues{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
-    int singleBuildCalledCount{0};
+    std::atomic<int> singleBuildCalledCount{0};
     bool callBaseSingleBuild{true};
 };
 
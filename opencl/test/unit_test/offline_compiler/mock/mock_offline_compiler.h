@@ -21,6 +21,7 @@ class MockOclocIgcFacade;
 class MockOfflineCompiler : public OfflineCompiler {
   public:
     using OfflineCompiler::allowCaching;
+    using OfflineCompiler::cacheSharedWithRuntime;
     using OfflineCompiler::appendExtraInternalOptions;
     using OfflineCompiler::argHelper;
     using OfflineCompiler::binaryOutputFile;
@@ -65,9 +66,11 @@ class MockOfflineCompiler : public OfflineCompiler {
     using OfflineCompiler::parseCommandLine;
     using OfflineCompiler::parseDebugSettings;
     using OfflineCompiler::perDeviceOptions;
+    using OfflineCompiler::releaseHelper;
     using OfflineCompiler::revisionId;
     using OfflineCompiler::setStatelessToStatefulBufferOffsetFlag;
     using OfflineCompiler::sourceCode;
+    using OfflineCompiler::sourceGenHash;
     using OfflineCompiler::storeBinary;
     using OfflineCompiler::updateBuildLog;
     using OfflineCompiler::useGenFile;
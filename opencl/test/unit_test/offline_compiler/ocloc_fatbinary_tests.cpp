@@ -19,6 +19,8 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/product_config_helper.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/thread_pool.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 
 #include "environment.h"
@@ -1507,6 +1509,84 @@ TEST_F(OclocFatBinaryTest, givenSpirvInputWhenFatBinaryIsRequestedThenArchiveCon
     NEO::setIgcDebugVars(gEnvironment->igcDebugVars);
 }
 
+TEST_F(OclocFatBinaryTest, givenBuildThreadPoolSizeWhenGettingNumberOfThreadsForFatBinaryBuildThenItIsLimitedByNumberOfTargetsAndTargetsAreBuiltSequentiallyByDefault) {
+    DebugManagerStateRestore restorer;
+
+    DebugManager.flags.BuildThreadPoolSize.set(0);
+    EXPECT_EQ(0u, getNumThreadsForFatBinaryBuild(4u));
+
+    DebugManager.flags.BuildThreadPoolSize.set(8);
+    EXPECT_EQ(4u, getNumThreadsForFatBinaryBuild(4u));
+    EXPECT_EQ(8u, getNumThreadsForFatBinaryBuild(10u));
+
+    DebugManager.flags.BuildThreadPoolSize.set(-1);
+    EXPECT_EQ(1u, getNumThreadsForFatBinaryBuild(10u));
+}
+
+TEST_F(OclocFatBinaryTest, givenMultipleTargetsWhenBuildingFatBinaryInParallelThenArchiveAndMessagesAreSameAsInSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    DebugManagerStateRestore restorer;
+    std::string archives[2];
+    std::string logs[2];
+    for (auto numThreads : {0, 2}) {
+        DebugManager.flags.BuildThreadPoolSize.set(numThreads);
+        MockOclocArgHelper argHelper{mockArgHelperFilesMap};
+        argHelper.interceptOutput = true;
+        argHelper.getPrinterRef().setSuppressMessages(true);
+
+        const auto buildResult = buildFatBinary(args, &argHelper);
+        ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+        ASSERT_EQ(1u, argHelper.interceptedFiles.count(outputArchiveName));
+
+        archives[numThreads ? 1 : 0] = argHelper.interceptedFiles[outputArchiveName];
+        logs[numThreads ? 1 : 0] = argHelper.messagePrinter.getLog().str();
+    }
+
+    EXPECT_FALSE(archives[0].empty());
+    EXPECT_EQ(archives[0], archives[1]);
+    EXPECT_EQ(logs[0], logs[1]);
+}
+
+TEST_F(OclocFatBinaryTest, givenFailingTargetWhenBuildingFatBinaryInParallelThenErrorIsReturnedAndNoArchiveIsSaved) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        "non_existing_file.cl",
+        "-device",
+        devices};
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BuildThreadPoolSize.set(2);
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    EXPECT_NE(OCLOC_SUCCESS, buildResult);
+    EXPECT_EQ(0u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    const auto log = mockArgHelper.messagePrinter.getLog().str();
+    EXPECT_NE(std::string::npos, log.find("Error! Couldn't create OfflineCompiler. Exiting.\n"));
+}
+
 TEST_F(OclocFatBinaryTest, givenSpirvInputWhenFatBinaryIsRequestedThenArchiveContainsGenericIrFileWithSpirvContent) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -14,10 +14,13 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
+#include "shared/source/helpers/compiler_options_parser.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/product_config_helper.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/thread_pool.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/helpers/variable_backup.h"
@@ -121,6 +124,38 @@ TEST_F(MultiCommandTests, WhenBuildingMultiCommandThenSuccessIsReturned) {
     deleteFileWithArgs();
 }
 
+TEST_F(MultiCommandTests, GivenMultipleJobsWhenBuildingMultiCommandThenGuardedBuildsRunInParallelAndSucceed) {
+    nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
+    std::vector<std::string> argv = {
+        "ocloc",
+        "multi",
+        nameOfFileWithArgs.c_str(),
+        "-q",
+        "-j",
+        "2"};
+
+    std::vector<std::string> singleArgs = {
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    int numOfBuild = 4;
+    createFileWithArgs(singleArgs, numOfBuild);
+
+    auto pMultiCommand = std::unique_ptr<MultiCommand>(MultiCommand::create(argv, retVal, oclocArgHelperWithoutInput.get()));
+
+    ASSERT_NE(nullptr, pMultiCommand);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    for (int i = 0; i < numOfBuild; i++) {
+        std::string outFileName = pMultiCommand->outDirForBuilds + "/build_no_" + std::to_string(i + 1);
+        EXPECT_TRUE(compilerOutputExists(outFileName, "bin"));
+    }
+
+    deleteFileWithArgs();
+}
+
 TEST_F(MultiCommandTests, GivenOutputFileWhenBuildingMultiCommandThenSuccessIsReturned) {
     nameOfFileWithArgs = "ImAMulitiComandMinimalGoodFile.txt";
     std::vector<std::string> argv = {
@@ -393,6 +428,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <number_of_jobs>           Number of builds executed in parallel.
+                                0 uses number of hardware threads.
+                                Messages and results are reported in order
+                                of commands in <file_name>. Default: 1.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -526,6 +566,76 @@ TEST(MultiCommandWhiteboxTest, GivenInvalidArgsWhenInitializingThenErrorIsReturn
     EXPECT_NE(std::string::npos, errorPosition);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenNumberOfJobsArgWhenInitializingThenNumberOfJobsIsSet) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.uniqueHelper->callBaseFileExists = false;
+    mockMultiCommand.uniqueHelper->callBaseReadFileToVectorOfStrings = false;
+    mockMultiCommand.uniqueHelper->shouldReturnEmptyVectorOfStrings = true;
+    mockMultiCommand.filesMap["commands.txt"] = "";
+    EXPECT_EQ(1u, mockMultiCommand.numJobs);
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.initialize({"ocloc", "multi", "commands.txt", "-j", "4"});
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(4u, mockMultiCommand.numJobs);
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.initialize({"ocloc", "multi", "commands.txt", "-j", "0"});
+    testing::internal::GetCapturedStdout();
+    EXPECT_EQ(ThreadPool::getDefaultNumThreads(), mockMultiCommand.numJobs);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenInvalidNumberOfJobsWhenInitializingThenErrorIsReturned) {
+    for (const auto &invalidValue : {"", "-2", "four", "12345678901"}) {
+        MockMultiCommand mockMultiCommand{};
+
+        ::testing::internal::CaptureStdout();
+        const auto result = mockMultiCommand.initialize({"ocloc", "multi", "commands.txt", "-j", invalidValue});
+        const auto output = testing::internal::GetCapturedStdout();
+
+        EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+        const auto expectedError = std::string("Invalid number of jobs: ") + invalidValue + "\n";
+        EXPECT_NE(std::string::npos, output.find(expectedError));
+        EXPECT_EQ(1u, mockMultiCommand.numJobs);
+    }
+}
+
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsWhenRunningBuildsThenResultsAndLogsAreReportedInOrderOfCommands) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.numJobs = 4u;
+    mockMultiCommand.singleBuildRetValues["build_no_2"] = OCLOC_INVALID_FILE;
+    mockMultiCommand.singleBuildRetValues["build_no_5"] = OCLOC_BUILD_PROGRAM_FAILURE;
+
+    const std::string validLine{"-file test_files/copybuffer.cl -out_dir SomeOutputDirectory -device " + gEnvironment->devicePrefix};
+    for (int i = 0; i < 6; ++i) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+
+    ::testing::internal::CaptureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ(6, mockMultiCommand.singleBuildCalledCount);
+
+    const std::vector<int> expectedRetValues{OCLOC_SUCCESS, OCLOC_INVALID_FILE, OCLOC_SUCCESS, OCLOC_SUCCESS, OCLOC_BUILD_PROGRAM_FAILURE, OCLOC_SUCCESS, OCLOC_INVALID_FILE};
+    EXPECT_EQ(expectedRetValues, mockMultiCommand.retValues);
+
+    const auto expectedOutputFileList{"build_no_1\nbuild_no_2\nbuild_no_3\nbuild_no_4\nbuild_no_5\nbuild_no_6\n"};
+    EXPECT_EQ(expectedOutputFileList, mockMultiCommand.outputFile.str());
+
+    const auto expectedOutput{"One of the quotes is open in build number 7\n"
+                              "Command number 1: \n"
+                              "Command number 2: \n"
+                              "Command number 3: \n"
+                              "Command number 4: \n"
+                              "Command number 5: \n"
+                              "Command number 6: \n"};
+    EXPECT_EQ(expectedOutput, output);
+}
+
 using MockOfflineCompilerTests = ::testing::Test;
 TEST_F(MockOfflineCompilerTests, givenProductConfigValueWhenInitHwInfoThenCorrectValueIsSet) {
     MockOfflineCompiler mockOfflineCompiler;
@@ -2560,6 +2670,139 @@ TEST(OfflineCompilerTest, givenAllowCachingWhenBuildSourceCodeThenGenBinaryIsCac
     EXPECT_EQ(expectedCacheBinaryGenHash, givenCacheBinaryGenHash);
 }
 
+TEST(OfflineCompilerTest, givenAllowCachingWhenBuildSourceCodeThenGenBinaryIsAlsoCachedUsingRuntimeKeyOfSourceCode) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-allow_caching"};
+
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    ASSERT_NE(nullptr, mockOfflineCompiler);
+    auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto cacheMock = new CompilerCacheMock();
+    mockOfflineCompiler->cache.reset(cacheMock);
+    retVal = mockOfflineCompiler->buildSourceCode();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    // same key as used by runtime when building program from source
+    const auto sourceCodeHash = cacheMock->getCachedFileName(mockOfflineCompiler->getHardwareInfo(),
+                                                             mockOfflineCompiler->sourceCode,
+                                                             mockOfflineCompiler->options,
+                                                             mockOfflineCompiler->internalOptions,
+                                                             ArrayRef<const char>(), ArrayRef<const char>(),
+                                                             std::string(mockOfflineCompiler->igcFacade->getIgcRevision()),
+                                                             mockOfflineCompiler->igcFacade->getIgcLibSize(),
+                                                             mockOfflineCompiler->igcFacade->getIgcLibMTime());
+
+    // 0 - buildIrBinary   > irBinary
+    // 1 - buildSourceCode > irBinary
+    // 2 - buildSourceCode > genBinary
+    // 3 - buildSourceCode > debugDataBinary
+    // 4 - buildSourceCode > genBinary with key of source code
+    ASSERT_EQ(5u, cacheMock->cacheBinaryKernelFileHashes.size());
+    EXPECT_EQ(sourceCodeHash, mockOfflineCompiler->sourceGenHash);
+    EXPECT_EQ(sourceCodeHash, cacheMock->cacheBinaryKernelFileHashes[4]);
+    EXPECT_NE(sourceCodeHash, cacheMock->cacheBinaryKernelFileHashes[0]);
+    EXPECT_NE(sourceCodeHash, cacheMock->cacheBinaryKernelFileHashes[1]);
+}
+
+TEST(OfflineCompilerTest, givenAllowCachingAndSourceWithIncludeWhenBuildSourceCodeThenGenBinaryIsNotCachedUsingKeyOfSourceCode) {
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-allow_caching"};
+
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    ASSERT_NE(nullptr, mockOfflineCompiler);
+    auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    mockOfflineCompiler->sourceCode = "#include \"header.h\"\n" + mockOfflineCompiler->sourceCode;
+
+    auto cacheMock = new CompilerCacheMock();
+    mockOfflineCompiler->cache.reset(cacheMock);
+    retVal = mockOfflineCompiler->buildSourceCode();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_TRUE(mockOfflineCompiler->sourceGenHash.empty());
+    EXPECT_EQ(4u, cacheMock->cacheBinaryKernelFileHashes.size());
+}
+
+TEST(OfflineCompilerTest, givenCacheSharedWithRuntimeWhenBuildSourceCodeThenGenBinaryIsCachedUsingKeyComputedByRuntime) {
+    VariableBackup<decltype(NEO::IoFunctions::getenvPtr)> getenvBackup(&NEO::IoFunctions::getenvPtr, [](const char *name) noexcept -> char * {
+        static char persistent[] = "1";
+        static char cacheDir[] = ".";
+        if (std::string(name) == "NEO_CACHE_PERSISTENT") {
+            return persistent;
+        }
+        if (std::string(name) == "NEO_CACHE_DIR") {
+            return cacheDir;
+        }
+        return nullptr;
+    });
+
+    std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-allow_caching"};
+
+    auto mockOfflineCompiler = std::unique_ptr<MockOfflineCompiler>(new MockOfflineCompiler());
+    ASSERT_NE(nullptr, mockOfflineCompiler);
+    auto retVal = mockOfflineCompiler->initialize(argv.size(), argv);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(mockOfflineCompiler->cacheSharedWithRuntime);
+
+    // internal options as composed by Program::getInternalOptions and Program::build for the same device
+    const auto &hwInfo = mockOfflineCompiler->getHardwareInfo();
+    const auto &compilerProductHelper = *mockOfflineCompiler->compilerProductHelper;
+    ProgramInternalOptionsArgs args;
+    args.clVersion = hwInfo.capabilityTable.clVersionSupport;
+    args.greaterThan4gbBuffersRequired = compilerProductHelper.isForceToStatelessRequired();
+    args.statelessToStatefulWithOffsetSupported = compilerProductHelper.isStatelessToStatefulBufferOffsetSupported();
+    args.forceEmuInt32DivRemSP = compilerProductHelper.isForceEmuInt32DivRemSPRequired();
+    args.supportsImages = hwInfo.capabilityTable.supportsImages;
+    auto runtimeInternalOptions = getProgramInternalOptions(args, compilerProductHelper);
+    CompilerOptions::applyAdditionalInternalOptions(runtimeInternalOptions);
+    OpenClCFeaturesContainer openclCFeatures;
+    if (requiresOpenClCFeatures(mockOfflineCompiler->options)) {
+        getOpenclCFeaturesList(hwInfo, openclCFeatures, compilerProductHelper);
+    }
+    const auto deviceExtensions = compilerProductHelper.getDeviceExtensions(hwInfo, mockOfflineCompiler->releaseHelper.get());
+    appendProgramBuildInternalOptions(runtimeInternalOptions, mockOfflineCompiler->options, convertEnabledExtensionsToCompilerInternalOptions(deviceExtensions.c_str(), openclCFeatures), false);
+
+    EXPECT_EQ(runtimeInternalOptions, mockOfflineCompiler->internalOptions);
+    EXPECT_TRUE(hasSubstr(mockOfflineCompiler->internalOptions, CompilerOptions::preserveVec3Type.str()));
+    EXPECT_FALSE(hasSubstr(mockOfflineCompiler->internalOptions, CompilerOptions::allowZebin.str()));
+
+    auto cacheMock = new CompilerCacheMock();
+    mockOfflineCompiler->cache.reset(cacheMock);
+    retVal = mockOfflineCompiler->buildSourceCode();
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    // same key as CompilerInterface::build computes in direct caching mode
+    const auto runtimeKey = cacheMock->getCachedFileName(hwInfo,
+                                                         mockOfflineCompiler->sourceCode,
+                                                         mockOfflineCompiler->options,
+                                                         runtimeInternalOptions,
+                                                         ArrayRef<const char>(), ArrayRef<const char>(),
+                                                         std::string(mockOfflineCompiler->igcFacade->getIgcRevision()),
+                                                         mockOfflineCompiler->igcFacade->getIgcLibSize(),
+                                                         mockOfflineCompiler->igcFacade->getIgcLibMTime());
+    EXPECT_EQ(runtimeKey, mockOfflineCompiler->sourceGenHash);
+    ASSERT_EQ(5u, cacheMock->cacheBinaryKernelFileHashes.size());
+    EXPECT_EQ(runtimeKey, cacheMock->cacheBinaryKernelFileHashes[4]);
+}
+
 TEST(OfflineCompilerTest, WhenParsingCmdLineThenOptionsAreReadCorrectly) {
     std::vector<std::string> argv = {
         "ocloc",
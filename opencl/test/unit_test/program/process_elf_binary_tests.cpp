@@ -61,7 +61,8 @@ TEST_F(ProcessElfBinaryTests, GivenValidBinaryWhenCreatingProgramFromBinaryThenS
     cl_int retVal = program->createProgramFromBinary(pBinary.data(), binarySize, *device);
 
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_EQ(0, memcmp(pBinary.data(), program->buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize));
+    ASSERT_EQ(binarySize, program->getPackedDeviceBinary(rootDeviceIndex).size());
+    EXPECT_EQ(0, memcmp(pBinary.data(), program->getPackedDeviceBinary(rootDeviceIndex).begin(), binarySize));
 }
 
 TEST_F(ProcessElfBinaryTests, GivenValidSpirBinaryWhenCreatingProgramFromBinaryThenSuccessIsReturned) {
@@ -132,18 +133,17 @@ TEST_P(ProcessElfBinaryTestsWithBinaryType, GivenBinaryTypeWhenResolveProgramThe
 
     cl_int retVal = program->createProgramFromBinary(pBinary.data(), binarySize, *device);
     auto options = program->options;
-    auto genBinary = makeCopy(program->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get(), program->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
-    auto genBinarySize = program->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize;
+    auto genBinary = makeCopy(program->getUnpackedDeviceBinary(rootDeviceIndex).begin(), program->getUnpackedDeviceBinary(rootDeviceIndex).size());
+    auto genBinarySize = program->getUnpackedDeviceBinary(rootDeviceIndex).size();
     auto irBinary = makeCopy(program->irBinary.get(), program->irBinarySize);
     auto irBinarySize = program->irBinarySize;
 
     EXPECT_EQ(CL_SUCCESS, retVal);
-    ASSERT_EQ(binarySize, program->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
-    EXPECT_EQ(0, memcmp(pBinary.data(), program->buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize));
+    ASSERT_EQ(binarySize, program->getPackedDeviceBinary(rootDeviceIndex).size());
+    EXPECT_EQ(0, memcmp(pBinary.data(), program->getPackedDeviceBinary(rootDeviceIndex).begin(), binarySize));
 
-    // delete program's elf reference to force a resolve
-    program->buildInfos[rootDeviceIndex].packedDeviceBinary.reset();
-    program->buildInfos[rootDeviceIndex].packedDeviceBinarySize = 0U;
+    // delete program's elf reference to force a resolve, unpacked binary stays a view into the copy of elf
+    program->buildInfos[rootDeviceIndex].packedDeviceBinaryView = {};
     program->deviceBuildInfos[device.get()].programBinaryType = GetParam();
     retVal = program->packDeviceBinary(*device);
     EXPECT_EQ(CL_SUCCESS, retVal);
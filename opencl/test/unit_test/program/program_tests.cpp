@@ -9,8 +9,10 @@
 
 #include "shared/source/ail/ail_configuration.h"
 #include "shared/source/command_stream/command_stream_receiver_hw.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_warnings/compiler_warnings.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/device_binary_format/elf/elf_decoder.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
@@ -1722,6 +1724,30 @@ TEST_F(ProgramTests, GivenStatelessToStatefulIsDisabledWhenProgramIsCreatedThenG
     EXPECT_TRUE(CompilerOptions::contains(internalOptions, NEO::CompilerOptions::greaterThan4gbBuffersRequired));
 }
 
+TEST_F(ProgramTests, givenPendingAsyncBuildWhenQueryingProgramStateThenProgramIsLockedAndBuildIsReportedAsInProgress) {
+    MockProgram program(pContext, false, toClDeviceVector(*pClDevice));
+    program.deviceBuildInfos[pClDevice].buildStatus = CL_BUILD_SUCCESS;
+    EXPECT_FALSE(program.isAsyncBuildInProgress());
+    EXPECT_FALSE(program.isLocked());
+
+    std::promise<void> buildCompleted;
+    program.asyncBuild = buildCompleted.get_future().share();
+    EXPECT_TRUE(program.isAsyncBuildInProgress());
+    EXPECT_TRUE(program.isLocked());
+
+    cl_build_status buildStatus = CL_BUILD_NONE;
+    auto retVal = program.getBuildInfo(pClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_IN_PROGRESS, buildStatus);
+
+    buildCompleted.set_value();
+    EXPECT_FALSE(program.isAsyncBuildInProgress());
+    EXPECT_FALSE(program.isLocked());
+    retVal = program.getBuildInfo(pClDevice, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+}
+
 TEST_F(ProgramTests, whenGetInternalOptionsThenLSCPolicyIsSet) {
     MockProgram program(pContext, false, toClDeviceVector(*pClDevice));
     auto internalOptions = program.getInternalOptions();
@@ -2811,6 +2837,45 @@ TEST(CreateProgramFromBinaryTests, givenBinaryProgramBuiltInWhenKernelRebulildIs
     EXPECT_EQ(0U, pProgram->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
 }
 
+TEST(CreateProgramFromBinaryTests, givenFatBinaryWhenCreatingProgramFromBinaryThenOnlyMatchedDeviceBinaryIsStoredAsPackedBinary) {
+    cl_int retVal = CL_INVALID_BINARY;
+
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    PatchTokensTestData::ValidProgramWithConstantSurface otherProgramTokens;
+
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    NEO::Ar::ArEncoder encoder;
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "unk." + requiredStepping, otherProgramTokens.storage));
+    auto fatBinary = encoder.encode();
+
+    auto clDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    std::unique_ptr<MockProgram> pProgram(Program::createBuiltInFromGenBinary<MockProgram>(nullptr, toClDeviceVector(*clDevice), programTokens.storage.data(), programTokens.storage.size(), &retVal));
+    ASSERT_NE(nullptr, pProgram.get());
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto rootDeviceIndex = clDevice->getRootDeviceIndex();
+    retVal = pProgram->createProgramFromBinary(fatBinary.data(), fatBinary.size(), *clDevice);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto packedBinary = pProgram->getPackedDeviceBinary(rootDeviceIndex);
+    ASSERT_EQ(programTokens.storage.size(), packedBinary.size());
+    EXPECT_EQ(0, memcmp(programTokens.storage.data(), packedBinary.begin(), programTokens.storage.size()));
+
+    // matched member is copied once, unpacked binary is a view into it
+    auto unpackedBinary = pProgram->getUnpackedDeviceBinary(rootDeviceIndex);
+    EXPECT_EQ(nullptr, pProgram->buildInfos[rootDeviceIndex].packedDeviceBinary);
+    EXPECT_EQ(nullptr, pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary);
+    EXPECT_LE(packedBinary.begin(), unpackedBinary.begin());
+    EXPECT_GE(packedBinary.end(), unpackedBinary.end());
+
+    size_t binarySize = 0u;
+    EXPECT_EQ(CL_SUCCESS, pProgram->getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr));
+    EXPECT_EQ(programTokens.storage.size(), binarySize);
+}
+
 TEST(CreateProgramFromBinaryTests, givenBinaryProgramBuiltInWhenKernelRebulildIsForcedAndIrBinaryIsPresentThenRebuildWarningIsEnabled) {
     DebugManagerStateRestore dbgRestorer{};
     DebugManager.flags.RebuildPrecompiledKernels.set(true);
@@ -2884,10 +2949,10 @@ TEST(CreateProgramFromBinaryTests, givenBinaryProgramWhenKernelRebulildIsNotForc
     auto rootDeviceIndex = clDevice->getRootDeviceIndex();
     retVal = pProgram->createProgramFromBinary(programTokens.storage.data(), programTokens.storage.size(), *clDevice);
     EXPECT_EQ(CL_SUCCESS, retVal);
-    EXPECT_NE(nullptr, reinterpret_cast<uint8_t *>(pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinary.get()));
-    EXPECT_EQ(programTokens.storage.size(), pProgram->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
-    EXPECT_NE(nullptr, reinterpret_cast<uint8_t *>(pProgram->buildInfos[rootDeviceIndex].packedDeviceBinary.get()));
-    EXPECT_EQ(programTokens.storage.size(), pProgram->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+    EXPECT_NE(nullptr, pProgram->getUnpackedDeviceBinary(rootDeviceIndex).begin());
+    EXPECT_EQ(programTokens.storage.size(), pProgram->getUnpackedDeviceBinary(rootDeviceIndex).size());
+    EXPECT_NE(nullptr, pProgram->getPackedDeviceBinary(rootDeviceIndex).begin());
+    EXPECT_EQ(programTokens.storage.size(), pProgram->getPackedDeviceBinary(rootDeviceIndex).size());
 }
 
 struct SpecializationConstantProgramMock : public MockProgram {
@@ -3220,6 +3285,34 @@ TEST(ProgramReplaceDeviceBinary, GivenBinaryZebinThenUseAsBothPackedAndUnpackedB
     EXPECT_EQ(0, memcmp(program.buildInfos[rootDeviceIndex].unpackedDeviceBinary.get(), zebin.storage.data(), program.buildInfos[rootDeviceIndex].unpackedDeviceBinarySize));
 }
 
+TEST(ProgramSetSharedDeviceBinary, GivenSharedZebinThenItIsUsedAsBothPackedAndUnpackedBinaryWithoutCopy) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    auto sharedBinary = std::make_shared<HeapCachedBinary>(makeCopy<char>(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size()), zebin.storage.size());
+    auto sharedData = reinterpret_cast<const uint8_t *>(sharedBinary->getData().begin());
+    MockContext context;
+    auto device = context.getDevice(0);
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    MockProgram program{&context, false, toClDeviceVector(*device)};
+    program.setSharedDeviceBinary(sharedBinary, rootDeviceIndex);
+
+    EXPECT_EQ(2, sharedBinary.use_count());
+    EXPECT_EQ(nullptr, program.buildInfos[rootDeviceIndex].packedDeviceBinary);
+    EXPECT_EQ(nullptr, program.buildInfos[rootDeviceIndex].unpackedDeviceBinary);
+    EXPECT_EQ(sharedData, program.getPackedDeviceBinary(rootDeviceIndex).begin());
+    EXPECT_EQ(zebin.storage.size(), program.getPackedDeviceBinary(rootDeviceIndex).size());
+    EXPECT_EQ(sharedData, program.getUnpackedDeviceBinary(rootDeviceIndex).begin());
+    EXPECT_EQ(zebin.storage.size(), program.getUnpackedDeviceBinary(rootDeviceIndex).size());
+
+    size_t binarySize = 0u;
+    EXPECT_EQ(CL_SUCCESS, program.getInfo(CL_PROGRAM_BINARY_SIZES, sizeof(binarySize), &binarySize, nullptr));
+    EXPECT_EQ(zebin.storage.size(), binarySize);
+    EXPECT_EQ(nullptr, program.buildInfos[rootDeviceIndex].packedDeviceBinary);
+
+    program.replaceDeviceBinary(makeCopy(zebin.storage.data(), zebin.storage.size()), zebin.storage.size(), rootDeviceIndex);
+    EXPECT_EQ(1, sharedBinary.use_count());
+    EXPECT_NE(sharedData, program.getUnpackedDeviceBinary(rootDeviceIndex).begin());
+}
+
 TEST(ProgramCallbackTest, whenFunctionIsNullptrThenUserDataNeedsToBeNullptr) {
     void *userData = nullptr;
     EXPECT_TRUE(Program::isValidCallback(nullptr, nullptr));
@@ -39,7 +39,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     explicit MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
-        if (!suppressMessages) {
+        if (!suppressMessages && !captureOnly) {
             ::printf("%s", message);
         }
         ss << std::string(message);
@@ -47,7 +47,7 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
-        if (!suppressMessages) {
+        if (!suppressMessages && !captureOnly) {
             ::printf(format, args...);
         }
         ss << stringFormat(format, args...);
@@ -61,6 +61,10 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
     void setSuppressMessages(bool suppress) {
         suppressMessages = suppress;
     }
+    // Messages are only stored in log, independently of suppression requested by user
+    void setCaptureOnly(bool capture) {
+        captureOnly = capture;
+    }
 
   private:
     template <typename... Args>
@@ -77,4 +81,5 @@ class MessagePrinter : NEO::NonCopyableOrMovableClass {
 
     std::stringstream ss;
     bool suppressMessages = false;
+    bool captureOnly = false;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,41 @@
 
 #include "shared/source/compiler_interface/default_cache_config.h"
 
+#include "shared/source/helpers/constants.h"
+#include "shared/source/os_interface/sys_calls_common.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+
 namespace NEO {
 CompilerCacheConfig getDefaultCompilerCacheConfig() {
     CompilerCacheConfig ret;
     ret.cacheDir = "ocloc_cache";
     ret.cacheFileExtension = ".ocloc_cache";
+
+    // When persistent runtime cache is configured, ocloc shares its directory and file format,
+    // so binaries built offline are found by runtime and vice versa
+    const char *cachePersistent = IoFunctions::getenvPtr("NEO_CACHE_PERSISTENT");
+    const char *cacheDir = IoFunctions::getenvPtr("NEO_CACHE_DIR");
+    if (cachePersistent && std::string(cachePersistent) == "1" && cacheDir && NEO::SysCalls::pathExists(cacheDir)) {
+        ret.cacheDir = cacheDir;
+        ret.cacheFileExtension = ".cl_cache";
+        ret.sharedWithRuntime = true;
+
+        // size limit and format have to follow runtime settings, otherwise runtime would not find entries stored by ocloc
+        const char *cacheMaxSize = IoFunctions::getenvPtr("NEO_CACHE_MAX_SIZE");
+        ret.cacheSize = cacheMaxSize ? static_cast<size_t>(atoll(cacheMaxSize)) : static_cast<size_t>(MemoryConstants::gigaByte);
+        if (ret.cacheSize == 0u) {
+            ret.cacheSize = std::numeric_limits<size_t>::max();
+        }
+
+        const char *cacheIndexedPack = IoFunctions::getenvPtr("NEO_CACHE_INDEXED_PACK");
+        if (cacheIndexedPack && atoll(cacheIndexedPack) != 0) {
+            ret.format = CompilerCacheFormat::indexedPack;
+        }
+    }
     return ret;
 }
 } // namespace NEO
@@ -14,44 +14,51 @@
 #include "shared/offline_compiler/source/utilities/get_current_dir.h"
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/utilities/const_stringref.h"
+#include "shared/source/utilities/thread_pool.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+int MultiCommand::singleBuild(SingleBuild &build) {
     int retVal = OCLOC_SUCCESS;
+    auto buildArgHelper = getArgHelper(build);
+    const auto &args = build.args;
 
-    if (requestedFatBinary(args, argHelper)) {
-        retVal = buildFatBinary(args, argHelper);
+    if (requestedFatBinary(args, buildArgHelper)) {
+        retVal = buildFatBinary(args, buildArgHelper);
     } else {
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
+        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, buildArgHelper)};
         if (retVal == OCLOC_SUCCESS) {
             retVal = buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
-                argHelper->printf("%s\n", buildLog.c_str());
+                buildArgHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        build.outFileName += ".bin";
     }
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
-            argHelper->printf("Build succeeded.\n");
+            buildArgHelper->printf("Build succeeded.\n");
     } else {
-        argHelper->printf("Build failed with error code: %d\n", retVal);
+        buildArgHelper->printf("Build failed with error code: %d\n", retVal);
     }
 
     if (retVal == OCLOC_SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+        build.outputFileListEntry = getCurrentDirectoryOwn(build.outDir) + build.outFileName;
     } else {
-        outputFile << "Unsuccesful build";
+        build.outputFileListEntry = "Unsuccesful build";
     }
-    outputFile << '\n';
 
     return retVal;
 }
 
+OclocArgHelper *MultiCommand::getArgHelper(SingleBuild &build) const {
+    return build.isolatedArgHelper ? build.isolatedArgHelper.get() : argHelper;
+}
+
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
     retVal = OCLOC_SUCCESS;
     auto pMultiCommand = new MultiCommand();
@@ -109,6 +116,17 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             outputFileList = args[++argIndex];
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
+        } else if (hasMoreArgs && ConstStringRef("-j") == currArg) {
+            const auto &numJobsArg = args[++argIndex];
+            if (numJobsArg.empty() || numJobsArg.size() > 9u || numJobsArg.find_first_not_of("0123456789") != std::string::npos) {
+                argHelper->printf("Invalid number of jobs: %s\n", numJobsArg.c_str());
+                printHelp();
+                return OCLOC_INVALID_COMMAND_LINE;
+            }
+            numJobs = static_cast<uint32_t>(std::stoul(numJobsArg));
+            if (numJobs == 0u) {
+                numJobs = ThreadPool::getDefaultNumThreads();
+            }
         } else {
             argHelper->printf("Invalid option (arg %zu): %s\n", argIndex, currArg.c_str());
             printHelp();
@@ -137,22 +155,53 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    const bool runInParallel = (numJobs > 1u) && (lines.size() > 1u);
+    std::vector<SingleBuild> builds(lines.size());
     for (size_t i = 0; i < lines.size(); ++i) {
-        std::vector<std::string> args = {argZero};
+        auto &build = builds[i];
+        build.args = {argZero};
 
-        int retVal = splitLineInSeparateArgs(args, lines[i], i);
-        if (retVal != OCLOC_SUCCESS) {
-            retValues.push_back(retVal);
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        if (build.retVal != OCLOC_SUCCESS) {
             continue;
         }
+        build.argsValid = true;
 
+        if (runInParallel) {
+            build.isolatedArgHelper = argHelper->createIsolatedHelper();
+        }
         if (!quiet) {
-            argHelper->printf("Command number %zu: \n", i + 1);
+            getArgHelper(build)->printf("Command number %zu: \n", i + 1);
+        }
+
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outFileName = outFileName;
+        build.outDir = outDirForBuilds;
+        if (false == runInParallel) {
+            build.retVal = singleBuild(build);
         }
+    }
 
-        addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
-        retValues.push_back(retVal);
+    if (runInParallel) {
+        // calling thread executes builds too
+        const auto numWorkers = static_cast<uint32_t>(std::min(static_cast<size_t>(numJobs), builds.size())) - 1u;
+        ThreadPool threadPool(numWorkers);
+        threadPool.parallelFor(builds.size(), [&builds, this](size_t i) {
+            if (builds[i].argsValid) {
+                builds[i].retVal = singleBuild(builds[i]);
+            }
+        });
+    }
+
+    // results are reported in order of commands, regardless of the order in which builds completed
+    for (auto &build : builds) {
+        if (build.isolatedArgHelper) {
+            argHelper->mergeIsolatedHelper(*build.isolatedArgHelper);
+        }
+        retValues.push_back(build.retVal);
+        if (build.argsValid) {
+            outputFile << build.outputFileListEntry << '\n';
+        }
     }
 }
 
@@ -171,6 +220,11 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -j <number_of_jobs>           Number of builds executed in parallel.
+                                0 uses number of hardware threads.
+                                Messages and results are reported in order
+                                of commands in <file_name>. Default: 1.
+
 )===");
 }
 
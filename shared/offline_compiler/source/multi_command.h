@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "shared/offline_compiler/source/ocloc_api.h"
+
+#include <memory>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -27,12 +30,23 @@ class MultiCommand {
     std::string outputFileList;
 
   protected:
+    struct SingleBuild {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::string outDir;
+        std::string outputFileListEntry;
+        std::unique_ptr<OclocArgHelper> isolatedArgHelper; // set when builds run in parallel, keeps messages and outputs of this build
+        int retVal = OCLOC_SUCCESS;
+        bool argsValid = false;
+    };
+
     MultiCommand() = default;
 
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int singleBuild(SingleBuild &build);
+    OclocArgHelper *getArgHelper(SingleBuild &build) const;
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
@@ -43,6 +57,7 @@ class MultiCommand {
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    uint32_t numJobs = 1u;
     bool quiet = false;
 };
 } // namespace NEO
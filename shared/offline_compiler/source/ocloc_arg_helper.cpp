@@ -80,6 +80,9 @@ OclocArgHelper::~OclocArgHelper() {
 }
 
 bool OclocArgHelper::fileExists(const std::string &filename) const {
+    if (parentHelper) {
+        return parentHelper->fileExists(filename);
+    }
     return sourceFileExists(filename) || ::fileExists(filename);
 }
 
@@ -124,6 +127,9 @@ std::vector<std::string> OclocArgHelper::headersToVectorOfStrings() {
 }
 
 void OclocArgHelper::readFileToVectorOfStrings(const std::string &filename, std::vector<std::string> &lines) {
+    if (parentHelper) {
+        return parentHelper->readFileToVectorOfStrings(filename, lines);
+    }
     if (Source *s = findSourceFile(filename)) {
         s->toVectorOfStrings(lines);
     } else {
@@ -132,6 +138,9 @@ void OclocArgHelper::readFileToVectorOfStrings(const std::string &filename, std:
 }
 
 std::vector<char> OclocArgHelper::readBinaryFile(const std::string &filename) {
+    if (parentHelper) {
+        return parentHelper->readBinaryFile(filename);
+    }
     if (Source *s = findSourceFile(filename)) {
         return s->toBinaryVector();
     } else {
@@ -140,6 +149,9 @@ std::vector<char> OclocArgHelper::readBinaryFile(const std::string &filename) {
 }
 
 std::unique_ptr<char[]> OclocArgHelper::loadDataFromFile(const std::string &filename, size_t &retSize) {
+    if (parentHelper) {
+        return parentHelper->loadDataFromFile(filename, retSize);
+    }
     if (Source *s = findSourceFile(filename)) {
         auto size = s->length;
         std::unique_ptr<char[]> ret(new char[size]());
@@ -206,7 +218,7 @@ void OclocArgHelper::setHwInfoForHwInfoConfig(NEO::HardwareInfo &hwInfo, uint64_
 }
 
 void OclocArgHelper::saveOutput(const std::string &filename, const void *pData, const size_t &dataSize) {
-    if (outputEnabled()) {
+    if (outputEnabled() || captureOutputs) {
         addOutput(filename, pData, dataSize);
     } else {
         writeDataToFile(filename.c_str(), pData, dataSize);
@@ -216,10 +228,37 @@ void OclocArgHelper::saveOutput(const std::string &filename, const void *pData,
 void OclocArgHelper::saveOutput(const std::string &filename, const std::ostream &stream) {
     std::stringstream ss;
     ss << stream.rdbuf();
-    if (outputEnabled()) {
+    if (outputEnabled() || captureOutputs) {
         addOutput(filename, ss.str().c_str(), ss.str().length());
     } else {
         std::ofstream file(filename);
         file << ss.str();
     }
 }
+
+std::unique_ptr<OclocArgHelper> OclocArgHelper::createIsolatedHelper() {
+    auto isolatedHelper = std::make_unique<OclocArgHelper>();
+    isolatedHelper->parentHelper = this;
+    for (const auto &header : headers) {
+        isolatedHelper->headers.push_back(header);
+    }
+    isolatedHelper->captureOutputs = outputEnabled() || captureOutputs;
+    isolatedHelper->messagePrinter.setSuppressMessages(messagePrinter.isSuppressed());
+    isolatedHelper->messagePrinter.setCaptureOnly(true);
+    return isolatedHelper;
+}
+
+void OclocArgHelper::mergeIsolatedHelper(OclocArgHelper &isolatedHelper) {
+    if (isolatedHelper.messagePrinter.isSuppressed()) {
+        messagePrinter.setSuppressMessages(true);
+    }
+    auto log = isolatedHelper.messagePrinter.getLog().str();
+    if (false == log.empty()) {
+        printf(log.c_str());
+    }
+    for (auto &output : isolatedHelper.outputs) {
+        saveOutput(output->name, output->data, output->size);
+        delete[] output->data;
+    }
+    isolatedHelper.outputs.clear();
+}
@@ -54,7 +54,9 @@ class OclocArgHelper {
     uint8_t ***dataOutputs = nullptr;
     uint64_t **lenOutputs = nullptr;
     bool hasOutput = false;
+    bool captureOutputs = false;
     MessagePrinter messagePrinter;
+    OclocArgHelper *parentHelper = nullptr;
     void moveOutputs();
     Source *findSourceFile(const std::string &filename);
     bool sourceFileExists(const std::string &filename) const;
@@ -95,6 +97,11 @@ class OclocArgHelper {
     MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const void *pData, const size_t &dataSize);
     void saveOutput(const std::string &filename, const std::ostream &stream);
 
+    // Helper reading inputs and headers through this one, which keeps its messages and outputs
+    // until they are merged back with mergeIsolatedHelper. Used to run builds concurrently.
+    std::unique_ptr<OclocArgHelper> createIsolatedHelper();
+    void mergeIsolatedHelper(OclocArgHelper &isolatedHelper);
+
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
         messagePrinter.printf(message);
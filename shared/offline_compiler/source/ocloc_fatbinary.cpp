@@ -14,17 +14,20 @@
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
 #include "shared/source/compiler_interface/tokenized_string.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/ar/ar_encoder.h"
 #include "shared/source/device_binary_format/elf/elf_encoder.h"
 #include "shared/source/device_binary_format/elf/ocl_elf.h"
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/product_config_helper.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "igfxfmid.h"
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
@@ -257,30 +260,26 @@ std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceA
     return retVal;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+int compileFatBinaryTarget(const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    int retVal = buildWithSafetyGuard(pCompiler);
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
-    if (retVal) {
-        return retVal;
+    if (retVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
     }
+    return retVal;
+}
 
+void appendFatBinaryTarget(std::string pointerSize, Ar::ArEncoder &fatbinary, ArrayRef<const uint8_t> packedDeviceBinary, OclocArgHelper *argHelper, const std::string &product) {
     std::string productConfig("");
     if (product.find(".") != std::string::npos) {
         productConfig = product;
@@ -288,10 +287,102 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
         productConfig = ProductConfigHelper::parseMajorMinorRevisionValue(argHelper->productConfigHelper->getProductConfigFromDeviceName(product));
     }
 
-    fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
+    fatbinary.appendFileEntry(pointerSize + "." + productConfig, packedDeviceBinary);
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+
+    if (retVal == 0) {
+        retVal = compileFatBinaryTarget(argsCopy, pCompiler, argHelper, product);
+    }
+    if (retVal) {
+        return retVal;
+    }
+
+    appendFatBinaryTarget(pointerSize, fatbinary, pCompiler->getPackedDeviceBinaryOutput(), argHelper, product);
     return retVal;
 }
 
+uint32_t getNumThreadsForFatBinaryBuild(size_t numTargets) {
+    // targets are built one by one unless more threads are requested explicitly
+    uint32_t numThreads = 1u;
+    if (DebugManager.flags.BuildThreadPoolSize.get() != -1) {
+        numThreads = static_cast<uint32_t>(DebugManager.flags.BuildThreadPoolSize.get());
+    }
+    return static_cast<uint32_t>(std::min(static_cast<size_t>(numThreads), numTargets));
+}
+
+int buildFatBinaryTargets(const std::vector<ConstStringRef> &targetProducts, const std::vector<std::string> &argsCopy, size_t deviceArgIndex,
+                          std::string pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr) {
+    struct TargetBuild {
+        std::vector<std::string> args;
+        std::unique_ptr<OclocArgHelper> argHelper;
+        std::vector<uint8_t> packedDeviceBinary;
+        std::string options;
+        int createRetVal = OCLOC_SUCCESS;
+        int buildRetVal = OCLOC_SUCCESS;
+        bool built = false;
+    };
+
+    std::vector<TargetBuild> targetBuilds(targetProducts.size());
+    for (size_t i = 0; i < targetProducts.size(); ++i) {
+        targetBuilds[i].args = argsCopy;
+        targetBuilds[i].args[deviceArgIndex] = targetProducts[i].str();
+        targetBuilds[i].argHelper = argHelper->createIsolatedHelper();
+    }
+
+    // targets after the first failed one are not built, as in sequential build
+    std::atomic<size_t> firstFailedTarget{targetBuilds.size()};
+    auto markFailed = [&firstFailedTarget](size_t target) {
+        auto failedTarget = firstFailedTarget.load();
+        while (target < failedTarget && !firstFailedTarget.compare_exchange_weak(failedTarget, target)) {
+        }
+    };
+
+    // every target is compiled by its own OfflineCompiler, messages are kept in isolated helpers until all builds are done;
+    // the compiler is released as soon as its target is done, only the packed binary and options are kept for the archive
+    ThreadPool threadPool(getNumThreadsForFatBinaryBuild(targetProducts.size()) - 1u);
+    threadPool.parallelFor(targetBuilds.size(), [&](size_t i) {
+        if (i > firstFailedTarget.load()) {
+            return;
+        }
+        auto &targetBuild = targetBuilds[i];
+        std::unique_ptr<OfflineCompiler> compiler{OfflineCompiler::create(targetBuild.args.size(), targetBuild.args, false, targetBuild.createRetVal, targetBuild.argHelper.get())};
+        if (OCLOC_SUCCESS == targetBuild.createRetVal) {
+            targetBuild.buildRetVal = compileFatBinaryTarget(targetBuild.args, compiler.get(), targetBuild.argHelper.get(), targetProducts[i].str());
+        }
+        if (OCLOC_SUCCESS != targetBuild.createRetVal || OCLOC_SUCCESS != targetBuild.buildRetVal) {
+            markFailed(i);
+        } else {
+            auto packedDeviceBinary = compiler->getPackedDeviceBinaryOutput();
+            targetBuild.packedDeviceBinary.assign(packedDeviceBinary.begin(), packedDeviceBinary.end());
+            targetBuild.options = compiler->getOptions();
+        }
+        targetBuild.built = true;
+    });
+
+    // results are reported and appended to archive in order of targets, stopping at first failure as in sequential build
+    for (size_t i = 0; i < targetBuilds.size(); ++i) {
+        auto &targetBuild = targetBuilds[i];
+        UNRECOVERABLE_IF(!targetBuild.built);
+        argHelper->mergeIsolatedHelper(*targetBuild.argHelper);
+        if (OCLOC_SUCCESS != targetBuild.createRetVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return targetBuild.createRetVal;
+        }
+        if (targetBuild.buildRetVal) {
+            return targetBuild.buildRetVal;
+        }
+
+        appendFatBinaryTarget(pointerSize, fatbinary, targetBuild.packedDeviceBinary, argHelper, targetProducts[i].str());
+        if (optionsForIr.empty()) {
+            optionsForIr = targetBuild.options;
+        }
+    }
+    return OCLOC_SUCCESS;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -360,22 +451,29 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (getNumThreadsForFatBinaryBuild(targetProducts.size()) > 1u) {
+        auto retVal = buildFatBinaryTargets(targetProducts, argsCopy, deviceArgIndex, pointerSizeInBits, fatbinary, argHelper, optionsForIr);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
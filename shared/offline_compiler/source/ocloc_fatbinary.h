@@ -42,6 +42,11 @@ std::vector<NEO::ConstStringRef> getProductsForRange(unsigned int productFrom, u
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int compileFatBinaryTarget(const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product);
+void appendFatBinaryTarget(std::string pointerSize, Ar::ArEncoder &fatbinary, ArrayRef<const uint8_t> packedDeviceBinary, OclocArgHelper *argHelper, const std::string &product);
+uint32_t getNumThreadsForFatBinaryBuild(size_t numTargets);
+int buildFatBinaryTargets(const std::vector<ConstStringRef> &targetProducts, const std::vector<std::string> &argsCopy, size_t deviceArgIndex,
+                          std::string pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper, std::string options);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv, const ArrayRef<const uint8_t> &options);
 
@@ -17,6 +17,7 @@
 #include "shared/source/compiler_interface/compiler_options_extra.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
+#include "shared/source/compiler_interface/oclc_extensions.h"
 #include "shared/source/compiler_interface/tokenized_string.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device_binary_format/device_binary_formats.h"
@@ -212,17 +213,23 @@ struct OfflineCompiler::buildInfo {
     IGC::CodeType::CodeType_t intermediateRepresentation;
 };
 
+std::string OfflineCompiler::getCachedFileName(const ArrayRef<const char> input) {
+    const std::string igcRevision = igcFacade->getIgcRevision();
+    return cache->getCachedFileName(getHardwareInfo(), input, options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(),
+                                    igcRevision, igcFacade->getIgcLibSize(), igcFacade->getIgcLibMTime());
+}
+
+bool OfflineCompiler::isSourceCachedDirectly() const {
+    // Same rule as runtime direct caching mode, key of such entry does not cover included files
+    return false == argHelper->hasHeaders() && sourceCode.find("#include") == std::string::npos;
+}
+
 int OfflineCompiler::buildIrBinary() {
     int retVal = OCLOC_SUCCESS;
 
     if (allowCaching) {
-        const std::string igcRevision = igcFacade->getIgcRevision();
-        const auto igcLibSize = igcFacade->getIgcLibSize();
-        const auto igcLibMTime = igcFacade->getIgcLibMTime();
-        irHash = cache->getCachedFileName(getHardwareInfo(),
-                                          sourceCode,
-                                          options,
-                                          internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+        // Key of source code is reserved for device binary, which makes entries of ocloc and runtime interchangeable
+        irHash = getCachedFileName(getCachedFileName(sourceCode));
         irBinary = cache->loadCachedBinary(irHash, irBinarySize).release();
         if (irBinary) {
             return retVal;
@@ -338,20 +345,23 @@ int OfflineCompiler::buildSourceCode() {
         return OCLOC_INVALID_PROGRAM;
     }
 
-    const std::string igcRevision = igcFacade->getIgcRevision();
-    const auto igcLibSize = igcFacade->getIgcLibSize();
-    const auto igcLibMTime = igcFacade->getIgcLibMTime();
-
     if (allowCaching) {
-        irHash = cache->getCachedFileName(getHardwareInfo(), sourceCode, options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+        // Device binaries are cached with the same keys as in runtime: built from source directly or from IR
+        sourceGenHash = isSourceCachedDirectly() ? getCachedFileName(sourceCode) : "";
+        irHash = getCachedFileName(getCachedFileName(sourceCode));
         irBinary = cache->loadCachedBinary(irHash, irBinarySize).release();
 
-        genHash = cache->getCachedFileName(getHardwareInfo(), ArrayRef<const char>(irBinary, irBinarySize), options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
-        genBinary = cache->loadCachedBinary(genHash, genBinarySize).release();
+        genHash = getCachedFileName(ArrayRef<const char>(irBinary, irBinarySize));
+        if (false == sourceGenHash.empty()) {
+            genBinary = cache->loadCachedBinary(sourceGenHash, genBinarySize).release();
+        }
+        if (nullptr == genBinary) {
+            genBinary = cache->loadCachedBinary(genHash, genBinarySize).release();
+        }
 
         const bool generateDebugInfo = CompilerOptions::contains(options, CompilerOptions::generateDebugInfo);
         if (generateDebugInfo) {
-            dbgHash = cache->getCachedFileName(getHardwareInfo(), irHash, options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+            dbgHash = getCachedFileName(irHash);
             debugDataBinary = cache->loadCachedBinary(dbgHash, debugDataBinarySize).release();
         }
 
@@ -416,10 +426,13 @@ int OfflineCompiler::buildSourceCode() {
         storeBinary(debugDataBinary, debugDataBinarySize, igcOutput->GetDebugData()->GetMemory<char>(), igcOutput->GetDebugData()->GetSizeRaw());
     }
     if (allowCaching) {
-        genHash = cache->getCachedFileName(getHardwareInfo(), ArrayRef<const char>(irBinary, irBinarySize), options, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+        genHash = getCachedFileName(ArrayRef<const char>(irBinary, irBinarySize));
         cache->cacheBinary(irHash, irBinary, static_cast<uint32_t>(irBinarySize));
         cache->cacheBinary(genHash, genBinary, static_cast<uint32_t>(genBinarySize));
         cache->cacheBinary(dbgHash, debugDataBinary, static_cast<uint32_t>(debugDataBinarySize));
+        if (false == sourceGenHash.empty() && sourceGenHash != genHash) {
+            cache->cacheBinary(sourceGenHash, genBinary, static_cast<uint32_t>(genBinarySize));
+        }
     }
 
     retVal = igcOutput->Successful() ? OCLOC_SUCCESS : OCLOC_BUILD_PROGRAM_FAILURE;
@@ -571,6 +584,7 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
     } else if (retVal != OCLOC_SUCCESS) {
         return retVal;
     }
+    cacheSharedWithRuntime = allowCaching && cacheConfig.sharedWithRuntime && cacheDir == cacheConfig.cacheDir;
 
     if (options.empty()) {
         // try to read options from file if not provided by commandline
@@ -630,7 +644,8 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
 
     if (formatToEnforce.empty() &&
         compilerProductHelper &&
-        compilerProductHelper->oclocEnforceZebinFormat()) {
+        compilerProductHelper->oclocEnforceZebinFormat() &&
+        false == cacheSharedWithRuntime) {
         formatToEnforce = "zebin";
     }
 
@@ -652,6 +667,9 @@ int OfflineCompiler::initialize(size_t numArgs, const std::vector<std::string> &
                                          "+__opencl_c_3d_image_writes,+__opencl_c_images";
         internalOptions = CompilerOptions::concatenate(emptyDeviceOptions, internalOptions);
         CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::enableImageSupport);
+    } else if (cacheSharedWithRuntime) {
+        // cache keys cover internal options, so build with the ones runtime uses, options given to ocloc are kept as if passed to runtime build
+        internalOptions = getRuntimeInternalOptions(internalOptions);
     } else {
         appendExtensionsToInternalOptions(hwInfo, options, internalOptions);
         appendExtraInternalOptions(internalOptions);
@@ -901,7 +919,32 @@ void OfflineCompiler::appendExtraInternalOptions(std::string &internalOptions) {
     CompilerOptions::applyExtraInternalOptions(internalOptions, *compilerProductHelper);
 }
 
+std::string OfflineCompiler::getRuntimeInternalOptions(const std::string &givenInternalOptions) const {
+    ProgramInternalOptionsArgs args;
+    args.clVersion = hwInfo.capabilityTable.clVersionSupport;
+    args.greaterThan4gbBuffersRequired = compilerProductHelper->isForceToStatelessRequired() && !forceStatelessToStatefulOptimization;
+    args.statelessToStatefulWithOffsetSupported = compilerProductHelper->isStatelessToStatefulBufferOffsetSupported();
+    args.forceEmuInt32DivRemSP = compilerProductHelper->isForceEmuInt32DivRemSPRequired();
+    args.supportsImages = hwInfo.capabilityTable.supportsImages;
+    auto runtimeInternalOptions = getProgramInternalOptions(args, *compilerProductHelper);
+
+    CompilerOptions::concatenateAppend(runtimeInternalOptions, givenInternalOptions);
+    CompilerOptions::applyAdditionalInternalOptions(runtimeInternalOptions);
+
+    OpenClCFeaturesContainer openclCFeatures;
+    if (requiresOpenClCFeatures(options)) {
+        getOpenclCFeaturesList(hwInfo, openclCFeatures, *compilerProductHelper);
+    }
+    const auto deviceExtensions = compilerProductHelper->getDeviceExtensions(hwInfo, releaseHelper.get());
+    appendProgramBuildInternalOptions(runtimeInternalOptions, options, convertEnabledExtensionsToCompilerInternalOptions(deviceExtensions.c_str(), openclCFeatures), false);
+    return runtimeInternalOptions;
+}
+
 void OfflineCompiler::parseDebugSettings() {
+    if (cacheSharedWithRuntime && false == deviceName.empty()) {
+        // already applied together with other runtime internal options
+        return;
+    }
     setStatelessToStatefulBufferOffsetFlag();
 }
 
@@ -1028,6 +1071,11 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -cache_dir <output_dir>                   Optional caching directory.
                                             Default directory is "ocloc_cache".
+                                            When NEO_CACHE_PERSISTENT=1 and NEO_CACHE_DIR
+                                            are set, the runtime cache directory is used
+                                            and device binaries are shared with runtime.
+                                            In that case program is built with internal
+                                            options used by runtime for the same device.
 
   -options <options>                        Optional OpenCL C compilation options
                                             as defined by OpenCL specification.
@@ -118,6 +118,9 @@ All supported acronyms: %s.
     MOCKABLE_VIRTUAL int buildSourceCode();
     MOCKABLE_VIRTUAL std::string validateInputType(const std::string &input, bool isLlvm, bool isSpirv);
     MOCKABLE_VIRTUAL int buildIrBinary();
+    std::string getCachedFileName(const ArrayRef<const char> input);
+    bool isSourceCachedDirectly() const;
+    std::string getRuntimeInternalOptions(const std::string &givenInternalOptions) const;
     void updateBuildLog(const char *pErrorString, const size_t errorStringSize);
     MOCKABLE_VIRTUAL bool generateElfBinary();
     std::string generateFilePathForIr(const std::string &fileNameBase) {
@@ -153,9 +156,12 @@ All supported acronyms: %s.
     std::string internalOptionsReadFromFile = "";
     std::string formatToEnforce = "";
     std::string irHash, genHash, dbgHash, elfHash;
+    std::string sourceGenHash; // same as runtime key of device binary built directly from source
+
     std::string cacheDir;
 
     bool allowCaching = false;
+    bool cacheSharedWithRuntime = false;
     bool dumpFiles = true;
     bool useLlvmText = false;
     bool useLlvmBc = false;
@@ -8,26 +8,36 @@
 #pragma once
 #include "shared/source/helpers/abort.h"
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <execinfo.h>
+#include <mutex>
 #include <setjmp.h>
 #include <signal.h>
 
-static jmp_buf jmpbuf;
-
+// Guards may be active on several threads at once (parallel ocloc builds).
+// Signal handlers are process-wide, so they are installed by the first live guard and restored by the last one,
+// while the jump target is tracked per thread, so a crash unwinds only the guarded call on the faulting thread.
 class SafetyGuardLinux {
   public:
     SafetyGuardLinux() {
-        struct sigaction sigact {};
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (numGuards++ == 0) {
+            struct sigaction sigact {};
 
-        sigact.sa_sigaction = sigAction;
-        sigact.sa_flags = SA_RESTART | SA_SIGINFO;
-        sigaction(SIGSEGV, &sigact, &previousSigSegvAction);
-        sigaction(SIGILL, &sigact, &previousSigIllvAction);
+            sigact.sa_sigaction = sigAction;
+            sigact.sa_flags = SA_RESTART | SA_SIGINFO;
+            sigaction(SIGSEGV, &sigact, &previousSigSegvAction);
+            sigaction(SIGILL, &sigact, &previousSigIllvAction);
+        }
     }
 
     ~SafetyGuardLinux() {
+        std::lock_guard<std::mutex> lock(handlersMutex);
+        if (--numGuards != 0) {
+            return;
+        }
         if (previousSigSegvAction.sa_sigaction) {
             sigaction(SIGSEGV, &previousSigSegvAction, NULL);
         }
@@ -37,6 +47,12 @@ class SafetyGuardLinux {
     }
 
     static void sigAction(int sigNum, siginfo_t *info, void *ucontext) {
+        if (activeJmpBuf == nullptr) {
+            // crash outside of a guarded call, let the previous handler deal with it when the instruction is retried
+            sigaction(sigNum, (sigNum == SIGSEGV) ? &previousSigSegvAction : &previousSigIllvAction, NULL);
+            return;
+        }
+
         const int callstackDepth = 30;
         void *addresses[callstackDepth];
         char **callstack;
@@ -50,17 +66,23 @@ class SafetyGuardLinux {
         }
 
         free(callstack);
-        longjmp(jmpbuf, 1);
+        longjmp(*activeJmpBuf, 1);
     }
 
     template <typename T, typename Object, typename Method>
     T call(Object *object, Method method, T retValueOnCrash) {
+        jmp_buf jmpbuf;
+        auto previousJmpBuf = activeJmpBuf;
         int jump = 0;
         jump = setjmp(jmpbuf);
 
         if (jump == 0) {
-            return (object->*method)();
+            activeJmpBuf = &jmpbuf;
+            T retVal = (object->*method)();
+            activeJmpBuf = previousJmpBuf;
+            return retVal;
         } else {
+            activeJmpBuf = previousJmpBuf;
             if (onSigSegv) {
                 onSigSegv();
             } else {
@@ -72,6 +94,11 @@ class SafetyGuardLinux {
 
     typedef void (*callbackFunction)();
     callbackFunction onSigSegv = nullptr;
-    struct sigaction previousSigSegvAction {};
-    struct sigaction previousSigIllvAction {};
+
+  protected:
+    static inline thread_local jmp_buf *activeJmpBuf = nullptr;
+    static inline std::mutex handlersMutex;
+    static inline uint32_t numGuards = 0u;
+    static inline struct sigaction previousSigSegvAction {};
+    static inline struct sigaction previousSigIllvAction {};
 };
@@ -11,12 +11,12 @@
 
 #include <setjmp.h>
 
-static jmp_buf jmpbuf;
-
 class SafetyGuardWindows {
   public:
     template <typename T, typename Object, typename Method>
     T call(Object *object, Method method, T retValueOnCrash) {
+        // jump target is local to the call, guards may run on several threads at once
+        jmp_buf jmpbuf;
         int jump = 0;
         jump = setjmp(jmpbuf);
 
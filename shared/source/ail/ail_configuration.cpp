@@ -7,9 +7,11 @@
 
 #include "shared/source/ail/ail_configuration.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 
+#include <fstream>
 #include <map>
 #include <string>
 #include <string_view>
@@ -27,4 +29,80 @@ bool AILConfiguration::sourcesContain(const std::string &sources, std::string_vi
     return (sources.find(contentToFind) != std::string::npos);
 }
 
+// Only tuning settings are allowed in presets, names are kept here so they are available in release builds
+static const std::map<std::string_view, DebugVarBase<int32_t> DebugVariables::*> presetSettings = {
+    {"EnableDirectSubmission", &DebugVariables::EnableDirectSubmission},
+    {"DirectSubmissionOverrideBlitterSupport", &DebugVariables::DirectSubmissionOverrideBlitterSupport},
+    {"DirectSubmissionOverrideRenderSupport", &DebugVariables::DirectSubmissionOverrideRenderSupport},
+    {"DirectSubmissionOverrideComputeSupport", &DebugVariables::DirectSubmissionOverrideComputeSupport},
+    {"SplitBcsCopy", &DebugVariables::SplitBcsCopy},
+    {"SplitBcsSize", &DebugVariables::SplitBcsSize},
+    {"OverrideEnableKmdNotify", &DebugVariables::OverrideEnableKmdNotify},
+    {"OverrideKmdNotifyDelayMicroseconds", &DebugVariables::OverrideKmdNotifyDelayMicroseconds},
+    {"CsrDispatchMode", &DebugVariables::CsrDispatchMode},
+    {"ExperimentalEnableDeviceAllocationCache", &DebugVariables::ExperimentalEnableDeviceAllocationCache},
+    {"BinaryCacheMemoryTierSizeInMB", &DebugVariables::BinaryCacheMemoryTierSizeInMB}};
+
+static std::string_view trimWhitespaces(std::string_view text) {
+    constexpr std::string_view whitespaces = " \t\r";
+    auto begin = text.find_first_not_of(whitespaces);
+    if (begin == std::string_view::npos) {
+        return {};
+    }
+    auto end = text.find_last_not_of(whitespaces);
+    return text.substr(begin, end - begin + 1);
+}
+
+bool AILConfiguration::applyPreset(std::string_view settingName, std::string_view value) {
+    auto setting = presetSettings.find(settingName);
+    if (setting == presetSettings.end()) {
+        return false;
+    }
+    std::string valueString(value);
+    char *valueEnd = nullptr;
+    auto presetValue = static_cast<int32_t>(strtol(valueString.c_str(), &valueEnd, 0));
+    if (valueString.empty() || *valueEnd != '\0') {
+        return false;
+    }
+    (DebugManager.flags.*(setting->second)).setIfDefault(presetValue);
+    return true;
+}
+
+void AILConfiguration::applyPresets(std::istream &presets) {
+    bool applicationMatches = false;
+    std::string line;
+    while (std::getline(presets, line)) {
+        auto entry = trimWhitespaces(line);
+        if (entry.empty() || entry[0] == '#') {
+            continue;
+        }
+        if (entry.front() == '[' && entry.back() == ']') {
+            applicationMatches = (trimWhitespaces(entry.substr(1, entry.size() - 2)) == processName);
+            continue;
+        }
+        if (!applicationMatches) {
+            continue;
+        }
+        auto equalsSignPosition = entry.find('=');
+        if (equalsSignPosition == std::string_view::npos) {
+            continue;
+        }
+        auto settingName = trimWhitespaces(entry.substr(0, equalsSignPosition));
+        auto value = trimWhitespaces(entry.substr(equalsSignPosition + 1));
+        if (!applyPreset(settingName, value)) {
+            PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "WARNING: Invalid AIL preset %s for %s ignored\n", line.c_str(), processName.c_str());
+        }
+    }
+}
+
+void AILConfiguration::applyPresetsFromFile(const std::string &presetsFilePath) {
+    if (presetsFilePath.empty()) {
+        return;
+    }
+    std::ifstream presetsFile(presetsFilePath);
+    if (presetsFile.is_open()) {
+        applyPresets(presetsFile);
+    }
+}
+
 } // namespace NEO
@@ -10,6 +10,7 @@
 #include "igfxfmid.h"
 
 #include <cstdint>
+#include <iosfwd>
 #include <set>
 #include <string>
 
@@ -23,6 +24,14 @@
  * E.g. AIL can detect running Blender application and enable fp64 emulation on hardware
  * that does not support native fp64.
  *
+ * Besides hard-coded controls, AIL applies presets of tuning settings (e.g. direct submission, BCS split,
+ * KMD notify delays) read from a presets file, with sections named after applications:
+ *
+ *   [application name]
+ *   SettingName = value
+ *
+ * Preset values don't override settings set explicitly by the user.
+ *
  * Disclaimer: we should never use this for benchmarking or conformance purposes - this would be cheating.
  *
  */
@@ -59,12 +68,17 @@ class AILConfiguration {
 
     virtual bool isContextSyncFlagRequired() = 0;
 
+    static const char *defaultPresetsFilePath;
+    void applyPresets(std::istream &presets);
+    void applyPresetsFromFile(const std::string &presetsFilePath);
+
   protected:
     virtual void applyExt(RuntimeCapabilityTable &runtimeCapabilityTable) = 0;
     std::string processName;
 
     bool sourcesContain(const std::string &sources, std::string_view contentToFind) const;
     MOCKABLE_VIRTUAL bool isKernelHashCorrect(const std::string &kernelSources, uint64_t expectedHash) const;
+    bool applyPreset(std::string_view settingName, std::string_view value);
 };
 
 extern AILConfiguration *ailConfigurationTable[IGFX_MAX_PRODUCT];
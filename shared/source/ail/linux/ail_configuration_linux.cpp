@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,8 @@
 // Application detection is performed using the process name of the given application.
 
 namespace NEO {
+const char *AILConfiguration::defaultPresetsFilePath = "/etc/neo/ail_presets.config";
+
 bool AILConfiguration::initProcessExecutableName() {
     char path[512] = {0};
     int result = SysCalls::readlink("/proc/self/exe", path, sizeof(path) - 1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2022 Intel Corporation
+ * Copyright (C) 2021-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,6 +11,9 @@
 // Application detection is performed using the process name of the given application.
 
 namespace NEO {
+// No default location, presets file is used only when AILPresetsFile is set
+const char *AILConfiguration::defaultPresetsFilePath = "";
+
 bool AILConfiguration::initProcessExecutableName() {
     const DWORD length = MAX_PATH;
     WCHAR processFilenameW[length];
@@ -26,6 +26,7 @@
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/helpers/state_base_address.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_walker_template_cache.h"
 #include "shared/source/kernel/implicit_args.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/os_interface/product_helper.h"
@@ -75,43 +76,24 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     WALKER_TYPE walkerCmd = Family::cmdInitGpgpuWalker;
     auto &idd = walkerCmd.getInterfaceDescriptor();
 
-    EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
-                                             sizePerThreadData, rootDeviceEnvironment);
     auto &productHelper = args.device->getProductHelper();
-    productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
-                                   kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
 
     bool localIdsGenerationByRuntime = args.dispatchInterface->requiresGenerationOfLocalIdsByRuntime();
     auto requiredWorkgroupOrder = args.dispatchInterface->getRequiredWorkgroupOrder();
     bool inlineDataProgramming = EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor);
+
+    uint64_t kernelStartPointer = 0u;
     {
         auto alloc = args.dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
+        kernelStartPointer = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
         if (!localIdsGenerationByRuntime) {
-            offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
+            kernelStartPointer += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
         }
-        idd.setKernelStartPointer(offset);
-    }
-    if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
-        idd.setSoftwareExceptionEnable(1);
     }
 
     auto threadsPerThreadGroup = args.dispatchInterface->getNumThreadsPerThreadGroup();
-    idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
-
-    EncodeDispatchKernel<Family>::programBarrierEnable(idd,
-                                                       kernelDescriptor.kernelAttributes.barrierCount,
-                                                       hwInfo);
-
-    auto &gfxCoreHelper = args.device->getGfxCoreHelper();
-    auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
-        gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
-
-    if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
-        slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
-    }
-    idd.setSharedLocalMemorySize(slmSize);
 
     auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     bool skipSshProgramming = false;
@@ -121,6 +103,77 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         skipSshProgramming = true;
     }
 
+    uint32_t samplerCount = 0;
+    if constexpr (Family::supportsSampler) {
+        if (args.device->getDeviceInfo().imageSupport) {
+            samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
+        }
+    }
+
+    DispatchWalkerTemplateCache *walkerTemplateCache = nullptr;
+    if (DebugManager.flags.EnableWalkerTemplateCache.get() == 1) {
+        walkerTemplateCache = args.dispatchInterface->getWalkerTemplateCache();
+    }
+
+    DispatchWalkerTemplate::Key walkerTemplateKey;
+    DispatchWalkerTemplate walkerTemplate;
+    bool walkerTemplateFound = false;
+    if (walkerTemplateCache) {
+        auto groupSize = args.dispatchInterface->getGroupSize();
+        walkerTemplateKey.device = args.device;
+        walkerTemplateKey.kernelStartPointer = kernelStartPointer;
+        walkerTemplateKey.groupSize[0] = groupSize[0];
+        walkerTemplateKey.groupSize[1] = groupSize[1];
+        walkerTemplateKey.groupSize[2] = groupSize[2];
+        walkerTemplateKey.slmTotalSize = args.dispatchInterface->getSlmTotalSize();
+        walkerTemplateKey.slmPolicy = args.dispatchInterface->getSlmPolicy();
+        walkerTemplateKey.preemptionMode = args.preemptionMode;
+        walkerTemplateKey.threadArbitrationPolicy = kernelDescriptor.kernelAttributes.threadArbitrationPolicy;
+        walkerTemplateKey.debuggerActive = (args.device->getL0Debugger() != nullptr);
+        walkerTemplateFound = walkerTemplateCache->find(walkerTemplateKey, walkerTemplate);
+    }
+
+    if (walkerTemplateFound) {
+        memcpy_s(&walkerCmd, sizeof(walkerCmd), walkerTemplate.walker.data(), sizeof(walkerCmd));
+    } else {
+        EncodeDispatchKernel<Family>::setGrfInfo(&idd, kernelDescriptor.kernelAttributes.numGrfRequired, sizeCrossThreadData,
+                                                 sizePerThreadData, rootDeviceEnvironment);
+        productHelper.updateIddCommand(&idd, kernelDescriptor.kernelAttributes.numGrfRequired,
+                                       kernelDescriptor.kernelAttributes.threadArbitrationPolicy);
+
+        idd.setKernelStartPointer(kernelStartPointer);
+        if (args.dispatchInterface->getKernelDescriptor().kernelAttributes.flags.usesAssert && args.device->getL0Debugger() != nullptr) {
+            idd.setSoftwareExceptionEnable(1);
+        }
+
+        idd.setNumberOfThreadsInGpgpuThreadGroup(threadsPerThreadGroup);
+
+        EncodeDispatchKernel<Family>::programBarrierEnable(idd,
+                                                           kernelDescriptor.kernelAttributes.barrierCount,
+                                                           hwInfo);
+
+        auto slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(
+            gfxCoreHelper.computeSlmValues(hwInfo, args.dispatchInterface->getSlmTotalSize()));
+
+        if (DebugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+            slmSize = static_cast<SHARED_LOCAL_MEMORY_SIZE>(DebugManager.flags.OverrideSlmAllocationSize.get());
+        }
+        idd.setSharedLocalMemorySize(slmSize);
+
+        PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
+
+        EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
+
+        EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
+                                                                args.dispatchInterface->getSlmTotalSize(),
+                                                                args.dispatchInterface->getSlmPolicy());
+
+        if (walkerTemplateCache) {
+            static_assert(sizeof(WALKER_TYPE) <= sizeof(DispatchWalkerTemplate::walker), "walker template storage too small");
+            walkerTemplateCache->add(walkerTemplateKey, &walkerCmd, sizeof(walkerCmd));
+        }
+    }
+
     uint32_t bindingTablePointer = 0u;
     bool isBindlessKernel = NEO::KernelDescriptor::isBindlessAddressingKernel(kernelDescriptor);
 
@@ -161,10 +214,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
     idd.setBindingTablePointer(bindingTablePointer);
 
-    PreemptionHelper::programInterfaceDescriptorDataPreemption<Family>(&idd, args.preemptionMode);
-
-    uint32_t samplerCount = 0;
-
     if constexpr (Family::supportsSampler) {
         if (args.device->getDeviceInfo().imageSupport) {
 
@@ -177,7 +226,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                 }
                 UNRECOVERABLE_IF(!dsHeap);
 
-                samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
                 samplerStateOffset = EncodeStates<Family>::copySamplerState(
                     dsHeap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
                     kernelDescriptor.payloadMappings.samplerTable.numSamplers, kernelDescriptor.payloadMappings.samplerTable.borderColor,
@@ -189,8 +237,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         }
     }
 
-    EncodeDispatchKernel<Family>::adjustBindingTablePrefetch(idd, samplerCount, bindingTableStateCount);
-
     uint64_t offsetThreadData = 0u;
     const uint32_t inlineDataSize = sizeof(INLINE_DATA);
     auto crossThreadData = args.dispatchInterface->getCrossThreadData();
@@ -228,6 +274,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, std::make_pair(localIdsGenerationByRuntime, requiredWorkgroupOrder), gfxCoreHelper);
         }
 
+        args.outIndirectDataPtr = ptr;
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
@@ -345,10 +392,6 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
                 idd.getThreadGroupDispatchSize());
     }
 
-    EncodeDispatchKernel<Family>::appendAdditionalIDDFields(&idd, rootDeviceEnvironment, threadsPerThreadGroup,
-                                                            args.dispatchInterface->getSlmTotalSize(),
-                                                            args.dispatchInterface->getSlmPolicy());
-
     EncodeWalkerArgs walkerArgs{
         args.isCooperative ? KernelExecutionType::Concurrent : KernelExecutionType::Default,
         args.isHostScopeSignalEvent && args.isKernelUsingSystemAllocation,
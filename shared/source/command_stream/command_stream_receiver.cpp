@@ -313,6 +313,12 @@ bool CommandStreamReceiver::initializeResources() {
             if (!osContext->ensureContextInitialized()) {
                 return false;
             }
+            if (this->engineAllocationsDeferred) {
+                if (!createEngineAllocations(this->preemptionAllocationRequired)) {
+                    return false;
+                }
+                this->engineAllocationsDeferred = false;
+            }
             this->fillReusableAllocationsList();
             this->resourcesInitialized = true;
         }
@@ -849,13 +855,18 @@ bool CommandStreamReceiver::createGlobalFenceAllocation() {
     return this->globalFenceAllocation != nullptr;
 }
 
-bool CommandStreamReceiver::createPreemptionAllocation() {
-    auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
-    auto &gfxCoreHelper = getGfxCoreHelper();
-    size_t preemptionSurfaceSize = hwInfo->capabilityTable.requiredPreemptionSurfaceSize;
+static size_t getPreemptionSurfaceSize(const HardwareInfo &hwInfo) {
+    size_t preemptionSurfaceSize = hwInfo.capabilityTable.requiredPreemptionSurfaceSize;
     if (DebugManager.flags.OverrideCsrAllocationSize.get() > 0) {
         preemptionSurfaceSize = DebugManager.flags.OverrideCsrAllocationSize.get();
     }
+    return preemptionSurfaceSize;
+}
+
+bool CommandStreamReceiver::createPreemptionAllocation() {
+    auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
+    auto &gfxCoreHelper = getGfxCoreHelper();
+    size_t preemptionSurfaceSize = getPreemptionSurfaceSize(*hwInfo);
     AllocationProperties properties{rootDeviceIndex, true, preemptionSurfaceSize, AllocationType::PREEMPTION, isMultiOsContextCapable(), false, deviceBitfield};
     properties.flags.uncacheable = hwInfo->workaroundTable.flags.waCSRUncachable;
     properties.alignment = gfxCoreHelper.getPreemptionAllocationAlignment();
@@ -863,6 +874,33 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
     return this->preemptionAllocation != nullptr;
 }
 
+bool CommandStreamReceiver::createEngineAllocations(bool preemptionAllocationRequired) {
+    if (!this->globalFenceAllocation && !createGlobalFenceAllocation()) {
+        return false;
+    }
+    if (preemptionAllocationRequired && !this->preemptionAllocation && !createPreemptionAllocation()) {
+        return false;
+    }
+    return true;
+}
+
+// Only global fence and preemption allocations are deferred; tag allocation, CSR and OS context objects are still created eagerly
+void CommandStreamReceiver::deferEngineAllocations(bool preemptionAllocationRequired) {
+    this->engineAllocationsDeferred = true;
+    this->preemptionAllocationRequired = preemptionAllocationRequired;
+}
+
+size_t CommandStreamReceiver::getEngineAllocationsSize(bool preemptionAllocationRequired) const {
+    size_t size = 0u;
+    if (getGfxCoreHelper().isFenceAllocationRequired(peekHwInfo())) {
+        size += MemoryConstants::pageSize;
+    }
+    if (preemptionAllocationRequired) {
+        size += getPreemptionSurfaceSize(peekHwInfo());
+    }
+    return size;
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
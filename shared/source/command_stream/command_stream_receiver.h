@@ -213,6 +213,10 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createWorkPartitionAllocation(const Device &device);
     MOCKABLE_VIRTUAL bool createGlobalFenceAllocation();
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
+    bool createEngineAllocations(bool preemptionAllocationRequired);
+    void deferEngineAllocations(bool preemptionAllocationRequired);
+    bool areEngineAllocationsDeferred() const { return engineAllocationsDeferred; }
+    size_t getEngineAllocationsSize(bool preemptionAllocationRequired) const;
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
 
@@ -568,6 +572,8 @@ class CommandStreamReceiver {
     bool dcFlushSupport = false;
     bool forceSkipResourceCleanupRequired = false;
     volatile bool resourcesInitialized = false;
+    bool engineAllocationsDeferred = false;
+    bool preemptionAllocationRequired = false;
     bool doubleSbaWa = false;
     bool dshSupported = false;
 };
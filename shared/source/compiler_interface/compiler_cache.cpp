@@ -7,12 +7,16 @@
 
 #include "shared/source/compiler_interface/compiler_cache.h"
 
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/casts.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/file_io.h"
-#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 #include "shared/source/utilities/io_functions.h"
 
@@ -20,7 +24,6 @@
 #include "os_inc.h"
 
 #include <cstring>
-#include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -32,7 +35,7 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
                                                    const ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
-    Hash hash;
+    Hash128 hash;
 
     hash.update("----", 4);
     hash.update(&*igcRevision.begin(), igcRevision.size());
@@ -59,12 +62,8 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     const auto workaroundTableHashStr = std::to_string(hwInfo.workaroundTable.asHash());
     hash.update(workaroundTableHashStr.c_str(), workaroundTableHashStr.length());
 
-    auto res = hash.finish();
     std::stringstream stream;
-    stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
-           << std::hex
-           << res;
+    stream << hash.finish().toString();
 
     if (DebugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
@@ -133,6 +132,80 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 }
 
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
-    : config(cacheConfig){};
+    : config(cacheConfig) {
+    if (config.memoryTierSize > 0u) {
+        CompilerCacheMemoryTier::getInstance().reserve(config.memoryTierSize);
+    }
+};
+
+CompilerCache::~CompilerCache() {
+    if (DebugManager.flags.PrintBinaryCacheMemoryTierStatistics.get()) {
+        auto statistics = CompilerCacheMemoryTier::getInstance().getStatistics();
+        printDebugString(true, stdout, "Binary cache memory tier: hits: %llu, misses: %llu, evictions: %llu, used: %zu / %zu bytes\n",
+                         static_cast<unsigned long long>(statistics.hits), static_cast<unsigned long long>(statistics.misses),
+                         static_cast<unsigned long long>(statistics.evictions), statistics.usedSize, statistics.maxSize);
+    }
+}
+
+std::shared_ptr<const CachedBinary> CompilerCache::loadCachedBinaryView(const std::string &kernelFileHash) {
+    auto &memoryTier = CompilerCacheMemoryTier::getInstance();
+    if (config.memoryTierSize > 0u) {
+        auto binary = memoryTier.find(kernelFileHash);
+        if (binary != nullptr) {
+            return binary;
+        }
+    }
+
+    if (!config.enabled) {
+        return nullptr;
+    }
+
+    if (config.mapCachedBinaries) {
+        // mapped binaries bypass the memory tier so that the mapping lives only as long as its consumers
+        auto binary = mapCachedBinary(kernelFileHash);
+        if (binary != nullptr) {
+            return binary;
+        }
+    }
+
+    size_t binarySize = 0u;
+    auto binaryData = loadCachedBinary(kernelFileHash, binarySize);
+    if (binaryData == nullptr) {
+        return nullptr;
+    }
+
+    auto binary = std::make_shared<HeapCachedBinary>(std::move(binaryData), binarySize);
+    if (config.memoryTierSize > 0u) {
+        memoryTier.insert(kernelFileHash, binary);
+    }
+    return binary;
+}
+
+void CompilerCache::cacheBinaryInMemoryTier(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (config.memoryTierSize == 0u || pBinary == nullptr || binarySize == 0u) {
+        return;
+    }
+
+    CompilerCacheMemoryTier::getInstance().insert(kernelFileHash, std::make_shared<HeapCachedBinary>(makeCopy<char>(pBinary, binarySize), binarySize));
+}
+
+size_t getDefaultCompilerCacheMemoryTierSize() {
+    constexpr size_t defaultMemoryTierSize = 32 * MemoryConstants::megaByte;
+    if (DebugManager.flags.BinaryCacheMemoryTierSizeInMB.get() != -1) {
+        return static_cast<size_t>(DebugManager.flags.BinaryCacheMemoryTierSizeInMB.get()) * MemoryConstants::megaByte;
+    }
+    return defaultMemoryTierSize;
+}
+
+std::string CompilerCache::getPackFileBaseName() const {
+    std::string baseName = config.cacheFileExtension;
+    if (!baseName.empty() && baseName[0] == '.') {
+        baseName.erase(0, 1);
+    }
+    if (baseName.empty()) {
+        baseName = "compiler_cache";
+    }
+    return baseName;
+}
 
 } // namespace NEO
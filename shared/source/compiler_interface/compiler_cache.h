@@ -11,6 +11,7 @@
 #include "shared/source/utilities/arrayref.h"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -18,18 +19,30 @@
 
 namespace NEO {
 struct HardwareInfo;
+class CachedBinary;
+
+enum class CompilerCacheFormat {
+    filePerBinary,
+    indexedPack
+};
 
 struct CompilerCacheConfig {
     bool enabled = true;
     std::string cacheFileExtension;
     std::string cacheDir;
     size_t cacheSize = 0;
+    size_t memoryTierSize = 0;
+    bool mapCachedBinaries = false;
+    CompilerCacheFormat format = CompilerCacheFormat::filePerBinary;
+    bool sharedWithRuntime = false; // ocloc only, cache directory and keys are the same as in runtime
 };
 
+size_t getDefaultCompilerCacheMemoryTierSize();
+
 class CompilerCache {
   public:
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -47,11 +60,23 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
+    std::shared_ptr<const CachedBinary> loadCachedBinaryView(const std::string &kernelFileHash);
+    void cacheBinaryInMemoryTier(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+
   protected:
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
     MOCKABLE_VIRTUAL bool createUniqueTempFileAndWriteData(char *tmpFilePathTemplate, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL void lockConfigFileAndReadSize(const std::string &configFilePath, UnifiedHandle &fd, size_t &directorySize);
+    MOCKABLE_VIRTUAL std::shared_ptr<const CachedBinary> mapCachedBinary(const std::string &kernelFileHash);
+
+    std::string getPackFileBaseName() const;
+    bool cacheBinaryInPack(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    std::unique_ptr<char[]> loadCachedBinaryFromPack(const std::string &kernelFileHash, size_t &cachedBinarySize);
+    std::shared_ptr<const CachedBinary> mapCachedBinaryFromPack(const std::string &kernelFileHash);
+    bool processPackRecord(const std::string &kernelFileHash, const std::function<bool(int packFd, uint64_t binaryOffset, size_t binarySize, uint64_t sealedPackSize)> &recordProcessor);
+    int lockPackFile();
+    void unlockPackFile(int fd);
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+
+namespace NEO {
+
+CompilerCacheMemoryTier &CompilerCacheMemoryTier::getInstance() {
+    static CompilerCacheMemoryTier memoryTier;
+    return memoryTier;
+}
+
+std::shared_ptr<const CachedBinary> CompilerCacheMemoryTier::find(const std::string &kernelFileHash) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto it = entries.find(kernelFileHash);
+    if (it == entries.end()) {
+        statistics.misses++;
+        return nullptr;
+    }
+
+    statistics.hits++;
+    lruList.splice(lruList.begin(), lruList, it->second);
+    return it->second->second;
+}
+
+void CompilerCacheMemoryTier::insert(const std::string &kernelFileHash, std::shared_ptr<const CachedBinary> binary) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (binary == nullptr || binary->getSize() > statistics.maxSize || entries.find(kernelFileHash) != entries.end()) {
+        return;
+    }
+
+    evict(binary->getSize());
+    statistics.usedSize += binary->getSize();
+    lruList.emplace_front(kernelFileHash, std::move(binary));
+    entries[kernelFileHash] = lruList.begin();
+}
+
+void CompilerCacheMemoryTier::reserve(size_t maxSize) {
+    std::lock_guard<std::mutex> lock(mtx);
+    statistics.maxSize = maxSize;
+    evict(0u);
+}
+
+void CompilerCacheMemoryTier::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    entries.clear();
+    lruList.clear();
+    auto maxSize = statistics.maxSize;
+    statistics = {};
+    statistics.maxSize = maxSize;
+}
+
+CompilerCacheMemoryTier::Statistics CompilerCacheMemoryTier::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return statistics;
+}
+
+void CompilerCacheMemoryTier::evict(size_t requiredSize) {
+    while (!lruList.empty() && statistics.usedSize + requiredSize > statistics.maxSize) {
+        auto &oldest = lruList.back();
+        statistics.usedSize -= oldest.second->getSize();
+        statistics.evictions++;
+        entries.erase(oldest.first);
+        lruList.pop_back();
+    }
+}
+
+} // namespace NEO
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace NEO {
+
+class CachedBinary {
+  public:
+    virtual ~CachedBinary() = default;
+
+    ArrayRef<const char> getData() const {
+        return data;
+    }
+
+    size_t getSize() const {
+        return data.size();
+    }
+
+  protected:
+    ArrayRef<const char> data;
+};
+
+class HeapCachedBinary : public CachedBinary {
+  public:
+    HeapCachedBinary(std::unique_ptr<char[]> &&storage, size_t size) : storage(std::move(storage)) {
+        data = ArrayRef<const char>(this->storage.get(), size);
+    }
+
+  protected:
+    std::unique_ptr<char[]> storage;
+};
+
+class CompilerCacheMemoryTier {
+  public:
+    struct Statistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+        size_t usedSize = 0u;
+        size_t maxSize = 0u;
+    };
+
+    static CompilerCacheMemoryTier &getInstance();
+
+    std::shared_ptr<const CachedBinary> find(const std::string &kernelFileHash);
+    void insert(const std::string &kernelFileHash, std::shared_ptr<const CachedBinary> binary);
+    void reserve(size_t maxSize);
+    void clear();
+    Statistics getStatistics();
+
+  protected:
+    using LruList = std::list<std::pair<std::string, std::shared_ptr<const CachedBinary>>>;
+
+    void evict(size_t requiredSize);
+
+    std::mutex mtx;
+    LruList lruList;
+    std::unordered_map<std::string, LruList::iterator> entries;
+    Statistics statistics;
+};
+
+} // namespace NEO
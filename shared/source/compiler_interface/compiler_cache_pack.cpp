@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+namespace CompilerCachePack {
+
+uint32_t hashKey(const std::string &key) {
+    auto hash = Hash::hash(key.c_str(), key.size());
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+size_t getIndexSize(uint64_t capacity) {
+    return sizeof(IndexHeader) + static_cast<size_t>(capacity) * sizeof(IndexEntry);
+}
+
+void PackIndex::initialize(uint64_t capacity) {
+    UNRECOVERABLE_IF(getIndexSize(capacity) > memorySize);
+    memset(memory, 0, getIndexSize(capacity));
+
+    auto &header = getHeader();
+    header.magic = indexMagic;
+    header.version = indexVersion;
+    header.capacity = capacity;
+}
+
+bool PackIndex::isValid() const {
+    if (memory == nullptr || memorySize < sizeof(IndexHeader)) {
+        return false;
+    }
+    auto &header = getHeader();
+    if (header.magic != indexMagic || header.version != indexVersion) {
+        return false;
+    }
+    if (header.capacity == 0u || (header.capacity & (header.capacity - 1)) != 0u) {
+        return false;
+    }
+    return getIndexSize(header.capacity) <= memorySize && header.usedSlots <= header.capacity;
+}
+
+IndexEntry *PackIndex::find(const std::string &key) {
+    if (key.size() > maxKeyLength) {
+        return nullptr;
+    }
+
+    auto &header = getHeader();
+    auto entries = getEntries();
+    const auto keyHash = hashKey(key);
+    const auto mask = header.capacity - 1;
+
+    for (uint64_t probe = 0; probe < header.capacity; ++probe) {
+        auto &entry = entries[(keyHash + probe) & mask];
+        if (entry.state == EntryState::empty) {
+            return nullptr;
+        }
+        if (entry.state == EntryState::live && entry.keyHash == keyHash && strncmp(entry.key, key.c_str(), sizeof(entry.key)) == 0) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+IndexEntry *PackIndex::insert(const std::string &key, uint64_t offset, uint64_t size) {
+    if (key.size() > maxKeyLength || isFull()) {
+        return nullptr;
+    }
+
+    auto &header = getHeader();
+    auto entries = getEntries();
+    const auto keyHash = hashKey(key);
+    const auto mask = header.capacity - 1;
+
+    for (uint64_t probe = 0; probe < header.capacity; ++probe) {
+        auto &entry = entries[(keyHash + probe) & mask];
+        if (entry.state == EntryState::live) {
+            continue;
+        }
+        if (entry.state == EntryState::empty) {
+            header.usedSlots++;
+        }
+
+        memset(entry.key, 0, sizeof(entry.key));
+        memcpy_s(entry.key, sizeof(entry.key), key.c_str(), key.size());
+        entry.keyHash = keyHash;
+        entry.offset = offset;
+        entry.size = size;
+        entry.lastAccess = ++header.accessClock;
+        entry.state = EntryState::live;
+
+        header.liveEntries++;
+        header.liveBytes += size;
+        return &entry;
+    }
+    return nullptr;
+}
+
+void PackIndex::remove(IndexEntry *entry) {
+    auto &header = getHeader();
+    entry->state = EntryState::removed;
+    header.liveEntries--;
+    header.liveBytes -= entry->size;
+}
+
+void PackIndex::touch(IndexEntry *entry) {
+    entry->lastAccess = ++getHeader().accessClock;
+}
+
+bool PackIndex::isFull() const {
+    auto &header = getHeader();
+    return (header.usedSlots + 1) * 4 > header.capacity * 3;
+}
+
+bool PackIndex::copyLiveEntriesTo(PackIndex &dst) const {
+    auto &header = getHeader();
+    auto entries = getEntries();
+    for (uint64_t i = 0; i < header.capacity; ++i) {
+        auto &entry = entries[i];
+        if (entry.state != EntryState::live) {
+            continue;
+        }
+        auto newEntry = dst.insert(entry.key, entry.offset, entry.size);
+        if (newEntry == nullptr) {
+            return false;
+        }
+        newEntry->lastAccess = entry.lastAccess;
+    }
+    dst.getHeader().accessClock = std::max(dst.getHeader().accessClock, header.accessClock);
+    dst.getHeader().packFileSize = header.packFileSize;
+    return true;
+}
+
+std::vector<IndexEntry *> PackIndex::selectEntriesToEvict(uint64_t bytesToFree) {
+    auto &header = getHeader();
+    auto entries = getEntries();
+
+    std::vector<IndexEntry *> liveEntries;
+    liveEntries.reserve(static_cast<size_t>(header.liveEntries));
+    for (uint64_t i = 0; i < header.capacity; ++i) {
+        if (entries[i].state == EntryState::live) {
+            liveEntries.push_back(&entries[i]);
+        }
+    }
+
+    auto byLastAccess = [](const IndexEntry *a, const IndexEntry *b) {
+        return a->lastAccess < b->lastAccess;
+    };
+
+    // only the oldest entries needed to free bytesToFree get ordered; the sorted prefix is extended when the estimate falls short
+    const uint64_t averageEntrySize = liveEntries.empty() ? 1u : std::max<uint64_t>(header.liveBytes / liveEntries.size(), 1u);
+    uint64_t bytesSelected = 0u;
+    size_t count = 0u;
+    size_t sortedCount = 0u;
+    while (count < liveEntries.size() && bytesSelected < bytesToFree) {
+        if (count == sortedCount) {
+            const auto estimatedCount = (bytesToFree - bytesSelected) / averageEntrySize + 1u;
+            sortedCount += static_cast<size_t>(std::min<uint64_t>(estimatedCount, liveEntries.size() - sortedCount));
+            std::partial_sort(liveEntries.begin() + count, liveEntries.begin() + sortedCount, liveEntries.end(), byLastAccess);
+        }
+        bytesSelected += liveEntries[count]->size;
+        count++;
+    }
+    liveEntries.resize(count);
+    return liveEntries;
+}
+
+std::vector<IndexEntry *> PackIndex::getLiveEntriesSortedByOffset() {
+    auto &header = getHeader();
+    auto entries = getEntries();
+
+    std::vector<IndexEntry *> liveEntries;
+    liveEntries.reserve(static_cast<size_t>(header.liveEntries));
+    for (uint64_t i = 0; i < header.capacity; ++i) {
+        if (entries[i].state == EntryState::live) {
+            liveEntries.push_back(&entries[i]);
+        }
+    }
+
+    std::sort(liveEntries.begin(), liveEntries.end(), [](const IndexEntry *a, const IndexEntry *b) {
+        return a->offset < b->offset;
+    });
+    return liveEntries;
+}
+
+} // namespace CompilerCachePack
+} // namespace NEO
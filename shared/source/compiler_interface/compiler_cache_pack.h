@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace NEO {
+namespace CompilerCachePack {
+
+// Indexed pack layout:
+//  - <ext>.pack : append-only file of records, each one is PackRecordHeader followed by binary data
+//  - <ext>.idx  : memory-mapped, open-addressed hash table (IndexHeader followed by IndexEntry[capacity])
+// Size accounting and LRU information are kept in the index, so neither lookup nor eviction
+// needs to scan the cache directory.
+
+constexpr uint32_t indexMagic = 0x58444e49;  // "INDX"
+constexpr uint32_t recordMagic = 0x4b434150; // "PACK"
+constexpr uint32_t indexVersion = 1u;
+constexpr uint64_t initialCapacity = 1024u;
+constexpr size_t maxKeyLength = 47u;
+
+enum class EntryState : uint32_t {
+    empty = 0,
+    live,
+    removed
+};
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t capacity;
+    uint64_t usedSlots;
+    uint64_t liveEntries;
+    uint64_t liveBytes;
+    uint64_t packFileSize;
+    uint64_t accessClock;
+};
+static_assert(sizeof(IndexHeader) == 56, "");
+
+struct IndexEntry {
+    char key[maxKeyLength + 1];
+    uint64_t offset;
+    uint64_t size;
+    uint64_t lastAccess;
+    EntryState state;
+    uint32_t keyHash;
+};
+static_assert(sizeof(IndexEntry) == 80, "");
+
+struct PackRecordHeader {
+    uint32_t magic;
+    uint32_t keyHash;
+    uint64_t size;
+};
+static_assert(sizeof(PackRecordHeader) == 16, "");
+
+uint32_t hashKey(const std::string &key);
+size_t getIndexSize(uint64_t capacity);
+
+class PackIndex {
+  public:
+    PackIndex(uint8_t *memory, size_t memorySize) : memory(memory), memorySize(memorySize) {}
+
+    void initialize(uint64_t capacity);
+    bool isValid() const;
+
+    IndexEntry *find(const std::string &key);
+    IndexEntry *insert(const std::string &key, uint64_t offset, uint64_t size);
+    void remove(IndexEntry *entry);
+    void touch(IndexEntry *entry);
+
+    bool isFull() const;
+    bool copyLiveEntriesTo(PackIndex &dst) const;
+    std::vector<IndexEntry *> selectEntriesToEvict(uint64_t bytesToFree);
+    std::vector<IndexEntry *> getLiveEntriesSortedByOffset();
+
+    IndexHeader &getHeader() const {
+        return *reinterpret_cast<IndexHeader *>(memory);
+    }
+
+  protected:
+    IndexEntry *getEntries() const {
+        return reinterpret_cast<IndexEntry *>(memory + sizeof(IndexHeader));
+    }
+
+    uint8_t *memory = nullptr;
+    size_t memorySize = 0u;
+};
+
+} // namespace CompilerCachePack
+} // namespace NEO
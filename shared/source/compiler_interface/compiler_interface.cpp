@@ -9,6 +9,7 @@
 
 #include "shared/source/built_ins/sip_kernel_type.h"
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_interface.inl"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/igc_platform_helper.h"
@@ -30,7 +31,7 @@
 #include <fstream>
 
 namespace NEO {
-SpinLock CompilerInterface::spinlock;
+std::mutex CompilerInterface::serializedTranslationMtx;
 
 enum CachingMode {
     None,
@@ -51,6 +52,9 @@ void TranslationOutput::makeCopy(MemAndSize &dst, CIF::Builtins::BufferSimple *s
 
 CompilerInterface::CompilerInterface()
     : cache() {
+    if (DebugManager.flags.CompilerConcurrencyMode.get() != -1) {
+        concurrencyMode = static_cast<CompilerConcurrencyMode>(DebugManager.flags.CompilerConcurrencyMode.get());
+    }
 }
 CompilerInterface::~CompilerInterface() = default;
 
@@ -62,6 +66,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto translationLock = lockTranslation();
+
     IGC::CodeType::CodeType_t srcCodeType = input.srcType;
     IGC::CodeType::CodeType_t intermediateCodeType = IGC::CodeType::undefined;
 
@@ -71,7 +77,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     CachingMode cachingMode = None;
 
-    if (cache != nullptr && cache->getConfig().enabled) {
+    if (cache != nullptr && (cache->getConfig().enabled || cache->getConfig().memoryTierSize > 0u)) {
         if ((srcCodeType == IGC::CodeType::oclC) && (std::strstr(input.src.begin(), "#include") == nullptr)) {
             cachingMode = CachingMode::Direct;
         } else {
@@ -85,8 +91,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
                                                   input.src,
                                                   input.apiOptions,
                                                   input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+        if (loadCachedDeviceBinary(kernelFileHash, input, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -141,8 +146,7 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), irRef,
                                                   input.apiOptions,
                                                   input.internalOptions, specIdsRef, specValuesRef, igcRevision, igcLibSize, igcLibMTime);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
-        if (output.deviceBinary.mem) {
+        if (loadCachedDeviceBinary(kernelFileHash, input, output)) {
             return TranslationOutput::ErrorCode::Success;
         }
     }
@@ -162,8 +166,11 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         return TranslationOutput::ErrorCode::BuildFailure;
     }
 
-    if (cache != nullptr && cache->getConfig().enabled) {
-        cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+    if (cachingMode != CachingMode::None) {
+        if (cache->getConfig().enabled) {
+            cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+        }
+        cache->cacheBinaryInMemoryTier(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), igcOutput->GetOutput()->GetSize<char>());
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -172,6 +179,21 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     return TranslationOutput::ErrorCode::Success;
 }
 
+bool CompilerInterface::loadCachedDeviceBinary(const std::string &kernelFileHash, const TranslationInput &input, TranslationOutput &output) {
+    auto cachedBinary = cache->loadCachedBinaryView(kernelFileHash);
+    if (cachedBinary == nullptr) {
+        return false;
+    }
+
+    output.deviceBinary.size = cachedBinary->getSize();
+    if (input.allowCachedBinaryView) {
+        output.cachedDeviceBinary = std::move(cachedBinary);
+        return true;
+    }
+    output.deviceBinary.mem = makeCopy<char>(cachedBinary->getData().begin(), cachedBinary->getSize());
+    return true;
+}
+
 TranslationOutput::ErrorCode CompilerInterface::compile(
     const NEO::Device &device,
     const TranslationInput &input,
@@ -185,6 +207,8 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto translationLock = lockTranslation();
+
     auto outType = input.outType;
 
     if (outType == IGC::CodeType::undefined) {
@@ -224,6 +248,8 @@ TranslationOutput::ErrorCode CompilerInterface::link(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto translationLock = lockTranslation();
+
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -270,6 +296,8 @@ TranslationOutput::ErrorCode CompilerInterface::getSpecConstantsInfo(const NEO::
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto translationLock = lockTranslation();
+
     auto igcTranslationCtx = createIgcTranslationCtx(device, IGC::CodeType::spirV, IGC::CodeType::oclGenBin);
 
     auto inSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), srcSpirV.begin(), srcSpirV.size());
@@ -293,6 +321,8 @@ TranslationOutput::ErrorCode CompilerInterface::createLibrary(
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
 
+    auto translationLock = lockTranslation();
+
     auto igcSrc = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.src.begin(), input.src.size());
     auto igcOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto igcInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -345,6 +375,8 @@ TranslationOutput::ErrorCode CompilerInterface::getSipKernelBinary(NEO::Device &
         break;
     }
 
+    auto translationLock = lockTranslation();
+
     auto deviceCtx = getIgcDeviceCtx(device);
 
     if (deviceCtx == nullptr) {
@@ -494,7 +526,7 @@ CIF::RAII::UPtr_t<IGC::FclOclTranslationCtxTagOCL> CompilerInterface::createFclT
         return nullptr;
     }
 
-    if (fclBaseTranslationCtx == nullptr) {
+    {
         auto ulock = this->lock();
         if (fclBaseTranslationCtx == nullptr) {
             fclBaseTranslationCtx = deviceCtx->CreateTranslationCtx(inType, outType);
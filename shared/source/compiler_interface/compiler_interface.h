@@ -15,22 +15,31 @@
 #include "ocl_igc_interface/igc_ocl_device_ctx.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 namespace NEO {
 enum class SipKernelType : std::uint32_t;
 class OsLibrary;
+class CachedBinary;
 class CompilerCache;
 class Device;
 
 using specConstValuesMap = std::unordered_map<uint32_t, uint64_t>;
 
+enum class CompilerConcurrencyMode : int32_t {
+    serialized = 0,
+    concurrent = 1
+};
+
 struct TranslationInput {
     TranslationInput(IGC::CodeType::CodeType_t srcType, IGC::CodeType::CodeType_t outType, IGC::CodeType::CodeType_t preferredIntermediateType = IGC::CodeType::undefined)
         : srcType(srcType), preferredIntermediateType(preferredIntermediateType), outType(outType) {
     }
 
     bool allowCaching = true;
+    bool allowCachedBinaryView = false;
 
     ArrayRef<const char> src;
     ArrayRef<const char> apiOptions;
@@ -65,6 +74,7 @@ struct TranslationOutput {
     MemAndSize intermediateRepresentation;
     MemAndSize deviceBinary;
     MemAndSize debugData;
+    std::shared_ptr<const CachedBinary> cachedDeviceBinary;
     std::string frontendCompilerLog;
     std::string backendCompilerLog;
 
@@ -131,6 +141,10 @@ class CompilerInterface {
     bool addOptionDisableZebin(std::string &options, std::string &internalOptions);
     bool disableZebin(std::string &options, std::string &internalOptions);
 
+    CompilerConcurrencyMode getConcurrencyMode() const {
+        return concurrencyMode;
+    }
+
   protected:
     MOCKABLE_VIRTUAL bool initialize(std::unique_ptr<CompilerCache> &&cache, bool requireFcl);
     MOCKABLE_VIRTUAL bool loadFcl();
@@ -143,11 +157,24 @@ class CompilerInterface {
     bool checkIcbeVersionOnce(CIF::CIFMain *main, const char *libName);
 
     bool verifyIcbeVersion();
+    bool loadCachedDeviceBinary(const std::string &kernelFileHash, const TranslationInput &input, TranslationOutput &output);
 
-    static SpinLock spinlock;
+    SpinLock spinlock;
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<SpinLock> lock() {
         return std::unique_lock<SpinLock>{spinlock};
     }
+
+    // Taken only in CompilerConcurrencyMode::serialized. Static, because a compiler library that is not thread-safe
+    // is loaded once per process and shared by the compiler interfaces of all root device environments.
+    static std::mutex serializedTranslationMtx;
+    [[nodiscard]] std::unique_lock<std::mutex> lockTranslation() {
+        if (concurrencyMode == CompilerConcurrencyMode::serialized) {
+            return std::unique_lock<std::mutex>{serializedTranslationMtx};
+        }
+        return std::unique_lock<std::mutex>{};
+    }
+    CompilerConcurrencyMode concurrencyMode = CompilerConcurrencyMode::concurrent;
+
     std::unique_ptr<CompilerCache> cache;
 
     using igcDevCtxUptr = CIF::RAII::UPtr_t<IGC::IgcOclDeviceCtxTagOCL>;
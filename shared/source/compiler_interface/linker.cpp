@@ -9,8 +9,10 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
@@ -22,6 +24,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "RelocationInfo.h"
 
@@ -127,6 +130,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
         relocInfo.symbolName = relocEntryIt->r_symbol;
+        relocInfo.symbolId = internRelocationSymbolName(relocInfo.symbolName);
         relocInfo.relocationSegment = SegmentType::Instructions;
         switch (relocEntryIt->r_type) {
         default:
@@ -156,6 +160,7 @@ void LinkerInput::addDataRelocationInfo(const RelocationInfo &relocationInfo) {
     this->traits.requiresPatchingOfGlobalVariablesBuffer |= (relocationInfo.relocationSegment == SegmentType::GlobalVariables);
     this->traits.requiresPatchingOfGlobalConstantsBuffer |= (relocationInfo.relocationSegment == SegmentType::GlobalConstants);
     this->dataRelocations.push_back(relocationInfo);
+    this->dataRelocations.rbegin()->symbolId = internRelocationSymbolName(relocationInfo.symbolName);
 }
 
 void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uint32_t instructionsSegmentId) {
@@ -169,10 +174,18 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
 
     relocationInfo.relocationSegment = SegmentType::Instructions;
+    relocationInfo.symbolId = internRelocationSymbolName(relocationInfo.symbolName);
 
     outRelocInfo.push_back(std::move(relocationInfo));
 }
 
+uint32_t LinkerInput::internRelocationSymbolName(const std::string &symbolName) {
+    if (symbolName.empty()) {
+        return std::numeric_limits<uint32_t>::max();
+    }
+    return relocationSymbolIds.emplace(symbolName, static_cast<uint32_t>(relocationSymbolIds.size())).first->second;
+}
+
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_32> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_32>::RelocationInfo &reloc);
 template bool LinkerInput::addRelocation(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId, const typename Elf::Elf<Elf::EI_CLASS_64>::RelocationInfo &reloc);
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
@@ -317,6 +330,7 @@ LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const Segm
                            ExternalFunctionsT &externalFunctions) {
     bool success = data.isValid();
     auto initialUnresolvedExternalsCount = outUnresolvedExternals.size();
+    this->threadPool = pDevice ? pDevice->getExecutionEnvironment()->getBuildThreadPool() : nullptr;
     success = success && relocateSymbols(globalVariablesSegInfo, globalConstantsSegInfo, exportedFunctionsSegInfo, globalStringsSegInfo, instructionsSegments, constantsInitDataSize, variablesInitDataSize);
     if (!success) {
         return LinkingStatus::Error;
@@ -387,9 +401,26 @@ bool Linker::relocateSymbols(const SegmentInfo &globalVariables, const SegmentIn
             relocatedSymbols[symbolName] = {symbolInfo, seg->gpuAddress + offset};
         }
     }
+
+    // relocations refer to symbols by interned ids, so that patching does not hash symbol names
+    relocatedSymbolsById.assign(data.getRelocationSymbolIds().size(), nullptr);
+    for (const auto &[symbolName, symbolId] : data.getRelocationSymbolIds()) {
+        auto symbolIt = relocatedSymbols.find(symbolName);
+        if (symbolIt != relocatedSymbols.end()) {
+            relocatedSymbolsById[symbolId] = &symbolIt->second;
+        }
+    }
     return true;
 }
 
+const Linker::RelocatedSymbol<SymbolInfo> *Linker::findRelocatedSymbol(const RelocationInfo &relocation) const {
+    if (relocation.symbolId < relocatedSymbolsById.size()) {
+        return relocatedSymbolsById[relocation.symbolId];
+    }
+    auto symbolIt = relocatedSymbols.find(relocation.symbolName);
+    return (symbolIt != relocatedSymbols.end()) ? &symbolIt->second : nullptr;
+}
+
 uint32_t addressSizeInBytes(LinkerInput::RelocationInfo::Type relocationtype) {
     return (relocationtype == LinkerInput::RelocationInfo::Type::Address) ? sizeof(uintptr_t) : sizeof(uint32_t);
 }
@@ -410,6 +441,7 @@ void Linker::patchAddress(void *relocAddress, const uint64_t value, const Linker
 }
 
 void Linker::removeLocalSymbolsFromRelocatedSymbols() {
+    relocatedSymbolsById.clear();
     auto it = relocatedSymbols.begin();
     while (it != relocatedSymbols.end()) {
         if (false == it->second.symbol.global) {
@@ -427,38 +459,79 @@ void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &inst
 
     auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
     UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
+
+    // segments are patched independently, results are merged in segment order to keep them deterministic
+    std::vector<UnresolvedExternals> unresolvedExternalsPerSegment(relocationsPerSegment.size());
+    std::vector<StackVec<uint32_t *, 2>> implicitArgsRelocationAddressesPerSegment(relocationsPerSegment.size());
+    auto patchSegment = [&](size_t segId) {
+        patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], unresolvedExternalsPerSegment[segId],
+                                 implicitArgsRelocationAddressesPerSegment[segId], kernelDescriptors);
+    };
+
+    size_t relocationsCount = 0u;
+    for (const auto &relocations : relocationsPerSegment) {
+        relocationsCount += relocations.size();
+    }
+    if (isParallelPatchingEnabled(relocationsCount) && relocationsPerSegment.size() > 1u) {
+        threadPool->parallelFor(relocationsPerSegment.size(), patchSegment);
+    } else {
+        for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
+            patchSegment(segId);
+        }
+    }
+
     for (size_t segId = 0U; segId < relocationsPerSegment.size(); segId++) {
-        auto &segment = instructionsSegments[segId];
-        for (const auto &relocation : relocationsPerSegment[segId]) {
-            UNRECOVERABLE_IF(nullptr == segment.hostPointer);
-            bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
-            if (invalidRelocation) {
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                DEBUG_BREAK_IF(true);
-                continue;
-            }
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), unresolvedExternalsPerSegment[segId].begin(), unresolvedExternalsPerSegment[segId].end());
+        for (auto relocAddress : implicitArgsRelocationAddressesPerSegment[segId]) {
+            pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(relocAddress);
+        }
+    }
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, UnresolvedExternals &outUnresolvedExternals,
+                                      StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors) {
+    for (const auto &relocation : data.getRelocationsInInstructionSegments()[segId]) {
+        UNRECOVERABLE_IF(nullptr == segment.hostPointer);
+        bool invalidRelocation = relocation.offset + addressSizeInBytes(relocation.type) > segment.segmentSize;
+        if (invalidRelocation) {
+            outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
+            DEBUG_BREAK_IF(true);
+            continue;
+        }
 
-            auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
-            } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                pImplicitArgsRelocationAddresses[static_cast<uint32_t>(segId)].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-            } else if (relocation.symbolName.empty()) {
-                uint64_t patchValue = 0;
+        auto relocAddress = ptrOffset(segment.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
+            kernelDescriptors.at(segId)->decodeDeferredMetadata();
+            *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
+        } else if (relocation.symbolName == implicitArgsRelocationSymbolName) {
+            kernelDescriptors.at(segId)->decodeDeferredMetadata();
+            outImplicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+        } else if (relocation.symbolName.empty()) {
+            uint64_t patchValue = 0;
+            patchAddress(relocAddress, patchValue, relocation);
+        } else {
+            auto relocatedSymbol = findRelocatedSymbol(relocation);
+            if (relocatedSymbol != nullptr) {
+                uint64_t patchValue = relocatedSymbol->gpuAddress + relocation.addend;
                 patchAddress(relocAddress, patchValue, relocation);
             } else {
-                auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-                if (symbolIt != relocatedSymbols.end()) {
-                    uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-                    patchAddress(relocAddress, patchValue, relocation);
-                } else {
-                    outUnresolvedExternals.push_back(UnresolvedExternal{relocation, static_cast<uint32_t>(segId), invalidRelocation});
-                }
+                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidRelocation});
             }
         }
     }
 }
 
+bool Linker::isParallelPatchingEnabled(size_t relocationsCount) const {
+    if (nullptr == threadPool) {
+        return false;
+    }
+    constexpr size_t minRelocationsCountForParallelPatching = 4096u;
+    if (DebugManager.flags.ParallelLinkerPatching.get() != -1) {
+        return !!DebugManager.flags.ParallelLinkerPatching.get();
+    }
+    return relocationsCount >= minRelocationsCountForParallelPatching;
+}
+
 void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                                GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
                                std::vector<UnresolvedExternal> &outUnresolvedExternals, Device *pDevice,
@@ -470,12 +543,12 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     bool isAnyRelocationPerformed = false;
 
     for (const auto &relocation : data.getDataRelocations()) {
-        auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-        if (symbolIt == relocatedSymbols.end()) {
+        auto relocatedSymbol = findRelocatedSymbol(relocation);
+        if (relocatedSymbol == nullptr) {
             outUnresolvedExternals.push_back(UnresolvedExternal{relocation});
             continue;
         }
-        uint64_t srcGpuAddressAs64Bit = symbolIt->second.gpuAddress;
+        uint64_t srcGpuAddressAs64Bit = relocatedSymbol->gpuAddress;
 
         ArrayRef<uint8_t> dst{};
         const void *initData = nullptr;
@@ -631,6 +704,9 @@ bool Linker::resolveExternalFunctions(const KernelDescriptorsT &kernelDescriptor
     toPtrVec(data.getFunctionDependencies(), functionDependenciesPtrs);
     toPtrVec(data.getKernelDependencies(), kernelDependenciesPtrs);
     for (auto &kd : kernelDescriptors) {
+        if (false == kd->decodeDeferredMetadata()) {
+            return false;
+        }
         nameToKernelDescriptor[kd->kernelMetadata.kernelName] = kd;
     }
 
@@ -23,6 +23,7 @@ struct ExternalFunctionUsageKernel;
 
 class Device;
 class GraphicsAllocation;
+class ThreadPool;
 struct KernelDescriptor;
 struct ProgramInfo;
 
@@ -96,6 +97,7 @@ struct LinkerInput {
         };
 
         std::string symbolName;
+        uint32_t symbolId = std::numeric_limits<uint32_t>::max(); // interned symbolName, set if relocation was added through LinkerInput
         uint64_t offset = std::numeric_limits<uint64_t>::max();
         Type type = Type::Unknown;
         SegmentType relocationSegment = SegmentType::Unknown;
@@ -106,6 +108,7 @@ struct LinkerInput {
     using Relocations = std::vector<RelocationInfo>;
     using SymbolMap = std::unordered_map<std::string, SymbolInfo>;
     using RelocationsPerInstSegment = std::vector<Relocations>;
+    using SymbolIdsMap = std::unordered_map<std::string, uint32_t>;
 
     virtual ~LinkerInput() = default;
 
@@ -157,6 +160,10 @@ struct LinkerInput {
         return dataRelocations;
     }
 
+    const SymbolIdsMap &getRelocationSymbolIds() const {
+        return relocationSymbolIds;
+    }
+
     void setPointerSize(Traits::PointerSize pointerSize) {
         traits.pointerSize = pointerSize;
     }
@@ -175,12 +182,14 @@ struct LinkerInput {
 
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    uint32_t internRelocationSymbolName(const std::string &symbolName);
 
     Traits traits;
     SymbolMap symbols;
     std::vector<std::pair<std::string, SymbolInfo>> extFuncSymbols;
     Relocations dataRelocations;
     RelocationsPerInstSegment textRelocations;
+    SymbolIdsMap relocationSymbolIds;
     std::vector<ExternalFunctionUsageKernel> kernelDependencies;
     std::vector<ExternalFunctionUsageExtFunc> extFunDependencies;
     int32_t exportedFunctionsSegmentId = -1;
@@ -234,6 +243,7 @@ struct Linker {
     static void patchAddress(void *relocAddress, const uint64_t value, const RelocationInfo &relocation);
     void removeLocalSymbolsFromRelocatedSymbols();
     RelocatedSymbolsMap extractRelocatedSymbols() {
+        relocatedSymbolsById.clear();
         return RelocatedSymbolsMap(std::move(relocatedSymbols));
     }
 
@@ -245,10 +255,17 @@ struct Linker {
   protected:
     const LinkerInput &data;
     RelocatedSymbolsMap relocatedSymbols;
+    std::vector<const RelocatedSymbol<SymbolInfo> *> relocatedSymbolsById; // indexed with RelocationInfo::symbolId, nullptr if symbol was not relocated
+    ThreadPool *threadPool = nullptr;
 
     bool relocateSymbols(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments, size_t globalConstantsInitDataSize, size_t globalVariablesInitDataSize);
 
+    const RelocatedSymbol<SymbolInfo> *findRelocatedSymbol(const RelocationInfo &relocation) const;
+
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &segment, UnresolvedExternals &outUnresolvedExternals,
+                                  StackVec<uint32_t *, 2> &outImplicitArgsRelocationAddresses, const KernelDescriptorsT &kernelDescriptors);
+    bool isParallelPatchingEnabled(size_t relocationsCount) const;
 
     void patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo,
                            GraphicsAllocation *globalVariablesSeg, GraphicsAllocation *globalConstantsSeg,
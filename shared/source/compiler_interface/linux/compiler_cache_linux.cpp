@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_mapped_binary.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/file_io.h"
@@ -207,6 +208,10 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
         return false;
     }
 
+    if (config.format == CompilerCacheFormat::indexedPack) {
+        return cacheBinaryInPack(kernelFileHash, pBinary, binarySize);
+    }
+
     std::unique_lock<std::mutex> lock(cacheAccessMtx);
     constexpr std::string_view configFileName = "config.file";
 
@@ -262,8 +267,38 @@ bool CompilerCache::cacheBinary(const std::string &kernelFileHash, const char *p
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (config.format == CompilerCacheFormat::indexedPack) {
+        auto binary = loadCachedBinaryFromPack(kernelFileHash, cachedBinarySize);
+        if (binary != nullptr) {
+            return binary;
+        }
+    }
+
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
 
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
+
+std::shared_ptr<const CachedBinary> CompilerCache::mapCachedBinary(const std::string &kernelFileHash) {
+    if (config.format == CompilerCacheFormat::indexedPack) {
+        auto binary = mapCachedBinaryFromPack(kernelFileHash);
+        if (binary != nullptr) {
+            return binary;
+        }
+    }
+
+    std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
+    int fd = NEO::SysCalls::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    std::shared_ptr<const CachedBinary> binary;
+    struct stat statbuf = {};
+    if (NEO::SysCalls::fstat(fd, &statbuf) == 0 && statbuf.st_size > 0) {
+        binary = MappedCachedBinary::create(fd, 0u, static_cast<size_t>(statbuf.st_size));
+    }
+    NEO::SysCalls::close(fd);
+    return binary;
+}
 } // namespace NEO
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/linux/compiler_cache_mapped_binary.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <sys/mman.h>
+
+namespace NEO {
+
+std::shared_ptr<const CachedBinary> MappedCachedBinary::create(int fd, uint64_t offset, size_t size) {
+    if (fd < 0 || size == 0u) {
+        return nullptr;
+    }
+
+    const auto alignedOffset = alignDown(offset, MemoryConstants::pageSize);
+    const auto offsetInMapping = static_cast<size_t>(offset - alignedOffset);
+    const auto mappingSize = offsetInMapping + size;
+
+    auto mapping = NEO::SysCalls::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+    if (mapping == MAP_FAILED || mapping == nullptr) {
+        return nullptr;
+    }
+
+    return std::shared_ptr<const CachedBinary>(new MappedCachedBinary(mapping, mappingSize, offsetInMapping, size));
+}
+
+MappedCachedBinary::MappedCachedBinary(void *mapping, size_t mappingSize, size_t offsetInMapping, size_t size)
+    : mapping(mapping), mappingSize(mappingSize) {
+    data = ArrayRef<const char>(reinterpret_cast<const char *>(ptrOffset(mapping, offsetInMapping)), size);
+}
+
+MappedCachedBinary::~MappedCachedBinary() {
+    NEO::SysCalls::munmap(mapping, mappingSize);
+}
+
+} // namespace NEO
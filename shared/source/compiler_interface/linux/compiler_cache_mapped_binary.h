@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+class MappedCachedBinary : public CachedBinary {
+  public:
+    static std::shared_ptr<const CachedBinary> create(int fd, uint64_t offset, size_t size);
+    ~MappedCachedBinary() override;
+
+  protected:
+    MappedCachedBinary(void *mapping, size_t mappingSize, size_t offsetInMapping, size_t size);
+
+    void *mapping = nullptr;
+    size_t mappingSize = 0u;
+};
+
+} // namespace NEO
@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_mapped_binary.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <vector>
+
+namespace NEO {
+using namespace CompilerCachePack;
+
+namespace {
+constexpr int packFileMode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH;
+
+struct MappedPackIndex {
+    ~MappedPackIndex() {
+        unmap();
+    }
+
+    bool map(const std::string &indexPath) {
+        fd = NEO::SysCalls::open(indexPath.c_str(), O_RDWR);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat statbuf = {};
+        if (NEO::SysCalls::fstat(fd, &statbuf) != 0 || static_cast<size_t>(statbuf.st_size) < sizeof(IndexHeader)) {
+            unmap();
+            return false;
+        }
+
+        size = static_cast<size_t>(statbuf.st_size);
+        auto ptr = NEO::SysCalls::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED) {
+            unmap();
+            return false;
+        }
+        memory = reinterpret_cast<uint8_t *>(ptr);
+
+        if (!getIndex().isValid()) {
+            unmap();
+            return false;
+        }
+        return true;
+    }
+
+    void unmap() {
+        if (memory != nullptr) {
+            NEO::SysCalls::munmap(memory, size);
+            memory = nullptr;
+        }
+        if (fd >= 0) {
+            NEO::SysCalls::close(fd);
+            fd = -1;
+        }
+        size = 0u;
+    }
+
+    PackIndex getIndex() {
+        return PackIndex(memory, size);
+    }
+
+    uint8_t *memory = nullptr;
+    size_t size = 0u;
+    int fd = -1;
+};
+
+bool writeNewFile(const std::string &cacheDir, const std::string &dstPath, const void *data, size_t dataSize) {
+    std::string tmpFilePath = joinPath(cacheDir, "pack_cache.XXXXXX");
+    int fd = NEO::SysCalls::mkstemp(tmpFilePath.data());
+    if (fd < 0) {
+        return false;
+    }
+
+    bool success = dataSize == 0u || NEO::SysCalls::pwrite(fd, data, dataSize, 0) == static_cast<ssize_t>(dataSize);
+    success &= NEO::SysCalls::close(fd) == 0;
+    success = success && NEO::SysCalls::rename(tmpFilePath.c_str(), dstPath.c_str()) == 0;
+
+    if (!success) {
+        NEO::SysCalls::unlink(tmpFilePath);
+    }
+    return success;
+}
+
+bool rebuildIndex(const std::string &cacheDir, const std::string &indexPath, PackIndex *srcIndex, uint64_t capacity) {
+    std::vector<uint8_t> indexData(getIndexSize(capacity));
+    PackIndex newIndex(indexData.data(), indexData.size());
+    newIndex.initialize(capacity);
+
+    if (srcIndex != nullptr && !srcIndex->copyLiveEntriesTo(newIndex)) {
+        return false;
+    }
+
+    return writeNewFile(cacheDir, indexPath, indexData.data(), indexData.size());
+}
+
+bool compactPack(const std::string &cacheDir, const std::string &packPath, PackIndex &index) {
+    int srcFd = NEO::SysCalls::open(packPath.c_str(), O_RDONLY);
+    if (srcFd < 0) {
+        return false;
+    }
+
+    std::string tmpFilePath = joinPath(cacheDir, "pack_cache.XXXXXX");
+    int dstFd = NEO::SysCalls::mkstemp(tmpFilePath.data());
+    if (dstFd < 0) {
+        NEO::SysCalls::close(srcFd);
+        return false;
+    }
+
+    auto liveEntries = index.getLiveEntriesSortedByOffset();
+    std::vector<uint64_t> newOffsets;
+    newOffsets.reserve(liveEntries.size());
+
+    constexpr size_t copyChunkSize = 4 * MemoryConstants::megaByte;
+    std::vector<char> chunk;
+    uint64_t dstOffset = 0u;
+    bool success = true;
+    for (auto entry : liveEntries) {
+        const uint64_t recordSize = sizeof(PackRecordHeader) + entry->size;
+        newOffsets.push_back(dstOffset);
+        for (uint64_t copied = 0u; success && copied < recordSize;) {
+            const auto bytesToCopy = static_cast<size_t>(std::min<uint64_t>(copyChunkSize, recordSize - copied));
+            chunk.resize(std::max(chunk.size(), bytesToCopy));
+            success = NEO::SysCalls::pread(srcFd, chunk.data(), bytesToCopy, static_cast<off_t>(entry->offset + copied)) == static_cast<ssize_t>(bytesToCopy) &&
+                      NEO::SysCalls::pwrite(dstFd, chunk.data(), bytesToCopy, static_cast<off_t>(dstOffset + copied)) == static_cast<ssize_t>(bytesToCopy);
+            copied += bytesToCopy;
+        }
+        if (!success) {
+            break;
+        }
+        dstOffset += recordSize;
+    }
+    NEO::SysCalls::close(srcFd);
+    success &= NEO::SysCalls::close(dstFd) == 0;
+    success = success && NEO::SysCalls::rename(tmpFilePath.c_str(), packPath.c_str()) == 0;
+
+    if (!success) {
+        NEO::SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+
+    for (size_t i = 0; i < liveEntries.size(); ++i) {
+        liveEntries[i]->offset = newOffsets[i];
+    }
+    index.getHeader().packFileSize = dstOffset;
+    return true;
+}
+
+} // namespace
+
+int CompilerCache::lockPackFile() {
+    auto lockFilePath = joinPath(config.cacheDir, getPackFileBaseName() + ".lock");
+    int fd = NEO::SysCalls::openWithMode(lockFilePath.c_str(), O_CREAT | O_RDWR, packFileMode);
+    if (fd < 0) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open pack lock file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        return -1;
+    }
+
+    if (NEO::SysCalls::flock(fd, LOCK_EX) < 0) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Lock pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        NEO::SysCalls::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void CompilerCache::unlockPackFile(int fd) {
+    NEO::SysCalls::flock(fd, LOCK_UN);
+    NEO::SysCalls::close(fd);
+}
+
+bool CompilerCache::cacheBinaryInPack(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    if (kernelFileHash.size() > maxKeyLength || binarySize > config.cacheSize) {
+        return false;
+    }
+
+    const auto baseName = getPackFileBaseName();
+    const auto indexPath = joinPath(config.cacheDir, baseName + ".idx");
+    const auto packPath = joinPath(config.cacheDir, baseName + ".pack");
+
+    std::lock_guard<std::mutex> lock(cacheAccessMtx);
+    int lockFd = lockPackFile();
+    if (lockFd < 0) {
+        return false;
+    }
+
+    MappedPackIndex mappedIndex;
+    if (!mappedIndex.map(indexPath)) {
+        // records of a pack without a valid index cannot be located, so the pack is replaced by an empty one before the new index starts appending at offset 0
+        if (!writeNewFile(config.cacheDir, packPath, nullptr, 0u) || !rebuildIndex(config.cacheDir, indexPath, nullptr, initialCapacity) || !mappedIndex.map(indexPath)) {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Creating pack index failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+            unlockPackFile(lockFd);
+            return false;
+        }
+    }
+
+    auto index = mappedIndex.getIndex();
+    if (index.find(kernelFileHash) != nullptr) {
+        unlockPackFile(lockFd);
+        return true;
+    }
+
+    if (index.isFull()) {
+        const auto capacity = index.getHeader().capacity;
+        const auto newCapacity = (index.getHeader().liveEntries + 1) * 2 > capacity ? capacity * 2 : capacity;
+        if (!rebuildIndex(config.cacheDir, indexPath, &index, newCapacity)) {
+            unlockPackFile(lockFd);
+            return false;
+        }
+        mappedIndex.unmap();
+        if (!mappedIndex.map(indexPath)) {
+            unlockPackFile(lockFd);
+            return false;
+        }
+        index = mappedIndex.getIndex();
+    }
+
+    auto &header = index.getHeader();
+    if (header.liveBytes + binarySize > config.cacheSize) {
+        const uint64_t bytesToFree = std::max<uint64_t>(header.liveBytes + binarySize - config.cacheSize, config.cacheSize / 3);
+        for (auto entry : index.selectEntriesToEvict(bytesToFree)) {
+            index.remove(entry);
+        }
+    }
+
+    const uint64_t liveRecordsSize = header.liveBytes + header.liveEntries * sizeof(PackRecordHeader);
+    if (header.packFileSize > 2 * liveRecordsSize + binarySize) {
+        if (!compactPack(config.cacheDir, packPath, index)) {
+            NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Compacting pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        }
+    }
+
+    int packFd = NEO::SysCalls::openWithMode(packPath.c_str(), O_CREAT | O_RDWR, packFileMode);
+    if (packFd < 0) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Open pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        unlockPackFile(lockFd);
+        return false;
+    }
+
+    // records are only ever appended past packFileSize, mapped records below it rely on that
+    PackRecordHeader recordHeader = {recordMagic, hashKey(kernelFileHash), binarySize};
+    const auto recordOffset = static_cast<off_t>(header.packFileSize);
+    bool written = NEO::SysCalls::pwrite(packFd, &recordHeader, sizeof(recordHeader), recordOffset) == static_cast<ssize_t>(sizeof(recordHeader)) &&
+                   NEO::SysCalls::pwrite(packFd, pBinary, binarySize, recordOffset + sizeof(recordHeader)) == static_cast<ssize_t>(binarySize);
+    NEO::SysCalls::close(packFd);
+
+    if (!written) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Writing to pack file failed! errno: %d\n", NEO::SysCalls::getProcessId(), errno);
+        unlockPackFile(lockFd);
+        return false;
+    }
+
+    if (index.insert(kernelFileHash, header.packFileSize, binarySize) == nullptr) {
+        // packFileSize is left untouched, so the unreferenced record is overwritten by the next append
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Inserting into pack index failed!\n", NEO::SysCalls::getProcessId());
+        unlockPackFile(lockFd);
+        return false;
+    }
+    header.packFileSize += sizeof(recordHeader) + binarySize;
+
+    unlockPackFile(lockFd);
+    return true;
+}
+
+bool CompilerCache::processPackRecord(const std::string &kernelFileHash, const std::function<bool(int packFd, uint64_t binaryOffset, size_t binarySize, uint64_t sealedPackSize)> &recordProcessor) {
+    if (kernelFileHash.size() > maxKeyLength) {
+        return false;
+    }
+
+    const auto baseName = getPackFileBaseName();
+    const auto indexPath = joinPath(config.cacheDir, baseName + ".idx");
+    const auto packPath = joinPath(config.cacheDir, baseName + ".pack");
+
+    std::lock_guard<std::mutex> lock(cacheAccessMtx);
+    int lockFd = lockPackFile();
+    if (lockFd < 0) {
+        return false;
+    }
+
+    MappedPackIndex mappedIndex;
+    if (!mappedIndex.map(indexPath)) {
+        unlockPackFile(lockFd);
+        return false;
+    }
+
+    auto index = mappedIndex.getIndex();
+    auto entry = index.find(kernelFileHash);
+    if (entry == nullptr) {
+        unlockPackFile(lockFd);
+        return false;
+    }
+    index.touch(entry);
+    const auto recordOffset = static_cast<off_t>(entry->offset);
+    const auto binarySize = static_cast<size_t>(entry->size);
+    const auto keyHash = entry->keyHash;
+    const auto sealedPackSize = index.getHeader().packFileSize;
+
+    bool processed = false;
+    int packFd = NEO::SysCalls::open(packPath.c_str(), O_RDONLY);
+    if (packFd >= 0) {
+        PackRecordHeader recordHeader = {};
+        if (NEO::SysCalls::pread(packFd, &recordHeader, sizeof(recordHeader), recordOffset) == static_cast<ssize_t>(sizeof(recordHeader)) &&
+            recordHeader.magic == recordMagic && recordHeader.keyHash == keyHash && recordHeader.size == binarySize) {
+            processed = recordProcessor(packFd, recordOffset + sizeof(recordHeader), binarySize, sealedPackSize);
+        }
+        NEO::SysCalls::close(packFd);
+    }
+
+    if (!processed) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "PID %d [Cache failure]: Pack record for %s is corrupted\n", NEO::SysCalls::getProcessId(), kernelFileHash.c_str());
+        index.remove(entry);
+    }
+
+    unlockPackFile(lockFd);
+    return processed;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadCachedBinaryFromPack(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    std::unique_ptr<char[]> binary;
+    processPackRecord(kernelFileHash, [&](int packFd, uint64_t binaryOffset, size_t binarySize, uint64_t sealedPackSize) {
+        binary.reset(new char[binarySize]);
+        if (NEO::SysCalls::pread(packFd, binary.get(), binarySize, static_cast<off_t>(binaryOffset)) != static_cast<ssize_t>(binarySize)) {
+            binary.reset();
+            return false;
+        }
+        cachedBinarySize = binarySize;
+        return true;
+    });
+    return binary;
+}
+
+std::shared_ptr<const CachedBinary> CompilerCache::mapCachedBinaryFromPack(const std::string &kernelFileHash) {
+    std::shared_ptr<const CachedBinary> binary;
+    processPackRecord(kernelFileHash, [&](int packFd, uint64_t binaryOffset, size_t binarySize, uint64_t sealedPackSize) {
+        // The pack is written in place only at offsets >= packFileSize, while compaction and reset replace it by rename.
+        // Records below packFileSize can no longer change, so only those are mapped; anything else is copied.
+        const uint64_t binaryEnd = binaryOffset + binarySize;
+        struct stat statbuf = {};
+        if (binaryEnd <= sealedPackSize && NEO::SysCalls::fstat(packFd, &statbuf) == 0 && static_cast<uint64_t>(statbuf.st_size) >= binaryEnd) {
+            binary = MappedCachedBinary::create(packFd, binaryOffset, binarySize);
+            if (binary != nullptr) {
+                return true;
+            }
+        }
+
+        std::unique_ptr<char[]> binaryData(new char[binarySize]);
+        if (NEO::SysCalls::pread(packFd, binaryData.get(), binarySize, static_cast<off_t>(binaryOffset)) != static_cast<ssize_t>(binarySize)) {
+            return false;
+        }
+        binary = std::make_shared<HeapCachedBinary>(std::move(binaryData), binarySize);
+        return true;
+    });
+    return binary;
+}
+
+} // namespace NEO
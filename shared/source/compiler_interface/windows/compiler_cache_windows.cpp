@@ -319,4 +319,8 @@ std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string &kerne
     std::string filePath = joinPath(config.cacheDir, kernelFileHash + config.cacheFileExtension);
     return loadDataFromFile(filePath.c_str(), cachedBinarySize);
 }
+
+std::shared_ptr<const CachedBinary> CompilerCache::mapCachedBinary(const std::string &kernelFileHash) {
+    return nullptr;
+}
 } // namespace NEO
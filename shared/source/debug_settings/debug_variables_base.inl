@@ -82,6 +82,7 @@ DECLARE_DEBUG_VARIABLE(bool, DontDisableZebinIfVmeUsed, false, "When enabled, dr
 DECLARE_DEBUG_VARIABLE(bool, AppendMemoryPrefetchForKmdMigratedSharedAllocations, true, "Allow prefetching shared memory to the device associated with the specified command list")
 DECLARE_DEBUG_VARIABLE(bool, ForceMemoryPrefetchForKmdMigratedSharedAllocations, false, "Force prefetch of shared memory in command queue execute command lists")
 DECLARE_DEBUG_VARIABLE(bool, ClKhrExternalMemoryExtension, true, "Enable cl_khr_external_memory extension")
+DECLARE_DEBUG_VARIABLE(bool, ClKhrCommandBufferExtension, false, "Enable cl_khr_command_buffer extension, recorded commands are replayed through regular enqueues without pre-encoding")
 DECLARE_DEBUG_VARIABLE(bool, WaitForMemoryRelease, false, "Wait for memory release when out of memory")
 DECLARE_DEBUG_VARIABLE(bool, RemoveRestrictionsOnNumberOfThreadsInGpgpuThreadGroup, 0, "0 - default disabled, 1- remove restrictions on NumberOfThreadsInGpgpuThreadGroup in INTERFACE_DESCRIPTOR_DATA")
 DECLARE_DEBUG_VARIABLE(bool, DisableGemCreateExtSetPat, true, "Do not use I915_GEM_CREATE_EXT_SET_PAT extension when gem create ext is called")
@@ -260,6 +261,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, WaitForUserFenceOnEventHostSynchronize, -1, "-1:
 DECLARE_DEBUG_VARIABLE(int32_t, DisableSystemPointerKernelArgument, -1, "-1: default, 0: Disabled, 1: using a system pointer for kernel argument returns an error.")
 DECLARE_DEBUG_VARIABLE(int32_t, ProgramUserInterruptOnResolvedDependency, -1, "-1: default, 0: Disabled, >=1: bitfield. 01b: program after semaphore, 10b: on signaling fence (non-walker append).")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderRegularCmdListPatching, -1, "-1: default, 0: Disabled, 1: If set, patch counter value on execute call")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderRelativeCounters, -1, "-1: default (disabled), 0: Disabled, 1: Enabled. If set, in-order regular cmdlists add counter base stored in GPU memory instead of being patched on execute call")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderRelaxedOrderingForEventsChaining, -1, "-1: default, 0: Disabled, 1: If set, send 2 immediate flushes to avoid stalling RelaxedOrdering Scheduler.")
 
 /*LOGGING FLAGS*/
@@ -302,6 +304,7 @@ DECLARE_DEBUG_VARIABLE(bool, PrintBlitDispatchDetails, false, "Print blit dispat
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlTimes, false, "Print ioctl times")
 DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called")
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
+DECLARE_DEBUG_VARIABLE(bool, PrintModuleLoadTimes, false, "Print duration of each phase of L0 module initialization")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
 DECLARE_DEBUG_VARIABLE(bool, PrintKernelDispatchParameters, false, "Prints kernel parameters used in tg dispatch size heuristic on encode dispatch kernel")
@@ -353,6 +356,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseHighAlignmentForHeapExtended, -1, "-1: defaul
 DECLARE_DEBUG_VARIABLE(int32_t, DispatchCmdlistCmdBufferPrimary, -1, "-1: default, 0: dispatch command buffers as seconadry, 1: dispatch command buffers as primary and chain")
 DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use regular flush task, 1: use immediate flush task")
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWalkerTemplateCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, kernel invariant walker fields are programmed once per kernel and group size and copied on subsequent dispatches")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -576,8 +580,20 @@ DECLARE_DEBUG_VARIABLE(int32_t, SelectCmdListHeapAddressModel, -1, "-1: default,
 DECLARE_DEBUG_VARIABLE(int32_t, EnableSetPair, -1, "Use SET_PAIR to pair two buffer objects behind the same file descriptor, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ForcePreferredAllocationMethod, -1, "Sets preferred allocation method for Wddm paths; values = -1: driver default, 0: UseUmdSystemPtr, 1: AllocateByKmd")
 DECLARE_DEBUG_VARIABLE(int32_t, EventTimestampRefreshIntervalInMilliSec, -1, "-1: use driver default, This value sets the refresh interval for getting synchronized GPU and CPU timestamp")
+DECLARE_DEBUG_VARIABLE(int32_t, CompilerConcurrencyMode, -1, "-1: default, 0: serialized - one translation at a time in the process, for compilers that are not thread-safe, 1: concurrent - translations run in parallel, only device contexts creation is synchronized")
+DECLARE_DEBUG_VARIABLE(int32_t, BuildThreadPoolSize, -1, "-1: default - number of hardware threads capped at 16, ocloc fat binary targets are built sequentially, 0: asynchronous builds, parallel module initialization and ocloc fat binary targets are executed synchronously, >0: number of threads used for asynchronous builds, parallel module initialization and ocloc fat binary targets")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelModuleInitialization, -1, "-1: default - enabled for modules with at least 16 kernels, 0: disabled, 1: kernel data initialization and ISA upload of every module are spread over build thread pool")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferZebinKernelMetadataDecoding, -1, "-1: default - disabled, 0: disabled, 1: zebin kernel metadata is decoded on first use of a kernel instead of during binary decoding")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelLinkerPatching, -1, "-1: default - enabled for modules with at least 4096 instruction relocations, 0: disabled, 1: relocations of independent instruction segments are patched in parallel on build thread pool")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncProgramBuild, -1, "-1: default - disabled, 0: disabled, 1: clBuildProgram with pfn_notify returns immediately and builds the program in background")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelRootDeviceInitialization, -1, "-1: default - enabled, 0: disabled, 1: enabled. Os interfaces of root devices are initialized concurrently when more than one root device is discovered")
+DECLARE_DEBUG_VARIABLE(bool, PrintRootDeviceInitializationTimes, false, "Print time spent in each phase of root devices discovery and initialization")
+DECLARE_DEBUG_VARIABLE(int32_t, BatchDrmSetupQueries, -1, "-1: default - enabled, 0: disabled, 1: enabled. Immutable kernel driver queries needed during device setup are issued as one batched query")
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, BinaryCacheMemoryTierSizeInMB, -1, "-1: default (32), 0: disabled, >0: size limit in MB of in-process tier holding recently loaded or stored cached binaries")
+DECLARE_DEBUG_VARIABLE(bool, PrintBinaryCacheMemoryTierStatistics, false, "Print hit/miss counters of in-process binary cache tier when compiler cache is destroyed")
+DECLARE_DEBUG_VARIABLE(bool, BinaryCacheZeroCopyLoad, false, "Map binaries read from compiler cache read-only and decode them in place instead of copying them to heap")
 
 /* WORKAROUND FLAGS */
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDummyBlitWa, -1, "-1: default, 0: disabled, 1: enabled, Forces a workaround with dummy blits, driver adds an extra blit before command MI_ARB_CHECK on bcs")
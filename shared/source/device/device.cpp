@@ -228,9 +228,19 @@ bool Device::createDeviceImpl() {
 
     getDefaultEngine().osContext->setDefaultContext(true);
 
+    size_t deferredAllocationsSize = 0u;
+    uint32_t deferredEnginesCount = 0u;
     for (auto &engine : allEngines) {
         auto commandStreamReceiver = engine.commandStreamReceiver;
         commandStreamReceiver->postInitFlagsSetup();
+        if (commandStreamReceiver->areEngineAllocationsDeferred()) {
+            deferredAllocationsSize += commandStreamReceiver->getEngineAllocationsSize(preemptionMode == PreemptionMode::MidThread);
+            deferredEnginesCount++;
+        }
+    }
+    if (DebugManager.flags.PrintOsContextInitializations.get()) {
+        printf("Deferred initialization of %u engines of device with bitfield %lu, %zu bytes of engine allocations not created\n",
+               deferredEnginesCount, deviceBitfield.to_ulong(), deferredAllocationsSize);
     }
 
     auto &registeredEngines = executionEnvironment->memoryManager->getRegisteredEngines(rootDeviceIndex);
@@ -353,6 +363,7 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
 
     UNRECOVERABLE_IF(EngineHelpers::isBcs(engineType) && !hwInfo.capabilityTable.blitterOperationsSupported);
 
+    // CSR and OS context are created for every engine, engine groups and memory manager keep EngineControl copies of them
     std::unique_ptr<CommandStreamReceiver> commandStreamReceiver = createCommandStreamReceiver();
     if (!commandStreamReceiver) {
         return false;
@@ -371,21 +382,22 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
 
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(), engineDescriptor);
     commandStreamReceiver->setupContext(*osContext);
-    if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+    const bool preemptionAllocationRequired = (preemptionMode == PreemptionMode::MidThread);
+    const bool immediateContextInitialization = osContext->isImmediateContextInitializationEnabled(isDefaultEngine);
+    if (immediateContextInitialization) {
         if (!commandStreamReceiver->initializeResources()) {
             return false;
         }
+    } else {
+        // Created together with OS context on first use of the engine, see CommandStreamReceiver::initializeResources
+        commandStreamReceiver->deferEngineAllocations(preemptionAllocationRequired);
     }
 
     if (!commandStreamReceiver->initializeTagAllocation()) {
         return false;
     }
 
-    if (!commandStreamReceiver->createGlobalFenceAllocation()) {
-        return false;
-    }
-
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    if (immediateContextInitialization && !commandStreamReceiver->createEngineAllocations(preemptionAllocationRequired)) {
         return false;
     }
 
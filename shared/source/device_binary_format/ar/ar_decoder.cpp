@@ -7,7 +7,9 @@
 
 #include "shared/source/device_binary_format/ar/ar_decoder.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <string_view>
 
 namespace NEO {
 namespace Ar {
@@ -66,6 +68,38 @@ Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std
     return ret;
 }
 
+namespace {
+std::string_view asStringView(ConstStringRef str) {
+    return std::string_view(str.data(), str.size());
+}
+} // namespace
+
+ArIndex::ArIndex(const Ar &archive) {
+    for (auto &file : archive.files) {
+        sortedFiles.push_back(&file);
+    }
+    // files are stored in archive order, so address breaks ties between equal names
+    std::sort(sortedFiles.begin(), sortedFiles.end(), [](const ArFileEntryHeaderAndData *lhs, const ArFileEntryHeaderAndData *rhs) {
+        auto lhsName = asStringView(lhs->fileName);
+        auto rhsName = asStringView(rhs->fileName);
+        return (lhsName != rhsName) ? (lhsName < rhsName) : (lhs < rhs);
+    });
+}
+
+const ArFileEntryHeaderAndData *ArIndex::findFirstWithPrefix(ConstStringRef prefix) const {
+    auto it = std::lower_bound(sortedFiles.begin(), sortedFiles.end(), asStringView(prefix), [](const ArFileEntryHeaderAndData *file, std::string_view prefix) {
+        return asStringView(file->fileName) < prefix;
+    });
+
+    const ArFileEntryHeaderAndData *firstInArchive = nullptr;
+    for (; (it != sortedFiles.end()) && (*it)->fileName.startsWith(prefix); ++it) {
+        if ((nullptr == firstInArchive) || (*it < firstInArchive)) {
+            firstInArchive = *it;
+        }
+    }
+    return firstInArchive;
+}
+
 } // namespace Ar
 
 } // namespace NEO
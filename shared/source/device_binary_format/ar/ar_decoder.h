@@ -81,6 +81,19 @@ inline ConstStringRef readLongFileName(ConstStringRef longFileNamesSection, size
 
 Ar decodeAr(const ArrayRef<const uint8_t> binary, std::string &outErrReason, std::string &outWarnings);
 
+// Lookup over file entries of a decoded archive, ordered by file name and position in archive.
+// Entries are found by name prefix with binary search; among entries sharing the prefix
+// the first one in the archive is returned, same as with a linear scan over headers.
+class ArIndex {
+  public:
+    explicit ArIndex(const Ar &archive);
+
+    const ArFileEntryHeaderAndData *findFirstWithPrefix(ConstStringRef prefix) const;
+
+  protected:
+    StackVec<const ArFileEntryHeaderAndData *, 32> sortedFiles;
+};
+
 } // namespace Ar
 
 } // namespace NEO
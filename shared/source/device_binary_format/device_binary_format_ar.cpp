@@ -11,15 +11,6 @@
 #include "shared/source/helpers/string.h"
 
 namespace NEO {
-void searchForBinary(Ar::Ar &archiveData, const ConstStringRef filter, Ar::ArFileEntryHeaderAndData *&matched) {
-    for (auto &file : archiveData.files) {
-        if (file.fileName.startsWith(filter.str().c_str())) {
-            matched = &file;
-            return;
-        }
-    }
-}
-
 template <>
 bool isDeviceBinaryFormat<NEO::DeviceBinaryFormat::Archive>(const ArrayRef<const uint8_t> binary) {
     return NEO::Ar::isAr(binary);
@@ -40,18 +31,20 @@ SingleDeviceBinary unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(co
     std::string filterPointerSizeAndPlatformAndStepping = filterPointerSizeAndPlatform + "." + std::to_string(requestedTargetDevice.stepping);
     ConstStringRef filterGenericIrFileName{"generic_ir"};
 
-    Ar::ArFileEntryHeaderAndData *matchedFiles[5] = {};
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndMajorMinorRevision = matchedFiles[0];
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatformAndStepping = matchedFiles[1];
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndMajorMinor = matchedFiles[2];
-    Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatform = matchedFiles[3];
-    Ar::ArFileEntryHeaderAndData *&matchedGenericIr = matchedFiles[4];
+    // only file entry headers are looked up, data of file entries is not accessed until the selected entry gets unpacked
+    const Ar::ArIndex archiveIndex(archiveData);
+    const Ar::ArFileEntryHeaderAndData *matchedFiles[5] = {};
+    const Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndMajorMinorRevision = matchedFiles[0];
+    const Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatformAndStepping = matchedFiles[1];
+    const Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndMajorMinor = matchedFiles[2];
+    const Ar::ArFileEntryHeaderAndData *&matchedPointerSizeAndPlatform = matchedFiles[3];
+    const Ar::ArFileEntryHeaderAndData *&matchedGenericIr = matchedFiles[4];
 
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndMajorMinorRevision), matchedPointerSizeAndMajorMinorRevision);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndPlatformAndStepping), matchedPointerSizeAndPlatformAndStepping);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndMajorMinor), matchedPointerSizeAndMajorMinor);
-    searchForBinary(archiveData, ConstStringRef(filterPointerSizeAndPlatform), matchedPointerSizeAndPlatform);
-    searchForBinary(archiveData, filterGenericIrFileName, matchedGenericIr);
+    matchedPointerSizeAndMajorMinorRevision = archiveIndex.findFirstWithPrefix(filterPointerSizeAndMajorMinorRevision);
+    matchedPointerSizeAndPlatformAndStepping = archiveIndex.findFirstWithPrefix(filterPointerSizeAndPlatformAndStepping);
+    matchedPointerSizeAndMajorMinor = archiveIndex.findFirstWithPrefix(filterPointerSizeAndMajorMinor);
+    matchedPointerSizeAndPlatform = archiveIndex.findFirstWithPrefix(filterPointerSizeAndPlatform);
+    matchedGenericIr = archiveIndex.findFirstWithPrefix(filterGenericIrFileName);
 
     std::string unpackErrors;
     std::string unpackWarnings;
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+Scanner::ScanFunc Scanner::skipSpaces = ScannerKernels::skipSpacesScalar;
+Scanner::ScanFunc Scanner::skipToNewLine = ScannerKernels::skipToNewLineScalar;
+Scanner::ScanFunc Scanner::skipNameIdentifier = ScannerKernels::skipNameIdentifierScalar;
+
+// Initialize the kernels based on CPU capabilities
+Scanner::KernelSelector::KernelSelector() {
+    bool supportsNEON = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureNeon);
+    if (supportsNEON) {
+        Scanner::skipSpaces = ScannerKernels::skipSpacesSse4;
+        Scanner::skipToNewLine = ScannerKernels::skipToNewLineSse4;
+        Scanner::skipNameIdentifier = ScannerKernels::skipNameIdentifierSse4;
+    }
+}
+
+Scanner::KernelSelector Scanner::KernelSelector::initializer;
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+#include "shared/source/helpers/basic_math.h"
+
+#include <cstdint>
+#include <immintrin.h>
+
+namespace NEO {
+
+namespace Yaml {
+
+namespace ScannerKernels {
+
+namespace {
+constexpr uint32_t allMatched = 0xFFFFFFFFu;
+
+inline __m256i inRange(__m256i chars, char first, char last) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8(first - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(last + 1), chars));
+}
+
+inline __m256i load(const char *pos) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos));
+}
+
+template <typename MatchT, typename ScalarT>
+const char *skipMatching(const char *pos, const char *end, MatchT match, ScalarT scalarTail) {
+    while (end - pos >= static_cast<ptrdiff_t>(avx2VectorSize)) {
+        auto matched = static_cast<uint32_t>(_mm256_movemask_epi8(match(load(pos))));
+        if (matched != allMatched) {
+            return pos + Math::getMinLsbSet(~matched);
+        }
+        pos += avx2VectorSize;
+    }
+    return scalarTail(pos, end);
+}
+} // namespace
+
+const char *skipSpacesAvx2(const char *pos, const char *end) {
+    const auto space = _mm256_set1_epi8(' ');
+    auto isSpace = [&](__m256i chars) { return _mm256_cmpeq_epi8(chars, space); };
+    return skipMatching(pos, end, isSpace, skipSpacesSse4);
+}
+
+const char *skipToNewLineAvx2(const char *pos, const char *end) {
+    const auto newLine = _mm256_set1_epi8('\n');
+    const auto allOnes = _mm256_set1_epi8(-1);
+    auto isNotNewLine = [&](__m256i chars) { return _mm256_andnot_si256(_mm256_cmpeq_epi8(chars, newLine), allOnes); };
+    return skipMatching(pos, end, isNotNewLine, skipToNewLineSse4);
+}
+
+const char *skipNameIdentifierAvx2(const char *pos, const char *end) {
+    const auto caseBit = _mm256_set1_epi8(0x20);
+    const auto underscore = _mm256_set1_epi8('_');
+    const auto minus = _mm256_set1_epi8('-');
+    const auto dot = _mm256_set1_epi8('.');
+    const auto space = _mm256_set1_epi8(' ');
+    const auto tab = _mm256_set1_epi8('\t');
+    auto isNameIdentifierChar = [&](__m256i chars) {
+        auto letters = inRange(_mm256_or_si256(chars, caseBit), 'a', 'z');
+        auto numbers = inRange(chars, '0', '9');
+        auto specials = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chars, underscore), _mm256_cmpeq_epi8(chars, minus)),
+                                        _mm256_or_si256(_mm256_cmpeq_epi8(chars, dot), _mm256_or_si256(_mm256_cmpeq_epi8(chars, space), _mm256_cmpeq_epi8(chars, tab))));
+        return _mm256_or_si256(_mm256_or_si256(letters, numbers), specials);
+    };
+    return skipMatching(pos, end, isNameIdentifierChar, skipNameIdentifierSse4);
+}
+
+} // namespace ScannerKernels
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+Scanner::ScanFunc Scanner::skipSpaces = ScannerKernels::skipSpacesSse4;
+Scanner::ScanFunc Scanner::skipToNewLine = ScannerKernels::skipToNewLineSse4;
+Scanner::ScanFunc Scanner::skipNameIdentifier = ScannerKernels::skipNameIdentifierSse4;
+
+// Initialize the kernels based on CPU capabilities
+Scanner::KernelSelector::KernelSelector() {
+    bool supportsAVX2 = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2);
+    if (supportsAVX2) {
+        Scanner::skipSpaces = ScannerKernels::skipSpacesAvx2;
+        Scanner::skipToNewLine = ScannerKernels::skipToNewLineAvx2;
+        Scanner::skipNameIdentifier = ScannerKernels::skipNameIdentifierAvx2;
+    }
+}
+
+Scanner::KernelSelector Scanner::KernelSelector::initializer;
+
+} // namespace Yaml
+
+} // namespace NEO
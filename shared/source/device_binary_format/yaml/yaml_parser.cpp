@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2022 Intel Corporation
+ * Copyright (C) 2020-2023 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+
 namespace NEO {
 
 namespace Yaml {
@@ -157,10 +159,12 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = Scanner::skipSpaces(context.pos + 1, context.end);
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +179,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = Scanner::skipToNewLine(context.pos + 1, context.end);
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
             }
@@ -273,7 +271,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         default: {
             context.isParsingIdent = false;
-            auto tokEnd = consumeNameIdentifier(text, context.pos);
+            auto tokEnd = isNameIdentifierBeginningCharacter(context.pos[0]) ? Scanner::skipNameIdentifier(context.pos + 1, context.end) : context.pos;
             if (tokEnd != context.pos) {
                 auto tokenData = ConstStringRef(context.pos, tokEnd - context.pos);
                 tokenData = tokenData.trimEnd(isWhitespace);
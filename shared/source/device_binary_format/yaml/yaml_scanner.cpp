@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+
+#include "shared/source/device_binary_format/yaml/yaml_parser.h"
+
+namespace NEO {
+
+namespace Yaml {
+
+namespace ScannerKernels {
+
+const char *skipSpacesScalar(const char *pos, const char *end) {
+    while ((pos < end) && (' ' == *pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+const char *skipToNewLineScalar(const char *pos, const char *end) {
+    while ((pos < end) && ('\n' != *pos)) {
+        ++pos;
+    }
+    return pos;
+}
+
+const char *skipNameIdentifierScalar(const char *pos, const char *end) {
+    while ((pos < end) && (isNameIdentifierCharacter(*pos) || isSeparationWhitespace(*pos))) {
+        ++pos;
+    }
+    return pos;
+}
+
+} // namespace ScannerKernels
+
+} // namespace Yaml
+
+} // namespace NEO
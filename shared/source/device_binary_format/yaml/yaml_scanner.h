@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+
+namespace NEO {
+
+namespace Yaml {
+
+// Character run scanners used by the tokenizer hot loops.
+// Each scanner returns pointer to the first character in [pos, end) that ends the run, or end.
+// Scanners are dispatched to scalar, SSE4 or AVX2 kernels, all of which produce identical results.
+// Vector kernels only load full vectors within [pos, end), the remainder is handled by scalar code.
+class Scanner {
+  public:
+    using ScanFunc = const char *(*)(const char *pos, const char *end);
+
+    // skips ' ' characters
+    static ScanFunc skipSpaces;
+    // skips characters other than '\n'
+    static ScanFunc skipToNewLine;
+    // skips name identifier characters and separation whitespaces
+    static ScanFunc skipNameIdentifier;
+
+  protected:
+    struct KernelSelector {
+        KernelSelector();
+        static KernelSelector initializer;
+    };
+};
+
+namespace ScannerKernels {
+constexpr size_t sse4VectorSize = 16u;
+constexpr size_t avx2VectorSize = 32u;
+
+const char *skipSpacesScalar(const char *pos, const char *end);
+const char *skipToNewLineScalar(const char *pos, const char *end);
+const char *skipNameIdentifierScalar(const char *pos, const char *end);
+
+const char *skipSpacesSse4(const char *pos, const char *end);
+const char *skipToNewLineSse4(const char *pos, const char *end);
+const char *skipNameIdentifierSse4(const char *pos, const char *end);
+
+const char *skipSpacesAvx2(const char *pos, const char *end);
+const char *skipToNewLineAvx2(const char *pos, const char *end);
+const char *skipNameIdentifierAvx2(const char *pos, const char *end);
+} // namespace ScannerKernels
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+#include "shared/source/helpers/basic_math.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+
+namespace NEO {
+
+namespace Yaml {
+
+namespace ScannerKernels {
+
+namespace {
+constexpr uint32_t allMatched = 0xFFFFu;
+
+inline __m128i inRange(__m128i chars, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8(last + 1)));
+}
+
+inline __m128i load(const char *pos) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+}
+
+template <typename MatchT, typename ScalarT>
+const char *skipMatching(const char *pos, const char *end, MatchT match, ScalarT scalarTail) {
+    while (end - pos >= static_cast<ptrdiff_t>(sse4VectorSize)) {
+        auto matched = static_cast<uint32_t>(_mm_movemask_epi8(match(load(pos))));
+        if (matched != allMatched) {
+            return pos + Math::getMinLsbSet(~matched);
+        }
+        pos += sse4VectorSize;
+    }
+    return scalarTail(pos, end);
+}
+} // namespace
+
+const char *skipSpacesSse4(const char *pos, const char *end) {
+    const auto space = _mm_set1_epi8(' ');
+    auto isSpace = [&](__m128i chars) { return _mm_cmpeq_epi8(chars, space); };
+    return skipMatching(pos, end, isSpace, skipSpacesScalar);
+}
+
+const char *skipToNewLineSse4(const char *pos, const char *end) {
+    const auto newLine = _mm_set1_epi8('\n');
+    const auto allOnes = _mm_set1_epi8(-1);
+    auto isNotNewLine = [&](__m128i chars) { return _mm_andnot_si128(_mm_cmpeq_epi8(chars, newLine), allOnes); };
+    return skipMatching(pos, end, isNotNewLine, skipToNewLineScalar);
+}
+
+const char *skipNameIdentifierSse4(const char *pos, const char *end) {
+    const auto caseBit = _mm_set1_epi8(0x20);
+    const auto underscore = _mm_set1_epi8('_');
+    const auto minus = _mm_set1_epi8('-');
+    const auto dot = _mm_set1_epi8('.');
+    const auto space = _mm_set1_epi8(' ');
+    const auto tab = _mm_set1_epi8('\t');
+    auto isNameIdentifierChar = [&](__m128i chars) {
+        auto letters = inRange(_mm_or_si128(chars, caseBit), 'a', 'z');
+        auto numbers = inRange(chars, '0', '9');
+        auto specials = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, underscore), _mm_cmpeq_epi8(chars, minus)),
+                                     _mm_or_si128(_mm_cmpeq_epi8(chars, dot), _mm_or_si128(_mm_cmpeq_epi8(chars, space), _mm_cmpeq_epi8(chars, tab))));
+        return _mm_or_si128(_mm_or_si128(letters, numbers), specials);
+    };
+    return skipMatching(pos, end, isNameIdentifierChar, skipNameIdentifierScalar);
+}
+
+} // namespace ScannerKernels
+
+} // namespace Yaml
+
+} // namespace NEO
@@ -396,13 +396,28 @@ DecodeError decodeAndPopulateKernelMiscInfo(size_t kernelMiscInfoOffset, std::ve
             outErrReason.append("DeviceBinaryFormat::Zebin : Error : Cannot find kernel info for kernel " + kName + ".\n");
             return DecodeError::InvalidBinary;
         }
+        if (false == kernelInfo->kernelDescriptor.decodeDeferredMetadata()) {
+            outErrReason.append("DeviceBinaryFormat::Zebin : Error : Cannot decode metadata of kernel " + kName + ".\n");
+            return DecodeError::InvalidBinary;
+        }
         populateKernelMiscInfo(kernelInfo->kernelDescriptor, miscInfos, outErrReason, outWarning);
     }
     return DecodeError::Success;
 }
 
 DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &outErrReason, std::string &outWarning) {
-    Yaml::YamlParser yamlParser;
+    std::shared_ptr<ZeInfoDeferredKernelsDecoder> deferredDecoder;
+    if (NEO::DebugManager.flags.DeferZebinKernelMetadataDecoding.get() == 1) {
+        // Parsed nodes refer to metadata string, so copy of it is kept for deferred decoding
+        deferredDecoder = std::make_shared<ZeInfoDeferredKernelsDecoder>();
+        deferredDecoder->zeInfo = zeInfo.str();
+        deferredDecoder->grfSize = dst.grfSize;
+        deferredDecoder->minScratchSpaceSize = dst.minScratchSpaceSize;
+        zeInfo = ConstStringRef(deferredDecoder->zeInfo);
+    }
+
+    Yaml::YamlParser localYamlParser;
+    Yaml::YamlParser &yamlParser = deferredDecoder ? deferredDecoder->parser : localYamlParser;
     bool parseSuccess = yamlParser.parse(zeInfo, outErrReason, outWarning);
     if (false == parseSuccess) {
         return DecodeError::InvalidBinary;
@@ -434,7 +449,11 @@ DecodeError decodeZeInfo(ProgramInfo &dst, ConstStringRef zeInfo, std::string &o
         return zeInfoDecodeError;
     }
 
-    zeInfoDecodeError = decodeZeInfoKernels(dst, yamlParser, zeInfoSections, outErrReason, outWarning);
+    if (deferredDecoder) {
+        zeInfoDecodeError = decodeZeInfoKernelsDeferred(dst, deferredDecoder, zeInfoSections, outErrReason, outWarning);
+    } else {
+        zeInfoDecodeError = decodeZeInfoKernels(dst, yamlParser, zeInfoSections, outErrReason, outWarning);
+    }
     if (DecodeError::Success != zeInfoDecodeError) {
         return zeInfoDecodeError;
     }
@@ -500,6 +519,55 @@ DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, cons
     return DecodeError::Success;
 }
 
+DecodeError decodeZeInfoKernelsDeferred(ProgramInfo &dst, std::shared_ptr<ZeInfoDeferredKernelsDecoder> deferredDecoder, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning) {
+    UNRECOVERABLE_IF(zeInfoSections.kernels.size() != 1U);
+    auto &parser = deferredDecoder->parser;
+    for (const auto &kernelNd : parser.createChildrenRange(*zeInfoSections.kernels[0])) {
+        ZeInfoKernelSections zeInfoKernelSections;
+        extractZeInfoKernelSections(parser, kernelNd, zeInfoKernelSections, ".ze_info", outWarning);
+        auto extractError = validateZeInfoKernelSectionsCount(zeInfoKernelSections, outErrReason, outWarning);
+        if (DecodeError::Success != extractError) {
+            return extractError;
+        }
+
+        auto kernelInfo = std::make_unique<KernelInfo>();
+        auto &kernelDescriptor = kernelInfo->kernelDescriptor;
+        kernelDescriptor.kernelAttributes.binaryFormat = DeviceBinaryFormat::Zebin;
+        kernelDescriptor.kernelMetadata.kernelName = parser.readValueNoQuotes(*zeInfoKernelSections.nameNd[0]).str();
+        kernelDescriptor.deferredMetadata.deferred = true;
+        kernelDescriptor.deferredMetadata.decode = [deferredDecoder, kernelInfo = kernelInfo.get(), kernelNd = &kernelNd](KernelDescriptor &) {
+            return deferredDecoder->decodeKernel(*kernelInfo, *kernelNd);
+        };
+        dst.kernelInfos.push_back(kernelInfo.release());
+    }
+    return DecodeError::Success;
+}
+
+bool ZeInfoDeferredKernelsDecoder::decodeKernel(KernelInfo &dst, const Yaml::Node &kernelNd) {
+    std::lock_guard<std::mutex> lock(mtx);
+    std::string errors, warnings;
+    auto &kernelDescriptor = dst.kernelDescriptor;
+
+    ZeInfoKernelSections zeInfoKernelSections;
+    extractZeInfoKernelSections(parser, kernelNd, zeInfoKernelSections, ".ze_info", warnings);
+    auto decodeError = decodeZeInfoKernelMetadata(kernelDescriptor, parser, zeInfoKernelSections, grfSize, minScratchSpaceSize, errors, warnings);
+    if (DecodeError::Success != decodeError) {
+        PRINT_DEBUG_STRING(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr, "Error in deferred decoding of kernel %s metadata: %s\n",
+                           kernelDescriptor.kernelMetadata.kernelName.c_str(), errors.c_str());
+        return false;
+    }
+
+    dst.heapInfo.pSsh = kernelDescriptor.generatedSsh.data();
+    dst.heapInfo.surfaceStateHeapSize = static_cast<uint32_t>(kernelDescriptor.generatedSsh.size());
+    dst.heapInfo.pDsh = kernelDescriptor.generatedDsh.data();
+    dst.heapInfo.dynamicStateHeapSize = static_cast<uint32_t>(kernelDescriptor.generatedDsh.size());
+
+    if (KernelDescriptor::isBindlessAddressingKernel(kernelDescriptor)) {
+        kernelDescriptor.initBindlessOffsetToSurfaceState();
+    }
+    return true;
+}
+
 DecodeError decodeZeInfoKernelEntry(NEO::KernelDescriptor &dst, NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning) {
     ZeInfoKernelSections zeInfokernelSections;
     extractZeInfoKernelSections(yamlParser, kernelNd, zeInfokernelSections, ".ze_info", outWarning);
@@ -511,6 +579,10 @@ DecodeError decodeZeInfoKernelEntry(NEO::KernelDescriptor &dst, NEO::Yaml::YamlP
     dst.kernelAttributes.binaryFormat = DeviceBinaryFormat::Zebin;
     dst.kernelMetadata.kernelName = yamlParser.readValueNoQuotes(*zeInfokernelSections.nameNd[0]).str();
 
+    return decodeZeInfoKernelMetadata(dst, yamlParser, zeInfokernelSections, grfSize, minScratchSpaceSize, outErrReason, outWarning);
+}
+
+DecodeError decodeZeInfoKernelMetadata(NEO::KernelDescriptor &dst, NEO::Yaml::YamlParser &yamlParser, const ZeInfoKernelSections &zeInfokernelSections, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning) {
     auto decodeError = decodeZeInfoKernelExecutionEnvironment(dst, yamlParser, zeInfokernelSections, outErrReason, outWarning);
     if (DecodeError::Success != decodeError) {
         return decodeError;
@@ -8,8 +8,13 @@
 #include "shared/source/device_binary_format/device_binary_formats.h"
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 #include "shared/source/device_binary_format/zebin/zeinfo.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
+
 namespace NEO {
 
 struct KernelDescriptor;
@@ -72,7 +77,20 @@ DecodeError decodeZeInfoGlobalHostAccessTable(ProgramInfo &dst, Yaml::YamlParser
 DecodeError decodeZeInfoFunctions(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 
 DecodeError decodeZeInfoKernels(ProgramInfo &dst, Yaml::YamlParser &parser, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
+
+// Keeps parsed .ze_info alive and decodes metadata of a single kernel on demand
+struct ZeInfoDeferredKernelsDecoder : NonCopyableOrMovableClass {
+    bool decodeKernel(KernelInfo &dst, const Yaml::Node &kernelNd);
+
+    std::string zeInfo;
+    Yaml::YamlParser parser;
+    uint32_t grfSize = 0U;
+    uint32_t minScratchSpaceSize = 0U;
+    std::mutex mtx;
+};
+DecodeError decodeZeInfoKernelsDeferred(ProgramInfo &dst, std::shared_ptr<ZeInfoDeferredKernelsDecoder> deferredDecoder, const ZeInfoSections &zeInfoSections, std::string &outErrReason, std::string &outWarning);
 DecodeError decodeZeInfoKernelEntry(KernelDescriptor &dst, Yaml::YamlParser &yamlParser, const Yaml::Node &kernelNd, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning);
+DecodeError decodeZeInfoKernelMetadata(KernelDescriptor &dst, Yaml::YamlParser &yamlParser, const ZeInfoKernelSections &zeInfokernelSections, uint32_t grfSize, uint32_t minScratchSpaceSize, std::string &outErrReason, std::string &outWarning);
 
 using KernelExecutionEnvBaseT = Types::Kernel::ExecutionEnv::ExecutionEnvBaseT;
 DecodeError decodeZeInfoKernelExecutionEnvironment(KernelDescriptor &dst, Yaml::YamlParser &parser, const ZeInfoKernelSections &kernelSections, std::string &outErrReason, std::string &outWarning);
@@ -41,6 +41,11 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
         return nullptr;
     }
 
+    // Immutable device queries issued below are served from persistent topology cache when it is enabled,
+    // queries missing in the cache are fetched from kernel driver in one batch
+    drm->setupQueryCache();
+    drm->setPrefetchSetupQueries(DebugManager.flags.BatchDrmSetupQueries.get() != 0);
+
     const DeviceDescriptor *deviceDescriptor = nullptr;
     const char *deviceName = "";
     for (auto &deviceDescriptorEntry : deviceDescriptorTable) {
@@ -120,6 +125,8 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
 
     drm->queryAdapterBDF();
 
+    drm->releaseQueryCache();
+
     return drm.release();
 }
 
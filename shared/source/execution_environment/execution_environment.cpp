@@ -24,6 +24,7 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/thread_pool.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
@@ -43,6 +44,7 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    buildThreadPool.reset();
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -120,6 +122,18 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+ThreadPool *ExecutionEnvironment::getBuildThreadPool() {
+    std::lock_guard<std::mutex> lockForInit(buildThreadPoolMutex);
+    if (this->buildThreadPool == nullptr) {
+        auto numThreads = ThreadPool::getDefaultNumThreads();
+        if (DebugManager.flags.BuildThreadPoolSize.get() != -1) {
+            numThreads = static_cast<uint32_t>(DebugManager.flags.BuildThreadPoolSize.get());
+        }
+        this->buildThreadPool = std::make_unique<ThreadPool>(numThreads);
+    }
+    return buildThreadPool.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
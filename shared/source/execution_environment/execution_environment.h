@@ -19,6 +19,7 @@ class GfxCoreHelper;
 class MemoryManager;
 struct OsEnvironment;
 struct RootDeviceEnvironment;
+class ThreadPool;
 
 class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment> {
 
@@ -61,6 +62,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    ThreadPool *getBuildThreadPool();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
@@ -85,5 +87,7 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::Disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::unique_ptr<ThreadPool> buildThreadPool;
+    std::mutex buildThreadPoolMutex;
 };
 } // namespace NEO
@@ -110,6 +110,10 @@ bool RootDeviceEnvironment::initAilConfiguration() {
         return true;
     }
 
+    // AIL configuration is shared by all root devices of the same product, which may be initialized concurrently
+    static std::mutex ailConfigurationMutex;
+    std::lock_guard<std::mutex> lock(ailConfigurationMutex);
+
     auto result = ailConfiguration->initProcessExecutableName();
     if (result != true) {
         return false;
@@ -117,6 +121,12 @@ bool RootDeviceEnvironment::initAilConfiguration() {
 
     ailConfiguration->apply(hwInfo->capabilityTable);
 
+    std::string presetsFilePath = AILConfiguration::defaultPresetsFilePath;
+    if (DebugManager.flags.AILPresetsFile.get() != "unk") {
+        presetsFilePath = DebugManager.flags.AILPresetsFile.get();
+    }
+    ailConfiguration->applyPresetsFromFile(presetsFilePath);
+
     return true;
 }
 
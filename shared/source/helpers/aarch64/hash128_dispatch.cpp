@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+#include "shared/source/utilities/cpu_info.h"
+
+namespace NEO {
+
+Hash128::AccumulateFunc Hash128::accumulate = Hash128Kernels::accumulateScalar;
+Hash128::ScrambleFunc Hash128::scramble = Hash128Kernels::scrambleScalar;
+
+// Initialize the kernels based on CPU capabilities
+Hash128::KernelSelector::KernelSelector() {
+    bool supportsNEON = CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureNeon);
+    if (supportsNEON) {
+        Hash128::accumulate = Hash128Kernels::accumulateSse4;
+        Hash128::scramble = Hash128Kernels::scrambleSse4;
+    }
+}
+
+Hash128::KernelSelector Hash128::KernelSelector::initializer;
+
+} // namespace NEO
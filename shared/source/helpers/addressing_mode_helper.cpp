@@ -48,6 +48,7 @@ bool containsStatefulAccess(const KernelDescriptor &kernelDescriptor, bool skipL
 
 bool containsStatefulAccess(const std::vector<KernelInfo *> &kernelInfos, bool skipLastExplicitArg) {
     for (const auto &kernelInfo : kernelInfos) {
+        kernelInfo->kernelDescriptor.decodeDeferredMetadata();
         if (containsStatefulAccess(kernelInfo->kernelDescriptor, skipLastExplicitArg)) {
             return true;
         }
@@ -9,6 +9,7 @@
 
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/oclc_extensions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/compiler_product_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/release_helper/release_helper.h"
@@ -72,4 +73,55 @@ void appendExtensionsToInternalOptions(const HardwareInfo &hwInfo, const std::st
     }
 }
 
+std::string getProgramInternalOptions(const ProgramInternalOptionsArgs &args, const CompilerProductHelper &compilerProductHelper) {
+    auto internalOptions = getOclVersionCompilerInternalOption(args.clVersion);
+
+    if (args.force32BitAddressing) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::arch32bit);
+    }
+
+    if (args.greaterThan4gbBuffersRequired || DebugManager.flags.DisableStatelessToStatefulOptimization.get()) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::greaterThan4gbBuffersRequired);
+    }
+
+    if (args.bindlessMode) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::bindlessMode);
+    }
+
+    auto enableStatelessToStatefulWithOffset = args.statelessToStatefulWithOffsetSupported;
+    if (DebugManager.flags.EnableStatelessToStatefulBufferOffsetOpt.get() != -1) {
+        enableStatelessToStatefulWithOffset = DebugManager.flags.EnableStatelessToStatefulBufferOffsetOpt.get() != 0;
+    }
+
+    if (enableStatelessToStatefulWithOffset) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::hasBufferOffsetArg);
+    }
+
+    if (args.forceEmuInt32DivRemSP) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::forceEmuInt32DivRemSP);
+    }
+
+    if (args.supportsImages) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::enableImageSupport);
+    }
+
+    if (args.fp64Emulation) {
+        CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::enableFP64GenEmu);
+    }
+
+    CompilerOptions::concatenateAppend(internalOptions, CompilerOptions::preserveVec3Type);
+    CompilerOptions::concatenateAppend(internalOptions, compilerProductHelper.getCachingPolicyOptions(args.debuggerActive));
+    CompilerOptions::applyExtraInternalOptions(internalOptions, compilerProductHelper);
+    return internalOptions;
+}
+
+void appendProgramBuildInternalOptions(std::string &internalOptions, const std::string &options, std::string compilerExtensions, bool isBuiltIn) {
+    appendAdditionalExtensions(compilerExtensions, options, internalOptions);
+    CompilerOptions::concatenateAppend(internalOptions, compilerExtensions);
+
+    if (!isBuiltIn && DebugManager.flags.InjectInternalBuildOptions.get() != "unk") {
+        CompilerOptions::concatenateAppend(internalOptions, DebugManager.flags.InjectInternalBuildOptions.get());
+    }
+}
+
 } // namespace NEO
@@ -7,12 +7,26 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace NEO {
 
 extern const std::string clStdOptionName;
 struct HardwareInfo;
+class CompilerProductHelper;
+
+struct ProgramInternalOptionsArgs {
+    uint32_t clVersion = 0u;
+    bool force32BitAddressing = false;
+    bool greaterThan4gbBuffersRequired = false;
+    bool bindlessMode = false;
+    bool statelessToStatefulWithOffsetSupported = false;
+    bool forceEmuInt32DivRemSP = false;
+    bool supportsImages = false;
+    bool fp64Emulation = false;
+    bool debuggerActive = false;
+};
 
 bool requiresOpenClCFeatures(const std::string &compileOptions);
 bool requiresAdditionalExtensions(const std::string &compileOptions);
@@ -20,4 +34,9 @@ bool requiresAdditionalExtensions(const std::string &compileOptions);
 void appendAdditionalExtensions(std::string &extensions, const std::string &compileOptions, const std::string &internalOptions);
 void appendExtensionsToInternalOptions(const HardwareInfo &hwInfo, const std::string &options, std::string &internalOptions);
 
+// Internal options of OpenCL program build, used by runtime and by ocloc when it shares compiler cache with runtime,
+// so both produce the same cache keys for the same device and options
+std::string getProgramInternalOptions(const ProgramInternalOptionsArgs &args, const CompilerProductHelper &compilerProductHelper);
+void appendProgramBuildInternalOptions(std::string &internalOptions, const std::string &options, std::string compilerExtensions, bool isBuiltIn);
+
 } // namespace NEO
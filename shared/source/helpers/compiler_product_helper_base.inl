@@ -124,6 +124,10 @@ std::string CompilerProductHelperHw<gfxProduct>::getDeviceExtensions(const Hardw
         extensions += "cl_khr_external_memory ";
     }
 
+    if (DebugManager.flags.ClKhrCommandBufferExtension.get()) {
+        extensions += "cl_khr_command_buffer ";
+    }
+
     if (DebugManager.flags.EnableNV12.get() && hwInfo.capabilityTable.supportsImages) {
         extensions += "cl_intel_planar_yuv ";
     }
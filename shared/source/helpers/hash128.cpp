@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace NEO {
+
+namespace Hash128Kernels {
+const uint64_t accumulateKeys[Hash128::stripesPerBlock + Hash128::numLanes] = {
+    0x232d540fc14dfab0ULL, 0xb962e0653724598cULL, 0x90b86c9c7ec20c60ULL, 0xb5cd0d5d7a02aaabULL,
+    0x856c0cd9232f4d27ULL, 0x8c7732b974156cb6ULL, 0xf8840ef154283b47ULL, 0xbef2d0f97b5cd7b8ULL,
+    0xe1e662862e36cbf0ULL, 0xeb82799c1ac687bbULL, 0x16df29362c9b2b9fULL, 0x8a6a64fb1547b89bULL,
+    0x6381e1b62004c098ULL, 0xbd570a75291d8a85ULL, 0x56e0eee71a85c304ULL, 0xc83681ded771c3bdULL,
+    0x304973414853c65fULL, 0x9d3dca5c1d81a657ULL, 0xbef9a6d5d6061596ULL, 0x47432871096d7e92ULL,
+    0x355943f4d906cde4ULL, 0x58acf8fc1e26ab39ULL, 0xa852d414f2d81c8dULL, 0xa47e408ae86cc749ULL};
+
+const uint64_t scrambleKeys[Hash128::numLanes] = {
+    0xacbae8c296f9a4c8ULL, 0x0a22efccfdff6e68ULL, 0xc364ba3c3579a5caULL, 0x8a2a849e67716f83ULL,
+    0x1fd1d18ea619177dULL, 0x33258dc787f9ae7fULL, 0x174f096897546544ULL, 0xc9dc4882b19a8518ULL};
+
+void accumulateScalar(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys) {
+    for (size_t stripe = 0; stripe < numStripes; ++stripe) {
+        for (size_t lane = 0; lane < Hash128::numLanes; ++lane) {
+            uint64_t value;
+            std::memcpy(&value, input + lane * sizeof(uint64_t), sizeof(uint64_t));
+            const auto keyed = value ^ keys[stripe + lane];
+            acc[lane ^ 1] += value;
+            acc[lane] += (keyed & 0xffffffffULL) * (keyed >> 32);
+        }
+        input += Hash128::stripeSize;
+    }
+}
+
+void scrambleScalar(uint64_t *acc, const uint64_t *keys) {
+    for (size_t lane = 0; lane < Hash128::numLanes; ++lane) {
+        auto value = acc[lane];
+        value ^= value >> 47;
+        value ^= keys[lane];
+        acc[lane] = value * scramblePrime;
+    }
+}
+} // namespace Hash128Kernels
+
+namespace {
+constexpr uint64_t prime64First = 0x9e3779b185ebca87ULL;
+constexpr uint64_t prime64Second = 0xc2b2ae3d27d4eb4fULL;
+
+uint64_t multiplyFold64(uint64_t lhs, uint64_t rhs) {
+    const uint64_t lhsLow = lhs & 0xffffffffULL;
+    const uint64_t lhsHigh = lhs >> 32;
+    const uint64_t rhsLow = rhs & 0xffffffffULL;
+    const uint64_t rhsHigh = rhs >> 32;
+
+    const uint64_t lowLow = lhsLow * rhsLow;
+    const uint64_t highLow = lhsHigh * rhsLow;
+    const uint64_t lowHigh = lhsLow * rhsHigh;
+    const uint64_t highHigh = lhsHigh * rhsHigh;
+
+    const uint64_t cross = (lowLow >> 32) + (highLow & 0xffffffffULL) + lowHigh;
+    const uint64_t upper = (highLow >> 32) + (cross >> 32) + highHigh;
+    const uint64_t lower = (cross << 32) | (lowLow & 0xffffffffULL);
+    return upper ^ lower;
+}
+
+uint64_t avalanche(uint64_t value) {
+    value ^= value >> 37;
+    value *= 0x165667919e3779f9ULL;
+    value ^= value >> 32;
+    return value;
+}
+
+uint64_t mergeAccumulators(const uint64_t *acc, const uint64_t *keys, uint64_t start) {
+    auto result = start;
+    for (size_t lane = 0; lane < Hash128::numLanes; lane += 2) {
+        result += multiplyFold64(acc[lane] ^ keys[lane], acc[lane + 1] ^ keys[lane + 1]);
+    }
+    return avalanche(result);
+}
+} // namespace
+
+std::string Hash128Value::toString() const {
+    std::stringstream stream;
+    stream << std::setfill('0') << std::hex
+           << std::setw(sizeof(high) * 2) << high
+           << std::setw(sizeof(low) * 2) << low;
+    return stream.str();
+}
+
+void Hash128::reset() {
+    acc[0] = 0xc2b2ae3dULL;
+    acc[1] = prime64First;
+    acc[2] = prime64Second;
+    acc[3] = 0x165667b19e3779f9ULL;
+    acc[4] = 0x85ebca77c2b2ae63ULL;
+    acc[5] = 0x27d4eb2f165667c5ULL;
+    acc[6] = 0x9e3779b1ULL;
+    acc[7] = 0x85ebca77ULL;
+    bufferedSize = 0u;
+    stripeInBlock = 0u;
+    totalSize = 0u;
+}
+
+void Hash128::processStripes(const uint8_t *input, size_t numStripes) {
+    while (numStripes > 0) {
+        const auto stripesToProcess = std::min(numStripes, stripesPerBlock - stripeInBlock);
+        accumulate(acc, input, stripesToProcess, Hash128Kernels::accumulateKeys + stripeInBlock);
+        stripeInBlock += stripesToProcess;
+        input += stripesToProcess * stripeSize;
+        numStripes -= stripesToProcess;
+
+        if (stripeInBlock == stripesPerBlock) {
+            scramble(acc, Hash128Kernels::scrambleKeys);
+            stripeInBlock = 0u;
+        }
+    }
+}
+
+void Hash128::update(const char *buff, size_t size) {
+    if (buff == nullptr || size == 0u) {
+        return;
+    }
+
+    auto input = reinterpret_cast<const uint8_t *>(buff);
+    totalSize += size;
+
+    if (bufferedSize > 0u) {
+        const auto bytesToCopy = std::min(size, stripeSize - bufferedSize);
+        memcpy_s(buffer + bufferedSize, stripeSize - bufferedSize, input, bytesToCopy);
+        bufferedSize += bytesToCopy;
+        input += bytesToCopy;
+        size -= bytesToCopy;
+        if (bufferedSize < stripeSize) {
+            return;
+        }
+        processStripes(buffer, 1u);
+        bufferedSize = 0u;
+    }
+
+    const auto numStripes = size / stripeSize;
+    processStripes(input, numStripes);
+    input += numStripes * stripeSize;
+    size -= numStripes * stripeSize;
+
+    if (size > 0u) {
+        memcpy_s(buffer, stripeSize, input, size);
+        bufferedSize = size;
+    }
+}
+
+Hash128Value Hash128::finish() const {
+    Hash128 state = *this;
+    if (state.bufferedSize > 0u) {
+        memset(state.buffer + state.bufferedSize, 0, stripeSize - state.bufferedSize);
+        state.processStripes(state.buffer, 1u);
+    }
+
+    Hash128Value value;
+    value.low = mergeAccumulators(state.acc, Hash128Kernels::accumulateKeys, totalSize * prime64First);
+    value.high = mergeAccumulators(state.acc, Hash128Kernels::accumulateKeys + stripesPerBlock, ~(totalSize * prime64Second));
+    return value;
+}
+
+} // namespace NEO
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+struct Hash128Value {
+    uint64_t low = 0u;
+    uint64_t high = 0u;
+
+    bool operator==(const Hash128Value &other) const {
+        return (low == other.low) && (high == other.high);
+    }
+
+    bool operator!=(const Hash128Value &other) const {
+        return !(*this == other);
+    }
+
+    std::string toString() const;
+};
+
+// 128-bit non-cryptographic hash processing input in 64-byte stripes of eight 64-bit lanes.
+// Stripe accumulation and scrambling are dispatched to scalar, SSE4 or AVX2 kernels,
+// all of which produce identical results.
+class Hash128 {
+  public:
+    static constexpr size_t numLanes = 8u;
+    static constexpr size_t stripeSize = numLanes * sizeof(uint64_t);
+    static constexpr size_t stripesPerBlock = 16u;
+
+    using AccumulateFunc = void (*)(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys);
+    using ScrambleFunc = void (*)(uint64_t *acc, const uint64_t *keys);
+
+    Hash128() {
+        reset();
+    }
+
+    void update(const char *buff, size_t size);
+    Hash128Value finish() const;
+    void reset();
+
+    static Hash128Value hash(const char *buff, size_t size) {
+        Hash128 hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+    static AccumulateFunc accumulate;
+    static ScrambleFunc scramble;
+
+  protected:
+    struct KernelSelector {
+        KernelSelector();
+        static KernelSelector initializer;
+    };
+
+    void processStripes(const uint8_t *input, size_t numStripes);
+
+    alignas(32) uint64_t acc[numLanes];
+    alignas(32) uint8_t buffer[stripeSize];
+    size_t bufferedSize;
+    size_t stripeInBlock;
+    uint64_t totalSize;
+};
+
+namespace Hash128Kernels {
+extern const uint64_t accumulateKeys[Hash128::stripesPerBlock + Hash128::numLanes];
+extern const uint64_t scrambleKeys[Hash128::numLanes];
+constexpr uint32_t scramblePrime = 0x9e3779b1u;
+
+void accumulateScalar(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys);
+void scrambleScalar(uint64_t *acc, const uint64_t *keys);
+void accumulateSse4(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys);
+void scrambleSse4(uint64_t *acc, const uint64_t *keys);
+void accumulateAvx2(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys);
+void scrambleAvx2(uint64_t *acc, const uint64_t *keys);
+} // namespace Hash128Kernels
+
+} // namespace NEO
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash128.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace Hash128Kernels {
+
+constexpr size_t lanesPerVector = sizeof(__m128i) / sizeof(uint64_t);
+constexpr size_t vectorsPerStripe = Hash128::numLanes / lanesPerVector;
+
+void accumulateSse4(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys) {
+    __m128i accVectors[vectorsPerStripe];
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        accVectors[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc) + i);
+    }
+
+    for (size_t stripe = 0; stripe < numStripes; ++stripe) {
+        for (size_t i = 0; i < vectorsPerStripe; ++i) {
+            const auto data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input) + i);
+            const auto key = _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + stripe) + i);
+            const auto keyed = _mm_xor_si128(data, key);
+            const auto product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(2, 3, 0, 1)));
+            const auto swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            accVectors[i] = _mm_add_epi64(accVectors[i], _mm_add_epi64(product, swapped));
+        }
+        input += Hash128::stripeSize;
+    }
+
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc) + i, accVectors[i]);
+    }
+}
+
+void scrambleSse4(uint64_t *acc, const uint64_t *keys) {
+    const auto prime = _mm_set1_epi32(static_cast<int>(scramblePrime));
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(acc) + i);
+        value = _mm_xor_si128(value, _mm_srli_epi64(value, 47));
+        value = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys) + i));
+        const auto productLow = _mm_mul_epu32(value, prime);
+        const auto productHigh = _mm_mul_epu32(_mm_srli_epi64(value, 32), prime);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(acc) + i, _mm_add_epi64(productLow, _mm_slli_epi64(productHigh, 32)));
+    }
+}
+
+} // namespace Hash128Kernels
+} // namespace NEO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#if __AVX2__
+#include "shared/source/helpers/hash128.h"
+
+#include <immintrin.h>
+
+namespace NEO {
+namespace Hash128Kernels {
+
+constexpr size_t lanesPerVector = sizeof(__m256i) / sizeof(uint64_t);
+constexpr size_t vectorsPerStripe = Hash128::numLanes / lanesPerVector;
+
+void accumulateAvx2(uint64_t *acc, const uint8_t *input, size_t numStripes, const uint64_t *keys) {
+    __m256i accVectors[vectorsPerStripe];
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        accVectors[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc) + i);
+    }
+
+    for (size_t stripe = 0; stripe < numStripes; ++stripe) {
+        for (size_t i = 0; i < vectorsPerStripe; ++i) {
+            const auto data = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input) + i);
+            const auto key = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys + stripe) + i);
+            const auto keyed = _mm256_xor_si256(data, key);
+            const auto product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(2, 3, 0, 1)));
+            const auto swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            accVectors[i] = _mm256_add_epi64(accVectors[i], _mm256_add_epi64(product, swapped));
+        }
+        input += Hash128::stripeSize;
+    }
+
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc) + i, accVectors[i]);
+    }
+}
+
+void scrambleAvx2(uint64_t *acc, const uint64_t *keys) {
+    const auto prime = _mm256_set1_epi32(static_cast<int>(scramblePrime));
+    for (size_t i = 0; i < vectorsPerStripe; ++i) {
+        auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(acc) + i);
+        value = _mm256_xor_si256(value, _mm256_srli_epi64(value, 47));
+        value = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(keys) + i));
+        const auto productLow = _mm256_mul_epu32(value, prime);
+        const auto productHigh = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc) + i, _mm256_add_epi64(productLow, _mm256_slli_epi64(productHigh, 32)));
+    }
+}
+
+} // namespace Hash128Kernels
+} // namespace NEO
+#endif
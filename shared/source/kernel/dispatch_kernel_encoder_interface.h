@@ -9,6 +9,7 @@
 #include <cstdint>
 
 namespace NEO {
+class DispatchWalkerTemplateCache;
 class GraphicsAllocation;
 struct ImplicitArgs;
 struct KernelDescriptor;
@@ -48,5 +49,7 @@ struct DispatchKernelEncoderI {
 
     virtual ImplicitArgs *getImplicitArgs() const = 0;
     virtual void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const = 0;
+
+    virtual DispatchWalkerTemplateCache *getWalkerTemplateCache() { return nullptr; }
 };
 } // namespace NEO
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/preemption_mode.h"
+#include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
+#include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Device;
+
+// Walker command with all fields that depend only on the kernel, its group size and the target device already programmed.
+// Dispatch copies it and programs only the per-dispatch fields (heaps, indirect data, group count, post sync) on top.
+struct DispatchWalkerTemplate {
+    struct Key {
+        const Device *device = nullptr;
+        uint64_t kernelStartPointer = 0u;
+        uint32_t groupSize[3] = {};
+        uint32_t slmTotalSize = 0u;
+        SlmPolicy slmPolicy = SlmPolicy::SlmPolicyNone;
+        PreemptionMode preemptionMode = PreemptionMode::Initial;
+        ThreadArbitrationPolicy threadArbitrationPolicy = ThreadArbitrationPolicy::NotPresent;
+        bool debuggerActive = false;
+
+        bool operator==(const Key &other) const {
+            return device == other.device &&
+                   kernelStartPointer == other.kernelStartPointer &&
+                   groupSize[0] == other.groupSize[0] &&
+                   groupSize[1] == other.groupSize[1] &&
+                   groupSize[2] == other.groupSize[2] &&
+                   slmTotalSize == other.slmTotalSize &&
+                   slmPolicy == other.slmPolicy &&
+                   preemptionMode == other.preemptionMode &&
+                   threadArbitrationPolicy == other.threadArbitrationPolicy &&
+                   debuggerActive == other.debuggerActive;
+        }
+    };
+
+    Key key;
+    std::array<uint64_t, 32> walker = {};
+};
+
+// Kernels may be appended to several command lists from different threads, so every access is serialized
+// and lookups copy the template out instead of handing out a pointer into the cache.
+class DispatchWalkerTemplateCache {
+  public:
+    static constexpr size_t maxEntries = 8u;
+
+    bool find(const DispatchWalkerTemplate::Key &key, DispatchWalkerTemplate &out) const {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto entry = std::find_if(entries.begin(), entries.end(), [&key](const auto &other) { return other.key == key; });
+        if (entry == entries.end()) {
+            return false;
+        }
+        out = *entry;
+        return true;
+    }
+
+    void add(const DispatchWalkerTemplate::Key &key, const void *walker, size_t walkerSize) {
+        UNRECOVERABLE_IF(walkerSize > sizeof(DispatchWalkerTemplate::walker));
+        std::lock_guard<std::mutex> lock(mutex);
+        if (entries.size() == maxEntries) {
+            entries.clear();
+        }
+        auto &entry = entries.emplace_back();
+        entry.key = key;
+        memcpy_s(entry.walker.data(), sizeof(DispatchWalkerTemplate::walker), walker, walkerSize);
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return entries.size();
+    }
+
+  protected:
+    mutable std::mutex mutex;
+    std::vector<DispatchWalkerTemplate> entries;
+};
+} // namespace NEO
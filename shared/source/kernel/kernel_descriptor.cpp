@@ -121,6 +121,17 @@ bool KernelDescriptor::isBindlessAddressingKernel(const KernelDescriptor &desc)
     return bindlessBuffers || bindlessImages;
 }
 
+bool KernelDescriptor::decodeDeferredMetadata() {
+    if (false == deferredMetadata.deferred) {
+        return true;
+    }
+    std::call_once(deferredMetadata.decodeOnce, [this]() {
+        auto decode = std::move(deferredMetadata.decode);
+        deferredMetadata.decodeFailed = (false == decode(*this));
+    });
+    return false == deferredMetadata.decodeFailed;
+}
+
 void KernelDescriptor::initBindlessOffsetToSurfaceState() {
     std::call_once(initBindlessArgsMapOnce, [this]() {
         uint32_t index = 0;
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -44,6 +45,10 @@ struct KernelDescriptor {
 
     void updateCrossThreadDataSize();
     void initBindlessOffsetToSurfaceState();
+    bool decodeDeferredMetadata();
+    bool hasDeferredMetadata() const {
+        return deferredMetadata.deferred;
+    }
     const BindlessToSurfaceStateMap &getBindlessOffsetToSurfaceState() const {
         return bindlessArgsMap;
     }
@@ -240,6 +245,15 @@ struct KernelDescriptor {
 
     BindlessToSurfaceStateMap bindlessArgsMap;
     std::once_flag initBindlessArgsMapOnce;
+
+    // Binary formats may postpone decoding of kernel metadata (e.g. arguments) until kernel is used,
+    // kernel name and heaps are always available
+    struct {
+        std::function<bool(KernelDescriptor &)> decode;
+        std::once_flag decodeOnce;
+        bool deferred = false;
+        bool decodeFailed = false;
+    } deferredMetadata;
 };
 
 } // namespace NEO
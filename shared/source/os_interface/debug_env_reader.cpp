@@ -10,10 +10,37 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/utilities/io_functions.h"
 
+#include <cstring>
 #include <vector>
 
 namespace NEO {
 
+EnvironmentVariableReader::EnvironmentVariableReader(char **environment) {
+    if (nullptr == environment) {
+        return;
+    }
+    for (auto entry = environment; *entry != nullptr; entry++) {
+        auto separator = strchr(*entry, '=');
+        if (nullptr == separator) {
+            continue;
+        }
+        // getenv returns the first occurrence of duplicated variable
+        environmentVariables.emplace(std::string(*entry, separator), std::string(separator + 1));
+    }
+    environmentSnapshotTaken = true;
+}
+
+const char *EnvironmentVariableReader::getEnvironmentVariable(const char *name) const {
+    if (!environmentSnapshotTaken) {
+        return IoFunctions::getenvPtr(name);
+    }
+    auto it = environmentVariables.find(name);
+    if (it == environmentVariables.end()) {
+        return nullptr;
+    }
+    return it->second.c_str();
+}
+
 const char *EnvironmentVariableReader::appSpecificLocation(const std::string &name) {
     return name.c_str();
 }
@@ -36,7 +63,7 @@ int32_t EnvironmentVariableReader::getSetting(const char *settingName, int32_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue, DebugVarPrefix &type) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
     auto prefixString = ApiSpecificConfig::getPrefixStrings();
     auto prefixType = ApiSpecificConfig::getPrefixTypes();
@@ -45,7 +72,7 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentVariable(neoKey.c_str());
         if (envValue) {
             value = atoll(envValue);
             type = prefixType[i];
@@ -59,9 +86,9 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentVariable(settingName);
     if (envValue) {
         value = atoll(envValue);
     }
@@ -69,7 +96,7 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
@@ -80,7 +107,7 @@ std::string EnvironmentVariableReader::getSetting(const char *settingName, const
     for (const auto &prefix : prefixString) {
         std::string neoKey = prefix;
         neoKey += settingName;
-        envValue = IoFunctions::getenvPtr(neoKey.c_str());
+        envValue = getEnvironmentVariable(neoKey.c_str());
         if (envValue) {
             keyValue.assign(envValue);
             type = prefixType[i];
@@ -93,11 +120,11 @@ std::string EnvironmentVariableReader::getSetting(const char *settingName, const
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvironmentVariable(settingName);
     if (envValue) {
         keyValue.assign(envValue);
     }
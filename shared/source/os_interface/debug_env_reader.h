@@ -10,10 +10,17 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
+#include <string>
+#include <unordered_map>
+
 namespace NEO {
 
 class EnvironmentVariableReader : public SettingsReader {
   public:
+    EnvironmentVariableReader() = default;
+    // Reads all variables in a single pass over given environment block, later lookups don't call getenv
+    explicit EnvironmentVariableReader(char **environment);
+
     int32_t getSetting(const char *settingName, int32_t defaultValue, DebugVarPrefix &type) override;
     int32_t getSetting(const char *settingName, int32_t defaultValue) override;
     int64_t getSetting(const char *settingName, int64_t defaultValue, DebugVarPrefix &type) override;
@@ -23,5 +30,11 @@ class EnvironmentVariableReader : public SettingsReader {
     std::string getSetting(const char *settingName, const std::string &value, DebugVarPrefix &type) override;
     std::string getSetting(const char *settingName, const std::string &value) override;
     const char *appSpecificLocation(const std::string &name) override;
+
+  protected:
+    const char *getEnvironmentVariable(const char *name) const;
+
+    std::unordered_map<std::string, std::string> environmentVariables;
+    bool environmentSnapshotTaken = false;
 };
 } // namespace NEO
@@ -20,9 +20,13 @@
 #include "shared/source/os_interface/aub_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+#include <chrono>
+
 namespace NEO {
 
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
@@ -135,12 +139,23 @@ bool DeviceFactory::isHwModeSelected() {
     }
 }
 
-static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
-                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
-    if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
-        return false;
-    }
+using InitTimePoint = std::chrono::steady_clock::time_point;
+
+static void printInitPhaseTime(const char *phase, const InitTimePoint &start) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintRootDeviceInitializationTimes.get(), stdout, "Root device initialization - %s: %lld us\n", phase, static_cast<long long>(elapsed));
+}
 
+static void printInitPhaseTime(const char *phase, uint32_t rootDeviceIndex, const InitTimePoint &start) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintRootDeviceInitializationTimes.get(), stdout, "Root device initialization - %s [%u]: %lld us\n", phase, rootDeviceIndex, static_cast<long long>(elapsed));
+}
+
+static bool isParallelRootDeviceInitializationEnabled(size_t numRootDevices) {
+    return (numRootDevices > 1) && (DebugManager.flags.ParallelRootDeviceInitialization.get() != 0);
+}
+
+static void initRootDeviceResources(ExecutionEnvironment &executionEnvironment, uint32_t rootDeviceIndex) {
     if (DebugManager.flags.OverrideGpuAddressSpace.get() != -1) {
         executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getMutableHardwareInfo()->capabilityTable.gpuAddressSpace =
             maxNBitValue(static_cast<uint64_t>(DebugManager.flags.OverrideGpuAddressSpace.get()));
@@ -152,36 +167,83 @@ static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
     }
 
     executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initGmm();
+}
+
+static bool initHwDeviceIdResources(ExecutionEnvironment &executionEnvironment,
+                                    std::unique_ptr<NEO::HwDeviceId> &&hwDeviceId, uint32_t rootDeviceIndex) {
+    auto start = std::chrono::steady_clock::now();
+    if (!executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceId), rootDeviceIndex)) {
+        return false;
+    }
+    printInitPhaseTime("os interface", rootDeviceIndex, start);
 
+    initRootDeviceResources(executionEnvironment, rootDeviceIndex);
+    return true;
+}
+
+// Root devices are independent until environments are sorted and filtered, so their os interfaces
+// (device open, kernel driver queries and hardware info setup) can be initialized concurrently.
+// Remaining per device setup is done afterwards in device order. Fails if any root device failed.
+static bool initHwDeviceIdResourcesInParallel(ExecutionEnvironment &executionEnvironment, std::vector<std::unique_ptr<HwDeviceId>> &hwDeviceIds) {
+    const auto numRootDevices = hwDeviceIds.size();
+    std::vector<uint8_t> osInterfaceInitialized(numRootDevices, false);
+
+    auto numThreads = std::min(static_cast<uint32_t>(numRootDevices), ThreadPool::getDefaultNumThreads());
+    ThreadPool threadPool(numThreads - 1);
+    threadPool.parallelFor(numRootDevices, [&](size_t index) {
+        auto rootDeviceIndex = static_cast<uint32_t>(index);
+        auto start = std::chrono::steady_clock::now();
+        osInterfaceInitialized[index] = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->initOsInterface(std::move(hwDeviceIds[index]), rootDeviceIndex);
+        printInitPhaseTime("os interface", rootDeviceIndex, start);
+    });
+
+    for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        if (!osInterfaceInitialized[rootDeviceIndex]) {
+            return false;
+        }
+        initRootDeviceResources(executionEnvironment, rootDeviceIndex);
+    }
     return true;
 }
 
 bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnvironment) {
     using HwDeviceIds = std::vector<std::unique_ptr<HwDeviceId>>;
 
+    auto start = std::chrono::steady_clock::now();
     HwDeviceIds hwDeviceIds = OSInterface::discoverDevices(executionEnvironment);
+    printInitPhaseTime("device discovery", start);
     if (hwDeviceIds.empty()) {
         return false;
     }
 
     executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(hwDeviceIds.size()));
 
-    uint32_t rootDeviceIndex = 0u;
-
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+    start = std::chrono::steady_clock::now();
+    if (isParallelRootDeviceInitializationEnabled(hwDeviceIds.size())) {
+        if (initHwDeviceIdResourcesInParallel(executionEnvironment, hwDeviceIds) == false) {
             return false;
         }
+    } else {
+        uint32_t rootDeviceIndex = 0u;
 
-        rootDeviceIndex++;
+        for (auto &hwDeviceId : hwDeviceIds) {
+            if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+                return false;
+            }
+
+            rootDeviceIndex++;
+        }
     }
+    printInitPhaseTime("root device environments", start);
 
+    start = std::chrono::steady_clock::now();
     executionEnvironment.setDeviceHierarchy(executionEnvironment.rootDeviceEnvironments[0]->getHelper<GfxCoreHelper>());
     executionEnvironment.sortNeoDevices();
     executionEnvironment.parseAffinityMask();
     executionEnvironment.adjustRootDeviceEnvironments();
     executionEnvironment.adjustCcsCount();
     executionEnvironment.calculateMaxOsContextCount();
+    printInitPhaseTime("execution environment setup", start);
 
     return true;
 }
@@ -226,12 +288,16 @@ std::vector<std::unique_ptr<Device>> DeviceFactory::createDevices(ExecutionEnvir
         return devices;
     }
 
+    auto start = std::chrono::steady_clock::now();
     if (!DeviceFactory::createMemoryManagerFunc(executionEnvironment)) {
         return devices;
     }
+    printInitPhaseTime("memory manager", start);
 
     for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < executionEnvironment.rootDeviceEnvironments.size(); rootDeviceIndex++) {
+        start = std::chrono::steady_clock::now();
         auto device = createRootDeviceFunc(executionEnvironment, rootDeviceIndex);
+        printInitPhaseTime("device", rootDeviceIndex, start);
         if (device) {
             devices.push_back(std::move(device));
         }
@@ -30,7 +30,12 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResident(Device *devi
     auto &engines = device->getAllEngines();
     MemoryOperationsStatus result = MemoryOperationsStatus::SUCCESS;
     for (const auto &engine : engines) {
-        engine.commandStreamReceiver->initializeResources();
+        if (!engine.osContext->isInitialized()) {
+            // engine not used yet, allocations are bound in mergeWithResidencyContainer on its first submission
+            std::lock_guard<std::mutex> lock(mutex);
+            deferredResidency[engine.osContext->getContextId()].insert(gfxAllocations.begin(), gfxAllocations.end());
+            continue;
+        }
         result = this->makeResidentWithinOsContext(engine.osContext, gfxAllocations, false);
         if (result != MemoryOperationsStatus::SUCCESS) {
             break;
@@ -40,9 +45,13 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResident(Device *devi
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return this->makeResidentWithinOsContextImpl(osContext, gfxAllocations, evictable);
+}
+
+MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContextImpl(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
-    std::lock_guard<std::mutex> lock(mutex);
     auto devicesDone = 0u;
     for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
         if (!deviceBitfield.test(drmIterator)) {
@@ -88,6 +97,10 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evict(Device *device, Gra
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictWithinOsContext(OsContext *osContext, GraphicsAllocation &gfxAllocation) {
     std::lock_guard<std::mutex> lock(mutex);
+    auto deferred = deferredResidency.find(osContext->getContextId());
+    if (deferred != deferredResidency.end()) {
+        deferred->second.erase(&gfxAllocation);
+    }
     int retVal = evictImpl(osContext, gfxAllocation, osContext->getDeviceBitfield());
     if (retVal) {
         return MemoryOperationsStatus::FAILED;
@@ -115,7 +128,13 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device
     bool isResident = true;
     auto &engines = device->getAllEngines();
     for (const auto &engine : engines) {
-        isResident &= gfxAllocation.isAlwaysResident(engine.osContext->getContextId());
+        auto contextId = engine.osContext->getContextId();
+        if (!engine.osContext->isInitialized()) {
+            auto deferred = deferredResidency.find(contextId);
+            isResident &= (deferred != deferredResidency.end()) && (deferred->second.count(&gfxAllocation) > 0);
+            continue;
+        }
+        isResident &= gfxAllocation.isAlwaysResident(contextId);
     }
 
     if (isResident) {
@@ -125,6 +144,19 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::isResident(Device *device
 }
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::mergeWithResidencyContainer(OsContext *osContext, ResidencyContainer &residencyContainer) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto deferred = deferredResidency.find(osContext->getContextId());
+        if (deferred != deferredResidency.end()) {
+            std::vector<GraphicsAllocation *> deferredAllocations(deferred->second.begin(), deferred->second.end());
+            deferredResidency.erase(deferred);
+            auto retVal = this->makeResidentWithinOsContextImpl(osContext, ArrayRef<GraphicsAllocation *>(deferredAllocations), false);
+            if (retVal != MemoryOperationsStatus::SUCCESS) {
+                return retVal;
+            }
+        }
+    }
+
     if (DebugManager.flags.MakeEachAllocationResident.get() == 2) {
         auto memoryManager = static_cast<DrmMemoryManager *>(this->rootDeviceEnvironment.executionEnvironment.memoryManager.get());
 
@@ -29,6 +29,7 @@
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler_bind.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
@@ -443,6 +444,9 @@ int Drm::setupHardwareInfo(const DeviceDescriptor *device, bool setupFeatureTabl
     const auto productFamily = hwInfo->platform.eProductFamily;
     setupIoctlHelper(productFamily);
     ioctlHelper->setupIpVersion();
+    if (prefetchSetupQueries) {
+        prefetchQueries(ioctlHelper->getSetupQueryIds());
+    }
     rootDeviceEnvironment.initReleaseHelper();
 
     DrmQueryTopologyData topologyData = {};
@@ -605,8 +609,31 @@ std::string Drm::getDrmVersion(int fileDescriptor) {
     return std::string(name);
 }
 
+template <typename DataType>
+static std::vector<DataType> copyQueryData(const std::vector<uint8_t> &queryData) {
+    auto data = std::vector<DataType>(Math::divideAndRoundUp(queryData.size(), sizeof(DataType)), 0);
+    memcpy(data.data(), queryData.data(), queryData.size());
+    return data;
+}
+
 template <typename DataType>
 std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
+    if (queryCache) {
+        if (auto cachedData = queryCache->getQueryData(queryId, queryItemFlags)) {
+            return copyQueryData<DataType>(*cachedData);
+        }
+    }
+
+    auto prefetchedData = prefetchedQueries.find({queryId, queryItemFlags});
+    if (prefetchedData != prefetchedQueries.end()) {
+        auto data = copyQueryData<DataType>(prefetchedData->second);
+        if (queryCache) {
+            queryCache->storeQueryData(queryId, queryItemFlags, prefetchedData->second.data(), prefetchedData->second.size());
+        }
+        prefetchedQueries.erase(prefetchedData);
+        return data;
+    }
+
     Query query{};
     QueryItem queryItem{};
     queryItem.queryId = queryId;
@@ -627,9 +654,101 @@ std::vector<DataType> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     if (ret != 0 || queryItem.length <= 0) {
         return {};
     }
+
+    if (queryCache) {
+        queryCache->storeQueryData(queryId, queryItemFlags, data.data(), std::min(static_cast<size_t>(queryItem.length), data.size() * sizeof(DataType)));
+    }
     return data;
 }
 
+static std::string readFirstLine(const char *filePath) {
+    std::string line(256, '\0');
+    int fd = SysCalls::open(filePath, O_RDONLY);
+    if (fd < 0) {
+        return {};
+    }
+    auto bytesRead = SysCalls::pread(fd, line.data(), line.size() - 1, 0);
+    SysCalls::close(fd);
+    if (bytesRead <= 0) {
+        return {};
+    }
+    line.resize(static_cast<size_t>(bytesRead));
+    return line.substr(0, line.find('\n'));
+}
+
+std::string Drm::getQueryCacheKey() {
+    char name[32] = {};
+    char date[32] = {};
+    DrmVersion version = {};
+    version.name = name;
+    version.nameLen = sizeof(name) - 1;
+    version.date = date;
+    version.dateLen = sizeof(date) - 1;
+
+    auto requestValue = getIoctlRequestValue(DrmIoctl::Version, nullptr);
+    if (SysCalls::ioctl(getFileDescriptor(), requestValue, &version) != 0) {
+        return {};
+    }
+
+    // Query results change only with a different device, kernel or kernel driver module
+    auto hwInfo = rootDeviceEnvironment.getHardwareInfo();
+    auto moduleVersionPath = std::string("/sys/module/") + name + "/srcversion";
+    std::stringstream key;
+    key << hwDeviceId->getPciPath() << ";"
+        << name << " " << version.versionMajor << "." << version.versionMinor << "." << version.versionPatch << " " << date << ";"
+        << readFirstLine(moduleVersionPath.c_str()) << ";"
+        << readFirstLine("/proc/sys/kernel/osrelease") << ";"
+        << std::hex << hwInfo->platform.usDeviceID << "." << hwInfo->platform.usRevId;
+    return key.str();
+}
+
+void Drm::setupQueryCache() {
+    auto cacheDir = DrmQueryCache::getCacheDir();
+    if (cacheDir.empty()) {
+        return;
+    }
+    auto key = getQueryCacheKey();
+    if (key.empty()) {
+        return;
+    }
+    queryCache = DrmQueryCache::create(cacheDir, hwDeviceId->getPciPath(), key);
+}
+
+void Drm::prefetchQueries(const std::vector<uint32_t> &queryIds) {
+    std::vector<QueryItem> queryItems;
+    for (auto queryId : queryIds) {
+        if (queryCache && queryCache->getQueryData(queryId, 0u)) {
+            continue;
+        }
+        QueryItem queryItem{};
+        queryItem.queryId = queryId;
+        queryItems.push_back(queryItem);
+    }
+    if (queryItems.empty()) {
+        return;
+    }
+
+    std::vector<std::vector<uint8_t>> queryData;
+    if (ioctlHelper->queryBatch(queryItems, queryData) != 0) {
+        // Kernel driver rejects whole batch when any item is unknown, queries are issued one by one then
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "INFO: Batched device setup query failed\n");
+        return;
+    }
+    for (auto i = 0u; i < queryItems.size(); i++) {
+        if (false == queryData[i].empty()) {
+            prefetchedQueries[{queryItems[i].queryId, 0u}] = std::move(queryData[i]);
+        }
+    }
+}
+
+void Drm::releaseQueryCache() {
+    if (queryCache && queryCache->isModified()) {
+        queryCache->save();
+    }
+    queryCache.reset();
+    prefetchedQueries.clear();
+}
+
 void Drm::printIoctlStatistics() {
     if (!DebugManager.flags.PrintIoctlTimes.get()) {
         return;
@@ -21,6 +21,7 @@
 #include <array>
 #include <cstdint>
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -46,6 +47,7 @@ enum class SubmissionStatus : uint32_t;
 class BufferObject;
 class CompilerProductHelper;
 class DeviceFactory;
+class DrmQueryCache;
 class MemoryInfo;
 class OsContext;
 class OsContextLinux;
@@ -261,10 +263,17 @@ class Drm : public DriverModel {
     std::vector<DataType> query(uint32_t queryId, uint32_t queryItemFlags);
     static std::string getDrmVersion(int fileDescriptor);
 
+    void setupQueryCache();
+    void setPrefetchSetupQueries(bool prefetch) { prefetchSetupQueries = prefetch; }
+    void prefetchQueries(const std::vector<uint32_t> &queryIds);
+    void releaseQueryCache();
+    DrmQueryCache *getQueryCache() const { return queryCache.get(); }
+
   protected:
     Drm(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceIdIn, RootDeviceEnvironment &rootDeviceEnvironment);
 
     int getQueueSliceCount(GemContextParamSseu *sseu);
+    std::string getQueryCacheKey();
     std::string generateUUID();
     std::string generateElfUUID(const void *data);
     void printIoctlStatistics();
@@ -325,6 +334,8 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQueryCache> queryCache;
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> prefetchedQueries;
 
     std::once_flag checkBindOnce;
     std::once_flag checkSetPairOnce;
@@ -348,6 +359,7 @@ class Drm : public DriverModel {
     bool pageFaultSupported = false;
     bool completionFenceSupported = false;
     bool vmBindPatIndexProgrammingSupported = false;
+    bool prefetchSetupQueries = false;
 
   private:
     int getParamIoctl(DrmParam param, int *dstValue);
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sstream>
+
+namespace NEO {
+
+std::string DrmQueryCache::getCacheDir() {
+    const char *cacheDir = IoFunctions::getenvPtr(cacheDirEnvVariable);
+    if (nullptr == cacheDir || false == SysCalls::pathExists(cacheDir)) {
+        return {};
+    }
+    return cacheDir;
+}
+
+std::unique_ptr<DrmQueryCache> DrmQueryCache::create(const std::string &cacheDir, const std::string &pciPath, const std::string &key) {
+    std::stringstream fileName;
+    fileName << std::hex << Hash::hash(pciPath.c_str(), pciPath.size()) << cacheFileExtension;
+    auto filePath = cacheDir + "/" + fileName.str();
+
+    auto queryCache = std::make_unique<DrmQueryCache>(filePath, key);
+    if (false == queryCache->load()) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stdout, "INFO: Topology cache %s not found or outdated\n", filePath.c_str());
+    }
+    return queryCache;
+}
+
+const std::vector<uint8_t> *DrmQueryCache::getQueryData(uint32_t queryId, uint32_t queryItemFlags) const {
+    auto it = entries.find({queryId, queryItemFlags});
+    if (it == entries.end()) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+void DrmQueryCache::storeQueryData(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize) {
+    auto begin = reinterpret_cast<const uint8_t *>(data);
+    entries[{queryId, queryItemFlags}].assign(begin, begin + dataSize);
+    modified = true;
+}
+
+std::vector<uint8_t> DrmQueryCache::serialize() const {
+    size_t size = sizeof(FileHeader) + key.size();
+    for (auto &entry : entries) {
+        size += sizeof(EntryHeader) + entry.second.size();
+    }
+
+    std::vector<uint8_t> data(size, 0u);
+    auto payload = data.data() + sizeof(FileHeader);
+    memcpy(payload, key.data(), key.size());
+
+    auto entryPos = payload + key.size();
+    for (auto &entry : entries) {
+        EntryHeader entryHeader = {entry.first.first, entry.first.second, static_cast<uint64_t>(entry.second.size())};
+        memcpy(entryPos, &entryHeader, sizeof(EntryHeader));
+        entryPos += sizeof(EntryHeader);
+        if (false == entry.second.empty()) {
+            memcpy(entryPos, entry.second.data(), entry.second.size());
+        }
+        entryPos += entry.second.size();
+    }
+
+    FileHeader header = {};
+    memcpy(header.magic, fileMagic, sizeof(header.magic));
+    header.version = cacheFileVersion;
+    header.keySize = static_cast<uint32_t>(key.size());
+    header.numEntries = static_cast<uint32_t>(entries.size());
+    header.payloadHash = Hash::hash(reinterpret_cast<const char *>(payload), size - sizeof(FileHeader));
+    memcpy(data.data(), &header, sizeof(FileHeader));
+    return data;
+}
+
+bool DrmQueryCache::deserialize(ArrayRef<const uint8_t> data) {
+    if (data.size() < sizeof(FileHeader)) {
+        return false;
+    }
+
+    FileHeader header = {};
+    memcpy(&header, data.begin(), sizeof(FileHeader));
+    if ((0 != memcmp(header.magic, fileMagic, sizeof(header.magic))) || (cacheFileVersion != header.version) || (key.size() != header.keySize)) {
+        return false;
+    }
+
+    auto payload = data.begin() + sizeof(FileHeader);
+    auto payloadSize = data.size() - sizeof(FileHeader);
+    if ((payloadSize < key.size()) || (0 != memcmp(payload, key.data(), key.size()))) {
+        return false;
+    }
+    if (header.payloadHash != Hash::hash(reinterpret_cast<const char *>(payload), payloadSize)) {
+        return false;
+    }
+
+    decltype(entries) decodedEntries;
+    auto entryPos = payload + key.size();
+    for (uint32_t i = 0u; i < header.numEntries; i++) {
+        if (static_cast<size_t>(data.end() - entryPos) < sizeof(EntryHeader)) {
+            return false;
+        }
+        EntryHeader entryHeader = {};
+        memcpy(&entryHeader, entryPos, sizeof(EntryHeader));
+        entryPos += sizeof(EntryHeader);
+        if (static_cast<uint64_t>(data.end() - entryPos) < entryHeader.dataSize) {
+            return false;
+        }
+        decodedEntries[{entryHeader.queryId, entryHeader.queryItemFlags}].assign(entryPos, entryPos + entryHeader.dataSize);
+        entryPos += entryHeader.dataSize;
+    }
+    if (entryPos != data.end()) {
+        return false;
+    }
+
+    entries = std::move(decodedEntries);
+    modified = false;
+    return true;
+}
+
+bool DrmQueryCache::load() {
+    int fd = SysCalls::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    bool loaded = false;
+    struct stat statbuf = {};
+    if ((0 == SysCalls::fstat(fd, &statbuf)) && (statbuf.st_size > 0)) {
+        std::vector<uint8_t> data(static_cast<size_t>(statbuf.st_size));
+        if (SysCalls::pread(fd, data.data(), data.size(), 0) == static_cast<ssize_t>(data.size())) {
+            loaded = deserialize(data);
+        }
+    }
+    SysCalls::close(fd);
+    return loaded;
+}
+
+bool DrmQueryCache::save() const {
+    auto data = serialize();
+
+    // Write to a temporary file first, so concurrent processes never read partially written cache
+    std::string tmpFilePath = filePath + ".XXXXXX";
+    int fd = SysCalls::mkstemp(tmpFilePath.data());
+    if (fd < 0) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "WARNING: Creating topology cache file in %s failed\n", filePath.c_str());
+        return false;
+    }
+    auto written = SysCalls::pwrite(fd, data.data(), data.size(), 0);
+    auto closed = SysCalls::close(fd);
+    if ((written != static_cast<ssize_t>(data.size())) || (closed != 0) || (SysCalls::rename(tmpFilePath.c_str(), filePath.c_str()) != 0)) {
+        PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "WARNING: Writing topology cache file %s failed\n", filePath.c_str());
+        SysCalls::unlink(tmpFilePath);
+        return false;
+    }
+    return true;
+}
+
+} // namespace NEO
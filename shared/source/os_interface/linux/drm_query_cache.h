@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/arrayref.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// On-disk cache of kernel driver query results (engines, memory regions, topology, hwconfig) of a single device.
+// It is opt-in - enabled when NEO_TOPOLOGY_CACHE_DIR points to an existing directory.
+// Key identifies device and kernel driver build, cache file with different key is ignored and overwritten.
+class DrmQueryCache : NonCopyableOrMovableClass {
+  public:
+    static constexpr const char *cacheDirEnvVariable = "NEO_TOPOLOGY_CACHE_DIR";
+    static constexpr const char *cacheFileExtension = ".topology_cache";
+    static constexpr uint32_t cacheFileVersion = 1u;
+
+    DrmQueryCache(const std::string &filePath, const std::string &key) : filePath(filePath), key(key) {}
+
+    static std::string getCacheDir();
+    static std::unique_ptr<DrmQueryCache> create(const std::string &cacheDir, const std::string &pciPath, const std::string &key);
+
+    const std::vector<uint8_t> *getQueryData(uint32_t queryId, uint32_t queryItemFlags) const;
+    void storeQueryData(uint32_t queryId, uint32_t queryItemFlags, const void *data, size_t dataSize);
+
+    bool load();
+    bool save() const;
+
+    std::vector<uint8_t> serialize() const;
+    bool deserialize(ArrayRef<const uint8_t> data);
+
+    bool isModified() const { return modified; }
+    const std::string &getFilePath() const { return filePath; }
+
+  protected:
+    struct FileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t keySize;
+        uint32_t numEntries;
+        uint32_t reserved;
+        uint64_t payloadHash;
+    };
+
+    struct EntryHeader {
+        uint32_t queryId;
+        uint32_t queryItemFlags;
+        uint64_t dataSize;
+    };
+
+    static constexpr char fileMagic[8] = "NEOTOPO";
+
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> entries;
+    std::string filePath;
+    std::string key;
+    bool modified = false;
+};
+
+} // namespace NEO
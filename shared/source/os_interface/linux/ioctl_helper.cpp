@@ -393,6 +393,52 @@ bool IoctlHelper::checkIfIoctlReinvokeRequired(int error, DrmIoctl ioctlRequest)
     return (error == EINTR || error == EAGAIN || error == EBUSY || error == -EBUSY);
 }
 
+// Queries all items at once - first call gets sizes of all items, second one gets data of items with valid size.
+// Items not supported by kernel driver are left with empty data and their error code in length.
+int IoctlHelper::queryBatch(std::vector<QueryItem> &queryItems, std::vector<std::vector<uint8_t>> &queryData) {
+    queryData.clear();
+    queryData.resize(queryItems.size());
+    for (auto &queryItem : queryItems) {
+        queryItem.length = 0;
+        queryItem.dataPtr = 0u;
+    }
+
+    Query query{};
+    query.itemsPtr = castToUint64(queryItems.data());
+    query.numItems = static_cast<uint32_t>(queryItems.size());
+    auto ret = ioctl(DrmIoctl::Query, &query);
+    if (ret != 0) {
+        return ret;
+    }
+
+    std::vector<QueryItem> dataQueryItems;
+    std::vector<size_t> dataQueryItemIndices;
+    for (auto i = 0u; i < queryItems.size(); i++) {
+        if (queryItems[i].length > 0) {
+            queryData[i].resize(static_cast<size_t>(queryItems[i].length));
+            auto dataQueryItem = queryItems[i];
+            dataQueryItem.dataPtr = castToUint64(queryData[i].data());
+            dataQueryItems.push_back(dataQueryItem);
+            dataQueryItemIndices.push_back(i);
+        }
+    }
+    if (dataQueryItems.empty()) {
+        return 0;
+    }
+
+    query.itemsPtr = castToUint64(dataQueryItems.data());
+    query.numItems = static_cast<uint32_t>(dataQueryItems.size());
+    ret = ioctl(DrmIoctl::Query, &query);
+    for (auto i = 0u; i < dataQueryItems.size(); i++) {
+        auto &queryItem = queryItems[dataQueryItemIndices[i]];
+        queryItem.length = dataQueryItems[i].length;
+        if ((ret != 0) || (queryItem.length <= 0)) {
+            queryData[dataQueryItemIndices[i]].clear();
+        }
+    }
+    return ret;
+}
+
 std::unique_ptr<MemoryInfo> IoctlHelper::createMemoryInfo() {
     auto request = getDrmParamValue(DrmParam::QueryMemoryRegions);
     auto dataQuery = drm.query<uint64_t>(request, 0);
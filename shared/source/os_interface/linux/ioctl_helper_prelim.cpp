@@ -517,6 +517,13 @@ int IoctlHelperPrelim20::queryDistances(std::vector<QueryItem> &queryItems, std:
     return ret;
 }
 
+std::vector<uint32_t> IoctlHelperPrelim20::getSetupQueryIds() const {
+    // Topology is queried per tile with engine specific flags, so it is not part of the batch
+    return {static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryHwconfigTable)),
+            static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryMemoryRegions)),
+            static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryEngineInfo))};
+}
+
 std::optional<DrmParam> IoctlHelperPrelim20::getHasPageFaultParamId() {
     return DrmParam::ParamHasPageFault;
 };
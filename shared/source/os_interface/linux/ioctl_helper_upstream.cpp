@@ -179,6 +179,13 @@ int IoctlHelperUpstream::queryDistances(std::vector<QueryItem> &queryItems, std:
     return 0;
 }
 
+std::vector<uint32_t> IoctlHelperUpstream::getSetupQueryIds() const {
+    return {static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryTopologyInfo)),
+            static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryHwconfigTable)),
+            static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryMemoryRegions)),
+            static_cast<uint32_t>(getDrmParamValue(DrmParam::QueryEngineInfo))};
+}
+
 uint16_t IoctlHelperUpstream::getWaitUserFenceSoftFlag() {
     return 0;
 }
@@ -6,10 +6,16 @@
  */
 
 #include "shared/source/os_interface/debug_env_reader.h"
+#include "shared/source/utilities/io_functions.h"
 
 namespace NEO {
 
 SettingsReader *SettingsReader::createOsReader(bool userScope, const std::string &regKey) {
-    return new EnvironmentVariableReader;
+    if (userScope) {
+        // user scope settings (e.g. AUB subcapture toggle) are polled at runtime and must see environment changes
+        return new EnvironmentVariableReader;
+    }
+    // Settings reader looks up every debug variable with all prefixes, so environment is read once upfront
+    return new EnvironmentVariableReader(IoFunctions::getEnvironmentPtr());
 }
 } // namespace NEO
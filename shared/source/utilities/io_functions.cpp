@@ -7,12 +7,25 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#if !defined(_WIN32)
+extern char **environ;
+#endif
+
 namespace NEO {
 namespace IoFunctions {
+static char **getEnvironment() {
+#if defined(_WIN32)
+    return _environ;
+#else
+    return environ;
+#endif
+}
+
 fopenFuncPtr fopenPtr = &fopen;
 vfprintfFuncPtr vfprintfPtr = &vfprintf;
 fcloseFuncPtr fclosePtr = &fclose;
 getenvFuncPtr getenvPtr = &getenv;
+getEnvironmentFuncPtr getEnvironmentPtr = &getEnvironment;
 fseekFuncPtr fseekPtr = &fseek;
 ftellFuncPtr ftellPtr = &ftell;
 rewindFuncPtr rewindPtr = &rewind;
@@ -16,6 +16,7 @@ using fopenFuncPtr = FILE *(*)(const char *, const char *);
 using vfprintfFuncPtr = int (*)(FILE *, char const *const formatStr, va_list arg);
 using fcloseFuncPtr = int (*)(FILE *);
 using getenvFuncPtr = decltype(&getenv);
+using getEnvironmentFuncPtr = char **(*)();
 using fseekFuncPtr = decltype(&fseek);
 using ftellFuncPtr = decltype(&ftell);
 using rewindFuncPtr = decltype(&rewind);
@@ -27,6 +28,7 @@ extern fopenFuncPtr fopenPtr;
 extern vfprintfFuncPtr vfprintfPtr;
 extern fcloseFuncPtr fclosePtr;
 extern getenvFuncPtr getenvPtr;
+extern getEnvironmentFuncPtr getEnvironmentPtr;
 extern fseekFuncPtr fseekPtr;
 extern ftellFuncPtr ftellPtr;
 extern rewindFuncPtr rewindPtr;
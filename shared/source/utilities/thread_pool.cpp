@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_pool.h"
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+namespace NEO {
+
+ThreadPool::ThreadPool(uint32_t numThreads) : numThreads(numThreads) {}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+uint32_t ThreadPool::getDefaultNumThreads() {
+    auto hwThreads = std::thread::hardware_concurrency();
+    return std::max(1u, std::min(hwThreads, 16u));
+}
+
+std::future<void> ThreadPool::enqueue(std::function<void()> task) {
+    std::packaged_task<void()> packagedTask(std::move(task));
+    auto future = packagedTask.get_future();
+    if (numThreads == 0u) {
+        packagedTask();
+        return future;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        ensureThreads();
+        tasks.push_back(std::move(packagedTask));
+    }
+    condition.notify_one();
+    return future;
+}
+
+void ThreadPool::parallelFor(size_t count, const std::function<void(size_t)> &task) {
+    if (numThreads == 0u || count <= 1u) {
+        for (size_t i = 0u; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    auto state = std::make_shared<ParallelForState>();
+    state->task = task;
+    state->count = count;
+
+    auto numHelpers = std::min(static_cast<size_t>(numThreads), count - 1);
+    for (size_t i = 0u; i < numHelpers; i++) {
+        // Helpers started after all items were taken exit without touching the task
+        enqueue([state]() { runParallelFor(*state); });
+    }
+    runParallelFor(*state);
+
+    std::unique_lock<std::mutex> lock(state->mtx);
+    state->condition.wait(lock, [&state] { return state->completed == state->count; });
+}
+
+void ThreadPool::runParallelFor(ParallelForState &state) {
+    while (true) {
+        auto index = state.nextIndex++;
+        if (index >= state.count) {
+            break;
+        }
+        state.task(index);
+
+        std::lock_guard<std::mutex> lock(state.mtx);
+        if (++state.completed == state.count) {
+            state.condition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::ensureThreads() {
+    // Called with mtx acquired
+    while (workers.size() < numThreads) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
+}
+
+void ThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopRequested = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+void *ThreadPool::run(void *arg) {
+    auto self = reinterpret_cast<ThreadPool *>(arg);
+    std::unique_lock<std::mutex> lock(self->mtx);
+    while (true) {
+        self->condition.wait(lock, [self] { return self->stopRequested || !self->tasks.empty(); });
+        if (self->tasks.empty()) {
+            // Queue is drained before workers exit
+            break;
+        }
+        auto task = std::move(self->tasks.front());
+        self->tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+    }
+    return nullptr;
+}
+
+} // namespace NEO
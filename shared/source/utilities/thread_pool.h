@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+// Fixed-size pool of worker threads executing tasks in FIFO order.
+// Worker threads are created lazily on first enqueue. Pool with zero workers executes tasks inline.
+class ThreadPool : NonCopyableOrMovableClass {
+  public:
+    explicit ThreadPool(uint32_t numThreads);
+    ~ThreadPool();
+
+    std::future<void> enqueue(std::function<void()> task);
+
+    // Executes task(i) for each i in [0, count) on pool workers and the calling thread, returns when all are done.
+    // Calling thread takes part in execution, so it is safe to call from within a task running on this pool.
+    void parallelFor(size_t count, const std::function<void(size_t)> &task);
+    uint32_t getNumThreads() const { return numThreads; }
+
+    static uint32_t getDefaultNumThreads();
+
+  protected:
+    void ensureThreads();
+    void stop();
+
+    struct ParallelForState {
+        std::function<void(size_t)> task;
+        size_t count = 0u;
+        std::atomic<size_t> nextIndex{0u};
+        size_t completed = 0u;
+        std::mutex mtx;
+        std::condition_variable condition;
+    };
+    static void runParallelFor(ParallelForState &state);
+
+    static void *run(void *arg);
+
+    const uint32_t numThreads;
+    bool stopRequested = false;
+    std::deque<std::packaged_task<void()>> tasks;
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::mutex mtx;
+    std::condition_variable condition;
+};
+
+} // namespace NEO
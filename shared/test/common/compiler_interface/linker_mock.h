@@ -41,8 +41,10 @@ struct WhiteBox<NEO::Linker> : NEO::Linker {
     using BaseClass::patchDataSegments;
     using BaseClass::patchInstructionsSegments;
     using BaseClass::relocatedSymbols;
+    using BaseClass::relocatedSymbolsById;
     using BaseClass::relocateSymbols;
     using BaseClass::resolveExternalFunctions;
+    using BaseClass::threadPool;
 };
 
 template <typename MockT, typename ReturnT, typename... ArgsT>
@@ -46,6 +46,7 @@ class DrmMock : public Drm {
     using Drm::pagingFence;
     using Drm::preemptionSupported;
     using Drm::query;
+    using Drm::queryCache;
     using Drm::queryAndSetVmBindPatIndexProgrammingSupport;
     using Drm::queryDeviceIdAndRevision;
     using Drm::requirePerContextVM;
@@ -13,6 +13,7 @@ fopenFuncPtr fopenPtr = &mockFopen;
 vfprintfFuncPtr vfprintfPtr = &mockVfptrinf;
 fcloseFuncPtr fclosePtr = &mockFclose;
 getenvFuncPtr getenvPtr = &mockGetenv;
+getEnvironmentFuncPtr getEnvironmentPtr = &mockGetEnvironment;
 fseekFuncPtr fseekPtr = &mockFseek;
 ftellFuncPtr ftellPtr = &mockFtell;
 rewindFuncPtr rewindPtr = &mockRewind;
@@ -26,6 +27,7 @@ uint32_t failAfterNFopenCount = 0;
 uint32_t mockVfptrinfCalled = 0;
 uint32_t mockFcloseCalled = 0;
 uint32_t mockGetenvCalled = 0;
+uint32_t mockGetEnvironmentCalled = 0;
 uint32_t mockFseekCalled = 0;
 uint32_t mockFtellCalled = 0;
 long int mockFtellReturn = 0;
@@ -39,6 +41,7 @@ bool mockVfptrinfUseStdioFunction = false;
 const char *openCLDriverName = "igdrcl.dll";
 
 std::unordered_map<std::string, std::string> *mockableEnvValues = nullptr;
+char **mockEnvironment = nullptr;
 
 } // namespace IoFunctions
 } // namespace NEO
@@ -32,7 +32,14 @@ class CompilerCacheMock : public CompilerCache {
             return nullptr;
     }
 
+    std::shared_ptr<const CachedBinary> mapCachedBinary(const std::string &kernelFileHash) override {
+        mapInvoked++;
+        return mapResult;
+    }
+
     std::vector<std::string> cacheBinaryKernelFileHashes{};
+    std::shared_ptr<const CachedBinary> mapResult;
+    uint32_t mapInvoked = 0u;
     bool cacheResult = false;
     uint32_t cacheInvoked = 0u;
     bool loadResult = false;
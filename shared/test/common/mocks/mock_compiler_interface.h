@@ -23,12 +23,15 @@ class MockCompilerInterface : public CompilerInterface {
   public:
     using CompilerInterface::cache;
     using CompilerInterface::checkIcbeVersionOnce;
+    using CompilerInterface::concurrencyMode;
     using CompilerInterface::fclBaseTranslationCtx;
     using CompilerInterface::fclDeviceContexts;
     using CompilerInterface::initialize;
     using CompilerInterface::isCompilerAvailable;
     using CompilerInterface::isFclAvailable;
     using CompilerInterface::isIgcAvailable;
+    using CompilerInterface::serializedTranslationMtx;
+    using CompilerInterface::spinlock;
     using CompilerInterface::verifyIcbeVersion;
 
     using CompilerInterface::fclMain;
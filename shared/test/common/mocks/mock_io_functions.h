@@ -21,6 +21,7 @@ extern FILE *mockFopenReturned;
 extern uint32_t mockVfptrinfCalled;
 extern uint32_t mockFcloseCalled;
 extern uint32_t mockGetenvCalled;
+extern uint32_t mockGetEnvironmentCalled;
 extern uint32_t mockFseekCalled;
 extern uint32_t mockFtellCalled;
 extern long int mockFtellReturn;
@@ -32,6 +33,7 @@ extern size_t mockFwriteReturn;
 extern bool mockVfptrinfUseStdioFunction;
 
 extern std::unordered_map<std::string, std::string> *mockableEnvValues;
+extern char **mockEnvironment;
 
 inline FILE *mockFopen(const char *filename, const char *mode) {
     mockFopenCalled++;
@@ -66,6 +68,11 @@ inline char *mockGetenv(const char *name) noexcept {
     return nullptr;
 }
 
+inline char **mockGetEnvironment() {
+    mockGetEnvironmentCalled++;
+    return mockEnvironment;
+}
+
 inline int mockFseek(FILE *stream, long int offset, int origin) {
     mockFseekCalled++;
     return 0;
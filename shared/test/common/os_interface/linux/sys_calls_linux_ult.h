@@ -48,6 +48,8 @@ extern DIR *(*sysCallsOpendir)(const char *name);
 extern struct dirent *(*sysCallsReaddir)(DIR *dir);
 extern int (*sysCallsClosedir)(DIR *dir);
 extern int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize);
+extern void *(*sysCallsMmap)(void *addr, size_t size, int prot, int flags, int fd, off_t off);
+extern int (*sysCallsMunmap)(void *addr, size_t size);
 extern int (*sysCallsClose)(int fileDescriptor);
 
 extern int flockRetVal;
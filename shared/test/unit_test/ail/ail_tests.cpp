@@ -12,6 +12,8 @@
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <sstream>
+
 namespace NEO {
 using IsSKL = IsProduct<IGFX_SKYLAKE>;
 using IsDG2 = IsProduct<IGFX_DG2>;
@@ -235,4 +237,43 @@ HWTEST2_F(AILTests, GivenAilWhenCheckingContextSyncFlagRequiredThenExpectFalse,
     EXPECT_FALSE(ailTemp.isContextSyncFlagRequired());
 }
 
+HWTEST2_F(AILTests, givenPresetsForCurrentApplicationWhenApplyingPresetsThenDefaultSettingsAreChanged, IsAtLeastGen9) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.SplitBcsSize.set(512);
+
+    AILMock<productFamily> ailTemp;
+    ailTemp.processName = "service";
+
+    std::istringstream presets(R"(
+# tuned defaults
+[other application]
+EnableDirectSubmission = 0
+CsrDispatchMode = 2
+
+[ service ]
+EnableDirectSubmission = 1
+OverrideKmdNotifyDelayMicroseconds=0x100
+SplitBcsSize = 256
+UnknownSetting = 1
+CsrDispatchMode = invalid
+)");
+    ailTemp.applyPresets(presets);
+
+    EXPECT_EQ(1, DebugManager.flags.EnableDirectSubmission.get());
+    EXPECT_EQ(256, DebugManager.flags.OverrideKmdNotifyDelayMicroseconds.get());
+    EXPECT_EQ(512, DebugManager.flags.SplitBcsSize.get());
+    EXPECT_EQ(0, DebugManager.flags.CsrDispatchMode.get());
+}
+
+HWTEST2_F(AILTests, givenNonExistingPresetsFileWhenApplyingPresetsFromFileThenSettingsAreNotChanged, IsAtLeastGen9) {
+    DebugManagerStateRestore restore;
+
+    AILMock<productFamily> ailTemp;
+    ailTemp.processName = "service";
+    ailTemp.applyPresetsFromFile("");
+    ailTemp.applyPresetsFromFile("non_existing_ail_presets.config");
+
+    EXPECT_EQ(-1, DebugManager.flags.EnableDirectSubmission.get());
+}
+
 } // namespace NEO
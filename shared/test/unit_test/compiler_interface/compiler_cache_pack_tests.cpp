@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <string>
+#include <vector>
+
+using namespace NEO;
+using namespace NEO::CompilerCachePack;
+
+struct CompilerCachePackIndexTest : public ::testing::Test {
+    void SetUp() override {
+        createIndex(16u);
+    }
+
+    void createIndex(uint64_t capacity) {
+        indexData.assign(getIndexSize(capacity), 0xcd);
+        index = std::make_unique<PackIndex>(indexData.data(), indexData.size());
+        index->initialize(capacity);
+    }
+
+    std::vector<uint8_t> indexData;
+    std::unique_ptr<PackIndex> index;
+};
+
+TEST_F(CompilerCachePackIndexTest, givenInitializedIndexThenHeaderIsValidAndEmpty) {
+    EXPECT_TRUE(index->isValid());
+    auto &header = index->getHeader();
+    EXPECT_EQ(indexMagic, header.magic);
+    EXPECT_EQ(indexVersion, header.version);
+    EXPECT_EQ(16u, header.capacity);
+    EXPECT_EQ(0u, header.liveEntries);
+    EXPECT_EQ(0u, header.liveBytes);
+    EXPECT_EQ(0u, header.packFileSize);
+    EXPECT_EQ(nullptr, index->find("0123456789abcdef"));
+}
+
+TEST_F(CompilerCachePackIndexTest, givenCorruptedHeaderThenIndexIsInvalid) {
+    index->getHeader().magic = 0u;
+    EXPECT_FALSE(index->isValid());
+
+    createIndex(16u);
+    index->getHeader().capacity = 17u;
+    EXPECT_FALSE(index->isValid());
+
+    createIndex(16u);
+    index->getHeader().capacity = 32u;
+    EXPECT_FALSE(index->isValid());
+
+    PackIndex tooSmallIndex(indexData.data(), sizeof(IndexHeader) - 1);
+    EXPECT_FALSE(tooSmallIndex.isValid());
+}
+
+TEST_F(CompilerCachePackIndexTest, givenInsertedEntriesWhenFindIsCalledThenMatchingEntriesAreReturned) {
+    auto entryA = index->insert("aaaa", 0u, 100u);
+    auto entryB = index->insert("bbbb", 116u, 50u);
+    ASSERT_NE(nullptr, entryA);
+    ASSERT_NE(nullptr, entryB);
+
+    EXPECT_EQ(entryA, index->find("aaaa"));
+    EXPECT_EQ(entryB, index->find("bbbb"));
+    EXPECT_EQ(nullptr, index->find("cccc"));
+
+    EXPECT_EQ(116u, entryB->offset);
+    EXPECT_EQ(50u, entryB->size);
+    EXPECT_EQ(2u, index->getHeader().liveEntries);
+    EXPECT_EQ(150u, index->getHeader().liveBytes);
+}
+
+TEST_F(CompilerCachePackIndexTest, givenTooLongKeyThenInsertAndFindFail) {
+    std::string longKey(maxKeyLength + 1, 'a');
+    EXPECT_EQ(nullptr, index->insert(longKey, 0u, 1u));
+    EXPECT_EQ(nullptr, index->find(longKey));
+
+    std::string maxKey(maxKeyLength, 'a');
+    EXPECT_NE(nullptr, index->insert(maxKey, 0u, 1u));
+    EXPECT_NE(nullptr, index->find(maxKey));
+}
+
+TEST_F(CompilerCachePackIndexTest, givenRemovedEntryThenItIsNotFoundAndSizeIsUpdatedButProbeChainIsKept) {
+    for (int i = 0; i < 8; i++) {
+        ASSERT_NE(nullptr, index->insert("key" + std::to_string(i), i * 100u, 10u));
+    }
+    index->remove(index->find("key3"));
+
+    EXPECT_EQ(nullptr, index->find("key3"));
+    EXPECT_EQ(7u, index->getHeader().liveEntries);
+    EXPECT_EQ(70u, index->getHeader().liveBytes);
+    for (int i = 0; i < 8; i++) {
+        if (i != 3) {
+            EXPECT_NE(nullptr, index->find("key" + std::to_string(i)));
+        }
+    }
+}
+
+TEST_F(CompilerCachePackIndexTest, givenIndexFilledToLoadFactorThenIsFullReturnsTrueAndInsertFails) {
+    int inserted = 0;
+    while (!index->isFull()) {
+        ASSERT_NE(nullptr, index->insert("key" + std::to_string(inserted), 0u, 1u));
+        inserted++;
+    }
+    EXPECT_EQ(12, inserted);
+    EXPECT_EQ(nullptr, index->insert("oneTooMany", 0u, 1u));
+}
+
+TEST_F(CompilerCachePackIndexTest, givenTouchedEntriesWhenSelectingEntriesToEvictThenLeastRecentlyUsedAreSelectedFirst) {
+    auto entryA = index->insert("aaaa", 0u, 10u);
+    auto entryB = index->insert("bbbb", 26u, 10u);
+    auto entryC = index->insert("cccc", 52u, 10u);
+    index->touch(entryA);
+
+    auto toEvict = index->selectEntriesToEvict(15u);
+    ASSERT_EQ(2u, toEvict.size());
+    EXPECT_EQ(entryB, toEvict[0]);
+    EXPECT_EQ(entryC, toEvict[1]);
+
+    toEvict = index->selectEntriesToEvict(1000u);
+    EXPECT_EQ(3u, toEvict.size());
+}
+
+TEST_F(CompilerCachePackIndexTest, givenIndexWhenCopyingLiveEntriesToBiggerIndexThenOnlyLiveEntriesAreCopiedWithLruInfo) {
+    auto entryA = index->insert("aaaa", 0u, 10u);
+    index->insert("bbbb", 26u, 20u);
+    index->insert("cccc", 62u, 30u);
+    index->remove(index->find("bbbb"));
+    index->touch(entryA);
+    index->getHeader().packFileSize = 108u;
+
+    std::vector<uint8_t> biggerIndexData(getIndexSize(64u));
+    PackIndex biggerIndex(biggerIndexData.data(), biggerIndexData.size());
+    biggerIndex.initialize(64u);
+    EXPECT_TRUE(index->copyLiveEntriesTo(biggerIndex));
+
+    EXPECT_EQ(2u, biggerIndex.getHeader().liveEntries);
+    EXPECT_EQ(40u, biggerIndex.getHeader().liveBytes);
+    EXPECT_EQ(108u, biggerIndex.getHeader().packFileSize);
+    EXPECT_EQ(index->getHeader().accessClock, biggerIndex.getHeader().accessClock);
+    EXPECT_EQ(nullptr, biggerIndex.find("bbbb"));
+    ASSERT_NE(nullptr, biggerIndex.find("aaaa"));
+    EXPECT_EQ(entryA->lastAccess, biggerIndex.find("aaaa")->lastAccess);
+    ASSERT_NE(nullptr, biggerIndex.find("cccc"));
+    EXPECT_EQ(62u, biggerIndex.find("cccc")->offset);
+}
+
+TEST_F(CompilerCachePackIndexTest, givenLiveEntriesWhenGettingEntriesSortedByOffsetThenAscendingOrderIsReturned) {
+    index->insert("cccc", 300u, 1u);
+    index->insert("aaaa", 100u, 1u);
+    index->insert("bbbb", 200u, 1u);
+
+    auto entries = index->getLiveEntriesSortedByOffset();
+    ASSERT_EQ(3u, entries.size());
+    EXPECT_EQ(100u, entries[0]->offset);
+    EXPECT_EQ(200u, entries[1]->offset);
+    EXPECT_EQ(300u, entries[2]->offset);
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_memory_tier.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
@@ -224,6 +225,7 @@ TEST(CompilerCacheHashTests, GivenCompilingOptionsWhenGettingCacheThenCorrectCac
     std::string hash = cache.getCachedFileName(hwInfo, src, apiOptions, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
     std::string hash2 = cache.getCachedFileName(hwInfo, src, apiOptions, internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
     EXPECT_STREQ(hash.c_str(), hash2.c_str());
+    EXPECT_EQ(32u, hash.size());
 }
 
 TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetThenTraceFilesAreCreated) {
@@ -393,6 +395,100 @@ TEST(CompilerInterfaceCachedTests, GivenCachedBinaryWhenBuildingThenSuccessIsRet
     gEnvironment->igcPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, GivenCachedBinaryViewAllowedWhenBuildingThenViewIsReturnedWithoutCopy) {
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCachedBinaryView = true;
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->loadResult = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    auto retVal = compilerInterface->build(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, retVal);
+    ASSERT_NE(nullptr, translationOutput.cachedDeviceBinary);
+    EXPECT_EQ(nullptr, translationOutput.deviceBinary.mem);
+    EXPECT_EQ(translationOutput.cachedDeviceBinary->getSize(), translationOutput.deviceBinary.size);
+
+    inputArgs.allowCachedBinaryView = false;
+    TranslationOutput copiedTranslationOutput;
+    retVal = compilerInterface->build(device, inputArgs, copiedTranslationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, retVal);
+    EXPECT_EQ(nullptr, copiedTranslationOutput.cachedDeviceBinary);
+    EXPECT_NE(nullptr, copiedTranslationOutput.deviceBinary.mem);
+}
+
+TEST(CompilerInterfaceCachedTests, GivenPersistentCacheDisabledAndMemoryTierEnabledWhenBuildingTwiceThenSecondBuildIsServedFromMemoryTier) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    cache->config.enabled = false;
+    cache->config.memoryTierSize = MemoryConstants::megaByte;
+    cache->loadResult = true;
+    CompilerCacheMemoryTier::getInstance().reserve(cache->config.memoryTierSize);
+    auto cacheMock = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    TranslationOutput translationOutput;
+    auto retVal = compilerInterface->build(device, inputArgs, translationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, retVal);
+    EXPECT_NE(sizeof(char), translationOutput.deviceBinary.size);
+    EXPECT_EQ(0u, cacheMock->cacheInvoked);
+    EXPECT_EQ(translationOutput.deviceBinary.size, CompilerCacheMemoryTier::getInstance().getStatistics().usedSize);
+    gEnvironment->igcPopDebugVars();
+
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput cachedTranslationOutput;
+    retVal = compilerInterface->build(device, inputArgs, cachedTranslationOutput);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, retVal);
+    EXPECT_EQ(translationOutput.deviceBinary.size, cachedTranslationOutput.deviceBinary.size);
+    EXPECT_EQ(1u, CompilerCacheMemoryTier::getInstance().getStatistics().hits);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+    CompilerCacheMemoryTier::getInstance().clear();
+}
+
+TEST(CompilerCacheTests, GivenPersistentCacheDisabledWhenLoadingCachedBinaryViewThenOnlyMemoryTierIsConsulted) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    CompilerCacheMock cache;
+    cache.config.enabled = false;
+    cache.config.memoryTierSize = MemoryConstants::megaByte;
+    cache.loadResult = true;
+    CompilerCacheMemoryTier::getInstance().reserve(cache.config.memoryTierSize);
+
+    EXPECT_EQ(nullptr, cache.loadCachedBinaryView("memory_tier_hash"));
+
+    const char binary[] = "binary";
+    cache.cacheBinaryInMemoryTier("memory_tier_hash", binary, sizeof(binary));
+    auto view = cache.loadCachedBinaryView("memory_tier_hash");
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(sizeof(binary), view->getSize());
+
+    CompilerCacheMemoryTier::getInstance().clear();
+}
+
 TEST(CompilerInterfaceCachedTests, givenKernelWithoutIncludesAndBinaryInCacheWhenCompilationRequestedThenFCLIsNotCalled) {
     MockDevice device{};
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
@@ -446,3 +542,197 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+namespace {
+std::shared_ptr<const CachedBinary> createCachedBinary(size_t size, char value) {
+    auto storage = std::make_unique<char[]>(size);
+    memset(storage.get(), value, size);
+    return std::make_shared<HeapCachedBinary>(std::move(storage), size);
+}
+} // namespace
+
+TEST(CompilerCacheMemoryTierTests, GivenInsertedBinaryWhenFindIsCalledThenSameReadOnlyViewIsReturnedAndHitIsCounted) {
+    CompilerCacheMemoryTier memoryTier;
+    memoryTier.reserve(100u);
+
+    auto binary = createCachedBinary(10u, 'a');
+    memoryTier.insert("hash1", binary);
+
+    EXPECT_EQ(binary, memoryTier.find("hash1"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash2"));
+
+    auto statistics = memoryTier.getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(10u, statistics.usedSize);
+    EXPECT_EQ(100u, statistics.maxSize);
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenFullMemoryTierWhenInsertingThenLeastRecentlyUsedBinariesAreEvicted) {
+    CompilerCacheMemoryTier memoryTier;
+    memoryTier.reserve(30u);
+
+    memoryTier.insert("hash1", createCachedBinary(10u, 'a'));
+    memoryTier.insert("hash2", createCachedBinary(10u, 'b'));
+    memoryTier.insert("hash3", createCachedBinary(10u, 'c'));
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+
+    memoryTier.insert("hash4", createCachedBinary(10u, 'd'));
+
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash2"));
+    EXPECT_NE(nullptr, memoryTier.find("hash3"));
+    EXPECT_NE(nullptr, memoryTier.find("hash4"));
+
+    auto statistics = memoryTier.getStatistics();
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(30u, statistics.usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenBinaryBiggerThanMemoryTierWhenInsertingThenItIsNotStored) {
+    CompilerCacheMemoryTier memoryTier;
+    memoryTier.reserve(30u);
+    memoryTier.insert("hash1", createCachedBinary(10u, 'a'));
+
+    memoryTier.insert("hash2", createCachedBinary(31u, 'b'));
+
+    EXPECT_EQ(nullptr, memoryTier.find("hash2"));
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+    EXPECT_EQ(10u, memoryTier.getStatistics().usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenMemoryTierWhenReservingSmallerSizeThenLeastRecentlyUsedBinariesAreEvicted) {
+    CompilerCacheMemoryTier memoryTier;
+    memoryTier.reserve(30u);
+    memoryTier.insert("hash1", createCachedBinary(10u, 'a'));
+    memoryTier.insert("hash2", createCachedBinary(10u, 'b'));
+    memoryTier.insert("hash3", createCachedBinary(10u, 'c'));
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+
+    memoryTier.reserve(20u);
+
+    auto statistics = memoryTier.getStatistics();
+    EXPECT_EQ(20u, statistics.maxSize);
+    EXPECT_EQ(20u, statistics.usedSize);
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+    EXPECT_EQ(nullptr, memoryTier.find("hash2"));
+    EXPECT_NE(nullptr, memoryTier.find("hash3"));
+
+    memoryTier.insert("hash4", createCachedBinary(15u, 'd'));
+    EXPECT_EQ(15u, memoryTier.getStatistics().usedSize);
+}
+
+TEST(CompilerCacheMemoryTierTests, GivenMemoryTierWhenClearingThenMaxSizeIsKept) {
+    CompilerCacheMemoryTier memoryTier;
+    memoryTier.reserve(30u);
+    memoryTier.insert("hash1", createCachedBinary(10u, 'a'));
+    EXPECT_NE(nullptr, memoryTier.find("hash1"));
+
+    memoryTier.clear();
+
+    auto statistics = memoryTier.getStatistics();
+    EXPECT_EQ(30u, statistics.maxSize);
+    EXPECT_EQ(0u, statistics.usedSize);
+    EXPECT_EQ(0u, statistics.hits);
+    EXPECT_EQ(nullptr, memoryTier.find("hash1"));
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierEnabledWhenLoadingCachedBinaryViewTwiceThenPersistentCacheIsReadOnceAndViewIsShared) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    CompilerCacheMock cache;
+    cache.config.memoryTierSize = MemoryConstants::megaByte;
+    cache.numberOfLoadResult = 1u;
+    CompilerCacheMemoryTier::getInstance().reserve(cache.config.memoryTierSize);
+
+    auto firstView = cache.loadCachedBinaryView("memory_tier_hash");
+    ASSERT_NE(nullptr, firstView);
+    EXPECT_EQ(1u, firstView->getSize());
+
+    auto secondView = cache.loadCachedBinaryView("memory_tier_hash");
+    EXPECT_EQ(firstView, secondView);
+    EXPECT_EQ(0u, cache.numberOfLoadResult);
+    EXPECT_EQ(1u, CompilerCacheMemoryTier::getInstance().getStatistics().hits);
+
+    CompilerCacheMemoryTier::getInstance().clear();
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierDisabledWhenLoadingCachedBinaryViewThenPersistentCacheIsReadEachTime) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    CompilerCacheMock cache;
+    cache.numberOfLoadResult = 1u;
+
+    EXPECT_NE(nullptr, cache.loadCachedBinaryView("memory_tier_hash"));
+    EXPECT_EQ(nullptr, cache.loadCachedBinaryView("memory_tier_hash"));
+
+    cache.cacheBinaryInMemoryTier("memory_tier_hash", "1", 1u);
+    EXPECT_EQ(0u, CompilerCacheMemoryTier::getInstance().getStatistics().usedSize);
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierEnabledWhenBinaryIsStoredThenItIsReturnedWithoutLoadingFromPersistentCache) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    CompilerCacheMock cache;
+    cache.config.memoryTierSize = MemoryConstants::megaByte;
+    CompilerCacheMemoryTier::getInstance().reserve(cache.config.memoryTierSize);
+
+    const char binary[] = "binary";
+    cache.cacheBinaryInMemoryTier("stored_hash", binary, sizeof(binary));
+
+    auto view = cache.loadCachedBinaryView("stored_hash");
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(sizeof(binary), view->getSize());
+    EXPECT_EQ(0, memcmp(binary, view->getData().begin(), sizeof(binary)));
+
+    CompilerCacheMemoryTier::getInstance().clear();
+}
+
+TEST(CompilerCacheTests, GivenMapCachedBinariesEnabledWhenLoadingCachedBinaryViewThenMappedBinaryIsReturnedAndNotStoredInMemoryTier) {
+    CompilerCacheMemoryTier::getInstance().clear();
+
+    CompilerCacheMock cache;
+    cache.config.memoryTierSize = MemoryConstants::megaByte;
+    cache.config.mapCachedBinaries = true;
+    cache.numberOfLoadResult = 1u;
+    cache.mapResult = createCachedBinary(10u, 'm');
+    CompilerCacheMemoryTier::getInstance().reserve(cache.config.memoryTierSize);
+
+    auto view = cache.loadCachedBinaryView("mapped_hash");
+    EXPECT_EQ(cache.mapResult, view);
+    EXPECT_EQ(1u, cache.mapInvoked);
+    EXPECT_EQ(1u, cache.numberOfLoadResult);
+    EXPECT_EQ(0u, CompilerCacheMemoryTier::getInstance().getStatistics().usedSize);
+
+    cache.mapResult.reset();
+    view = cache.loadCachedBinaryView("mapped_hash");
+    ASSERT_NE(nullptr, view);
+    EXPECT_EQ(1u, view->getSize());
+    EXPECT_EQ(2u, cache.mapInvoked);
+    EXPECT_EQ(0u, cache.numberOfLoadResult);
+
+    CompilerCacheMemoryTier::getInstance().clear();
+}
+
+TEST(CompilerCacheTests, GivenMapCachedBinariesDisabledWhenLoadingCachedBinaryViewThenBinaryIsNotMapped) {
+    CompilerCacheMock cache;
+    cache.numberOfLoadResult = 1u;
+    cache.mapResult = createCachedBinary(10u, 'm');
+
+    auto view = cache.loadCachedBinaryView("mapped_hash");
+    ASSERT_NE(nullptr, view);
+    EXPECT_NE(cache.mapResult, view);
+    EXPECT_EQ(0u, cache.mapInvoked);
+}
+
+TEST(CompilerCacheTests, GivenMemoryTierDebugFlagWhenGettingDefaultMemoryTierSizeThenFlagValueIsUsed) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(32 * MemoryConstants::megaByte, getDefaultCompilerCacheMemoryTierSize());
+
+    DebugManager.flags.BinaryCacheMemoryTierSizeInMB.set(0);
+    EXPECT_EQ(0u, getDefaultCompilerCacheMemoryTierSize());
+
+    DebugManager.flags.BinaryCacheMemoryTierSizeInMB.set(5);
+    EXPECT_EQ(5 * MemoryConstants::megaByte, getDefaultCompilerCacheMemoryTierSize());
+}
@@ -762,6 +762,88 @@ TEST_F(CompilerInterfaceTest, givenUpdatedSpecConstValuesWhenBuildProgramThenPro
     EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
 }
 
+TEST(CompilerInterface, givenCompilerConcurrencyModeDebugFlagWhenCreatingCompilerInterfaceThenConcurrencyModeIsSetAccordingly) {
+    DebugManagerStateRestore restorer;
+    {
+        MockCompilerInterface ci;
+        EXPECT_EQ(CompilerConcurrencyMode::concurrent, ci.getConcurrencyMode());
+    }
+    DebugManager.flags.CompilerConcurrencyMode.set(0);
+    {
+        MockCompilerInterface ci;
+        EXPECT_EQ(CompilerConcurrencyMode::serialized, ci.getConcurrencyMode());
+    }
+    DebugManager.flags.CompilerConcurrencyMode.set(1);
+    {
+        MockCompilerInterface ci;
+        EXPECT_EQ(CompilerConcurrencyMode::concurrent, ci.getConcurrencyMode());
+    }
+}
+
+struct MockTranslationContextCheckingSerializedLock : public MockIgcOclTranslationCtx {
+    IGC::OclTranslationOutputBase *TranslateImpl(
+        CIF::Version_t outVersion,
+        CIF::Builtins::BufferSimple *src,
+        CIF::Builtins::BufferSimple *specConstantsIds,
+        CIF::Builtins::BufferSimple *specConstantsValues,
+        CIF::Builtins::BufferSimple *options,
+        CIF::Builtins::BufferSimple *internalOptions,
+        CIF::Builtins::BufferSimple *tracingOptions,
+        uint32_t tracingOptionsCount,
+        void *gtPinInput) override {
+        serializedLockHeld = !MockCompilerInterface::serializedTranslationMtx.try_lock();
+        if (!serializedLockHeld) {
+            MockCompilerInterface::serializedTranslationMtx.unlock();
+        }
+        translateCalled = true;
+        return new MockOclTranslationOutput();
+    }
+
+    static bool serializedLockHeld;
+    static bool translateCalled;
+};
+bool MockTranslationContextCheckingSerializedLock::serializedLockHeld = false;
+bool MockTranslationContextCheckingSerializedLock::translateCalled = false;
+
+TEST_F(CompilerInterfaceTest, givenSerializedConcurrencyModeWhenBuildingThenTranslationIsDoneUnderProcessWideLock) {
+    auto deviceCtx = CIF::RAII::UPtr(new MockCompilerDeviceCtx<MockIgcOclDeviceCtx, MockTranslationContextCheckingSerializedLock>());
+    pCompilerInterface->setDeviceCtx(*pDevice, deviceCtx.get());
+    pCompilerInterface->concurrencyMode = CompilerConcurrencyMode::serialized;
+
+    MockTranslationContextCheckingSerializedLock::translateCalled = false;
+    MockTranslationContextCheckingSerializedLock::serializedLockHeld = false;
+    TranslationOutput translationOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(MockTranslationContextCheckingSerializedLock::translateCalled);
+    EXPECT_TRUE(MockTranslationContextCheckingSerializedLock::serializedLockHeld);
+}
+
+TEST_F(CompilerInterfaceTest, givenConcurrentConcurrencyModeWhenBuildingThenTranslationIsNotDoneUnderProcessWideLock) {
+    auto deviceCtx = CIF::RAII::UPtr(new MockCompilerDeviceCtx<MockIgcOclDeviceCtx, MockTranslationContextCheckingSerializedLock>());
+    pCompilerInterface->setDeviceCtx(*pDevice, deviceCtx.get());
+    pCompilerInterface->concurrencyMode = CompilerConcurrencyMode::concurrent;
+
+    MockTranslationContextCheckingSerializedLock::translateCalled = false;
+    MockTranslationContextCheckingSerializedLock::serializedLockHeld = true;
+    TranslationOutput translationOutput;
+    auto err = pCompilerInterface->build(*pDevice, inputArgs, translationOutput);
+
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(MockTranslationContextCheckingSerializedLock::translateCalled);
+    EXPECT_FALSE(MockTranslationContextCheckingSerializedLock::serializedLockHeld);
+}
+
+TEST(CompilerInterface, givenTwoCompilerInterfacesWhenOneIsLockedThenOtherCanStillBeLocked) {
+    MockCompilerInterface ci0;
+    MockCompilerInterface ci1;
+
+    auto lock0 = ci0.lock();
+    std::unique_lock<SpinLock> lock1(ci1.spinlock, std::try_to_lock);
+    EXPECT_TRUE(lock1.owns_lock());
+}
+
 TEST_F(CompilerInterfaceTest, GivenRequestForNewFclTranslationCtxWhenDeviceCtxIsNotAvailableThenCreateNewDeviceCtxAndUseItToReturnValidTranslationCtx) {
     auto device = this->pDevice;
     auto ret = this->pCompilerInterface->createFclTranslationCtx(*device, IGC::CodeType::oclC, IGC::CodeType::spirV);
@@ -851,6 +933,21 @@ TEST_F(CompilerInterfaceTest, GivenRequestForNewIgcTranslationCtxWhenDeviceCtxIs
     EXPECT_EQ(deviceCtx->returned, ret.get());
 }
 
+TEST_F(CompilerInterfaceTest, GivenIgcDeviceCtxIsAlreadyAvailableWhenCreatingIgcTranslationCtxThenLockIsTakenOnlyForDeviceCtxLookup) {
+    auto device = this->pDevice;
+    auto deviceCtx = CIF::RAII::UPtr(new MockCompilerDeviceCtx<MockIgcOclDeviceCtx, MockIgcOclTranslationCtx>);
+    this->pCompilerInterface->setIgcDeviceCtx(*device, deviceCtx.get());
+
+    using ListenerT = LockListener<IGC::IgcOclDeviceCtxTagOCL, MockIgcOclDeviceCtx>;
+    ListenerT listenerData{device};
+    this->pCompilerInterface->lockListenerData = &listenerData;
+    this->pCompilerInterface->lockListener = ListenerT::listener;
+
+    auto ret = this->pCompilerInterface->createIgcTranslationCtx(*device, IGC::CodeType::spirV, IGC::CodeType::oclGenBin);
+    EXPECT_NE(nullptr, ret.get());
+    EXPECT_EQ(1, listenerData.lockCount);
+}
+
 TEST_F(CompilerInterfaceTest, GivenSimultaneousRequestForNewIgcTranslationContextsWhenDeviceCtxIsNotAlreadyAvailableThenSynchronizeToCreateOnlyOneNewDeviceCtx) {
     auto device = this->pDevice;
 
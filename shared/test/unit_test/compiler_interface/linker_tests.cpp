@@ -13,6 +13,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/thread_pool.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -2393,3 +2394,88 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     auto perThreadPayloadOffsetPatchedValue = reinterpret_cast<uint32_t *>(ptrOffset(segmentToPatch.hostPointer, static_cast<size_t>(rel.offset)));
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
 }
+
+TEST(LinkerInputTests, GivenRelocationsUsingSameSymbolWhenAddingThemThenTheyShareInternedSymbolId) {
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    NEO::LinkerInput::RelocationInfo relocation;
+    relocation.symbolName = "symA";
+    linkerInput.addElfTextSegmentRelocation(relocation, 0u);
+    relocation.symbolName = "symB";
+    linkerInput.addElfTextSegmentRelocation(relocation, 1u);
+    relocation.symbolName = "symA";
+    relocation.relocationSegment = NEO::SegmentType::GlobalVariables;
+    linkerInput.addDataRelocationInfo(relocation);
+    relocation.symbolName = "";
+    linkerInput.addElfTextSegmentRelocation(relocation, 1u);
+
+    EXPECT_EQ(2u, linkerInput.getRelocationSymbolIds().size());
+    auto symAId = linkerInput.getRelocationSymbolIds().at("symA");
+    EXPECT_EQ(symAId, linkerInput.textRelocations[0][0].symbolId);
+    EXPECT_EQ(symAId, linkerInput.dataRelocations[0].symbolId);
+    EXPECT_EQ(linkerInput.getRelocationSymbolIds().at("symB"), linkerInput.textRelocations[1][0].symbolId);
+    EXPECT_NE(symAId, linkerInput.textRelocations[1][0].symbolId);
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), linkerInput.textRelocations[1][1].symbolId);
+}
+
+TEST_F(LinkerTests, GivenRelocationsInMultipleInstructionSegmentsWhenPatchingInParallelThenResultsAreSameAsWhenPatchingSerially) {
+    constexpr uint32_t numSegments = 8u;
+    constexpr uint32_t relocationsPerSegment = 64u;
+    WhiteBox<NEO::LinkerInput> linkerInput;
+    SymbolInfo symbol;
+    symbol.segment = SegmentType::GlobalVariables;
+    symbol.offset = 0x10;
+    symbol.size = 8u;
+    symbol.global = true;
+    linkerInput.addSymbol("var", symbol);
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        for (uint32_t i = 0; i < relocationsPerSegment; i++) {
+            NEO::LinkerInput::RelocationInfo relocation;
+            relocation.symbolName = (i % 16 == 15) ? "unresolved" + std::to_string(segId) : "var";
+            relocation.offset = i * sizeof(uint64_t);
+            relocation.addend = segId;
+            relocation.type = NEO::LinkerInput::RelocationInfo::Type::Address;
+            linkerInput.addElfTextSegmentRelocation(relocation, segId);
+        }
+    }
+
+    NEO::Linker::SegmentInfo globalVariables;
+    globalVariables.gpuAddress = 0x10000;
+    globalVariables.segmentSize = 0x100;
+
+    auto patch = [&](ThreadPool *threadPool, std::vector<std::vector<uint64_t>> &segmentsData, NEO::Linker::UnresolvedExternals &unresolvedExternals) {
+        WhiteBox<NEO::Linker> linker(linkerInput);
+        NEO::Linker::PatchableSegments instructionSegments(numSegments);
+        segmentsData.assign(numSegments, std::vector<uint64_t>(relocationsPerSegment, 0u));
+        for (uint32_t segId = 0; segId < numSegments; segId++) {
+            instructionSegments[segId].hostPointer = segmentsData[segId].data();
+            instructionSegments[segId].segmentSize = segmentsData[segId].size() * sizeof(uint64_t);
+        }
+        EXPECT_TRUE(linker.relocateSymbols(globalVariables, {}, {}, {}, instructionSegments, 0u, 0u));
+        EXPECT_EQ(linkerInput.getRelocationSymbolIds().size(), linker.relocatedSymbolsById.size());
+        linker.threadPool = threadPool;
+        NEO::Linker::KernelDescriptorsT kernelDescriptors;
+        linker.patchInstructionsSegments(instructionSegments, unresolvedExternals, kernelDescriptors);
+    };
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelLinkerPatching.set(0);
+    std::vector<std::vector<uint64_t>> serialData;
+    NEO::Linker::UnresolvedExternals serialUnresolvedExternals;
+    patch(nullptr, serialData, serialUnresolvedExternals);
+
+    DebugManager.flags.ParallelLinkerPatching.set(1);
+    ThreadPool threadPool(4u);
+    std::vector<std::vector<uint64_t>> parallelData;
+    NEO::Linker::UnresolvedExternals parallelUnresolvedExternals;
+    patch(&threadPool, parallelData, parallelUnresolvedExternals);
+
+    EXPECT_EQ(serialData, parallelData);
+    EXPECT_EQ(globalVariables.gpuAddress + symbol.offset + 3u, parallelData[3][0]);
+    EXPECT_EQ(0u, parallelData[3][15]);
+    ASSERT_EQ(numSegments * relocationsPerSegment / 16, parallelUnresolvedExternals.size());
+    for (size_t i = 0; i < parallelUnresolvedExternals.size(); i++) {
+        EXPECT_EQ(serialUnresolvedExternals[i].instructionsSegmentId, parallelUnresolvedExternals[i].instructionsSegmentId);
+        EXPECT_EQ(serialUnresolvedExternals[i].unresolvedRelocation.offset, parallelUnresolvedExternals[i].unresolvedRelocation.offset);
+        EXPECT_EQ("unresolved" + std::to_string(parallelUnresolvedExternals[i].instructionsSegmentId), parallelUnresolvedExternals[i].unresolvedRelocation.symbolName);
+    }
+}
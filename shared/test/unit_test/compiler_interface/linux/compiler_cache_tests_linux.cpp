@@ -6,8 +6,10 @@
  */
 
 #include "shared/source/compiler_interface/compiler_cache.h"
+#include "shared/source/compiler_interface/compiler_cache_pack.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/compiler_interface/linux/compiler_cache_mapped_binary.h"
 #include "shared/source/compiler_interface/os_compiler_cache_helper.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hash.h"
@@ -27,8 +29,11 @@
 #include "os_inc.h"
 
 #include <array>
+#include <fcntl.h>
 #include <list>
+#include <map>
 #include <memory>
+#include <sys/mman.h>
 
 using namespace NEO;
 
@@ -37,7 +42,9 @@ class CompilerCacheMockLinux : public CompilerCache {
     CompilerCacheMockLinux(const CompilerCacheConfig &config) : CompilerCache(config) {}
     using CompilerCache::createUniqueTempFileAndWriteData;
     using CompilerCache::evictCache;
+    using CompilerCache::getPackFileBaseName;
     using CompilerCache::lockConfigFileAndReadSize;
+    using CompilerCache::mapCachedBinary;
     using CompilerCache::renameTempFileBinaryToProperName;
 };
 
@@ -604,6 +611,267 @@ bool pathExistsMock(const std::string &path) {
 }
 } // namespace NonExistingPathIsSet
 
+TEST(CompilerCacheTests, GivenIndexedPackFormatWhenPackLockFailsThenCacheBinaryReturnsFalseAndLoadFallsBackToFilePerBinary) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openWithModeBackup(&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+    VariableBackup<decltype(NEO::SysCalls::flockRetVal)> flockBackup(&NEO::SysCalls::flockRetVal, -1);
+    VariableBackup<decltype(NEO::SysCalls::flockCalled)> flockCalledBackup(&NEO::SysCalls::flockCalled, 0);
+
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte};
+    config.format = CompilerCacheFormat::indexedPack;
+    CompilerCacheMockLinux cache(config);
+
+    EXPECT_FALSE(cache.cacheBinary("0123456789abcdef", "1", 1));
+    EXPECT_EQ(1, NEO::SysCalls::flockCalled);
+
+    size_t binarySize = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("0123456789abcdef", binarySize));
+    EXPECT_EQ(2, NEO::SysCalls::flockCalled);
+}
+
+TEST(CompilerCacheTests, GivenIndexedPackFormatWhenKeyIsTooLongOrBinaryExceedsCacheSizeThenCacheBinaryReturnsFalseWithoutLocking) {
+    VariableBackup<decltype(NEO::SysCalls::flockCalled)> flockCalledBackup(&NEO::SysCalls::flockCalled, 0);
+
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", 4u};
+    config.format = CompilerCacheFormat::indexedPack;
+    CompilerCacheMockLinux cache(config);
+
+    std::string longKey(CompilerCachePack::maxKeyLength + 1, 'a');
+    EXPECT_FALSE(cache.cacheBinary(longKey, "1", 1));
+    EXPECT_FALSE(cache.cacheBinary("0123456789abcdef", "12345", 5));
+    EXPECT_EQ(0, NEO::SysCalls::flockCalled);
+}
+
+namespace FakePackFileSystem {
+using File = std::shared_ptr<std::vector<char>>;
+std::map<std::string, File> files;
+std::map<int, File> openFiles;
+int nextFd = 1000;
+int tmpFileCounter = 0;
+
+int openFile(const std::string &path, int flags) {
+    auto it = files.find(path);
+    if (it == files.end()) {
+        if ((flags & O_CREAT) == 0) {
+            return -1;
+        }
+        it = files.emplace(path, std::make_shared<std::vector<char>>()).first;
+    }
+    openFiles[nextFd] = it->second;
+    return nextFd++;
+}
+
+File getFile(int fd) {
+    auto it = openFiles.find(fd);
+    return it != openFiles.end() ? it->second : nullptr;
+}
+
+struct Backups {
+    Backups() {
+        files.clear();
+        openFiles.clear();
+    }
+
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup{&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+                                                                         return openFile(pathname, flags);
+                                                                     }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpenWithMode)> openWithModeBackup{&NEO::SysCalls::sysCallsOpenWithMode, [](const char *pathname, int flags, int mode) -> int {
+                                                                                         return openFile(pathname, flags);
+                                                                                     }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsMkstemp)> mkstempBackup{&NEO::SysCalls::sysCallsMkstemp, [](char *fileName) -> int {
+                                                                               std::string path(fileName);
+                                                                               auto suffix = std::to_string(tmpFileCounter++);
+                                                                               suffix.insert(0, 6 - suffix.size(), '0');
+                                                                               path.replace(path.size() - 6, 6, suffix);
+                                                                               memcpy_s(fileName, path.size(), path.c_str(), path.size());
+                                                                               return openFile(path, O_CREAT);
+                                                                           }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsRename)> renameBackup{&NEO::SysCalls::sysCallsRename, [](const char *currName, const char *dstName) -> int {
+                                                                             auto it = files.find(currName);
+                                                                             if (it == files.end()) {
+                                                                                 return -1;
+                                                                             }
+                                                                             auto file = it->second;
+                                                                             files.erase(it);
+                                                                             files[dstName] = file;
+                                                                             return 0;
+                                                                         }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsUnlink)> unlinkBackup{&NEO::SysCalls::sysCallsUnlink, [](const std::string &pathname) -> int {
+                                                                             return files.erase(pathname) == 1u ? 0 : -1;
+                                                                         }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup{&NEO::SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+                                                                           auto file = getFile(fd);
+                                                                           if (file == nullptr) {
+                                                                               return -1;
+                                                                           }
+                                                                           buf->st_size = static_cast<off_t>(file->size());
+                                                                           return 0;
+                                                                       }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPread)> preadBackup{&NEO::SysCalls::sysCallsPread, [](int fd, void *buf, size_t count, off_t offset) -> ssize_t {
+                                                                           auto file = getFile(fd);
+                                                                           if (file == nullptr || static_cast<size_t>(offset) > file->size()) {
+                                                                               return -1;
+                                                                           }
+                                                                           count = std::min(count, file->size() - static_cast<size_t>(offset));
+                                                                           memcpy_s(buf, count, file->data() + offset, count);
+                                                                           return static_cast<ssize_t>(count);
+                                                                       }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsPwrite)> pwriteBackup{&NEO::SysCalls::sysCallsPwrite, [](int fd, const void *buf, size_t count, off_t offset) -> ssize_t {
+                                                                             auto file = getFile(fd);
+                                                                             if (file == nullptr) {
+                                                                                 return -1;
+                                                                             }
+                                                                             file->resize(std::max(file->size(), static_cast<size_t>(offset) + count));
+                                                                             memcpy_s(file->data() + offset, count, buf, count);
+                                                                             return static_cast<ssize_t>(count);
+                                                                         }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsMmap)> mmapBackup{&NEO::SysCalls::sysCallsMmap, [](void *addr, size_t size, int prot, int flags, int fd, off_t off) -> void * {
+                                                                         auto file = getFile(fd);
+                                                                         if (file == nullptr || static_cast<size_t>(off) + size > file->size()) {
+                                                                             return MAP_FAILED;
+                                                                         }
+                                                                         return file->data() + off;
+                                                                     }};
+    VariableBackup<decltype(NEO::SysCalls::sysCallsMunmap)> munmapBackup{&NEO::SysCalls::sysCallsMunmap, [](void *addr, size_t size) -> int {
+                                                                             return 0;
+                                                                         }};
+};
+} // namespace FakePackFileSystem
+
+TEST(CompilerCacheTests, GivenIndexedPackFormatWhenBinariesAreCachedThenTheyAreLoadedBackFromPack) {
+    FakePackFileSystem::Backups fileSystem;
+
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte};
+    config.format = CompilerCacheFormat::indexedPack;
+    CompilerCacheMockLinux cache(config);
+
+    const std::string binary0 = "binary0";
+    const std::string binary1 = "second binary";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary0.c_str(), binary0.size()));
+    EXPECT_TRUE(cache.cacheBinary("fedcba9876543210", binary1.c_str(), binary1.size()));
+
+    auto &packFile = FakePackFileSystem::files["/home/cl_cache/cl_cache.pack"];
+    ASSERT_NE(nullptr, packFile);
+    EXPECT_EQ(2 * sizeof(CompilerCachePack::PackRecordHeader) + binary0.size() + binary1.size(), packFile->size());
+
+    size_t binarySize = 0u;
+    auto loadedBinary = cache.loadCachedBinary("0123456789abcdef", binarySize);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(binary0, std::string(loadedBinary.get(), binarySize));
+
+    loadedBinary = cache.loadCachedBinary("fedcba9876543210", binarySize);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(binary1, std::string(loadedBinary.get(), binarySize));
+}
+
+TEST(CompilerCacheTests, GivenIndexedPackFormatWhenIndexIsMissingThenPackIsResetBeforeNewRecordIsAppended) {
+    FakePackFileSystem::Backups fileSystem;
+
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte};
+    config.format = CompilerCacheFormat::indexedPack;
+    CompilerCacheMockLinux cache(config);
+
+    const std::string binary0 = "binary0";
+    const std::string binary1 = "second binary";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary0.c_str(), binary0.size()));
+    auto oldPackFile = FakePackFileSystem::files["/home/cl_cache/cl_cache.pack"];
+
+    FakePackFileSystem::files.erase("/home/cl_cache/cl_cache.idx");
+    EXPECT_TRUE(cache.cacheBinary("fedcba9876543210", binary1.c_str(), binary1.size()));
+
+    auto packFile = FakePackFileSystem::files["/home/cl_cache/cl_cache.pack"];
+    EXPECT_NE(oldPackFile, packFile);
+    EXPECT_EQ(sizeof(CompilerCachePack::PackRecordHeader) + binary0.size(), oldPackFile->size());
+    EXPECT_EQ(sizeof(CompilerCachePack::PackRecordHeader) + binary1.size(), packFile->size());
+
+    size_t binarySize = 0u;
+    auto loadedBinary = cache.loadCachedBinary("fedcba9876543210", binarySize);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(binary1, std::string(loadedBinary.get(), binarySize));
+}
+
+TEST(CompilerCacheTests, GivenIndexedPackFormatWhenMappingCachedBinaryThenOnlySealedRecordsAreMappedAndOthersAreCopied) {
+    FakePackFileSystem::Backups fileSystem;
+
+    CompilerCacheConfig config = {true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte};
+    config.format = CompilerCacheFormat::indexedPack;
+    CompilerCacheMockLinux cache(config);
+
+    const std::string binary0 = "binary0";
+    EXPECT_TRUE(cache.cacheBinary("0123456789abcdef", binary0.c_str(), binary0.size()));
+    auto packFile = FakePackFileSystem::files["/home/cl_cache/cl_cache.pack"];
+    auto packBegin = reinterpret_cast<const char *>(packFile->data());
+    auto packEnd = packBegin + packFile->size();
+
+    auto mappedBinary = cache.mapCachedBinary("0123456789abcdef");
+    ASSERT_NE(nullptr, mappedBinary);
+    EXPECT_EQ(binary0, std::string(mappedBinary->getData().begin(), mappedBinary->getSize()));
+    EXPECT_TRUE(mappedBinary->getData().begin() >= packBegin && mappedBinary->getData().end() <= packEnd);
+
+    auto indexFile = FakePackFileSystem::files["/home/cl_cache/cl_cache.idx"];
+    CompilerCachePack::PackIndex index(reinterpret_cast<uint8_t *>(indexFile->data()), indexFile->size());
+    index.getHeader().packFileSize = 0u;
+
+    auto copiedBinary = cache.mapCachedBinary("0123456789abcdef");
+    ASSERT_NE(nullptr, copiedBinary);
+    EXPECT_EQ(binary0, std::string(copiedBinary->getData().begin(), copiedBinary->getSize()));
+    EXPECT_FALSE(copiedBinary->getData().begin() >= packBegin && copiedBinary->getData().begin() < packEnd);
+}
+
+TEST(CompilerCacheTests, GivenCacheFileExtensionWhenGettingPackFileBaseNameThenLeadingDotIsStripped) {
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ("cl_cache", cache.getPackFileBaseName());
+
+    CompilerCacheMockLinux cacheWithoutExtension({true, "", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ("compiler_cache", cacheWithoutExtension.getPackFileBaseName());
+}
+
+TEST(CompilerCacheTests, GivenUnalignedOffsetWhenCreatingMappedCachedBinaryThenPageAlignedRangeIsMappedAndUnmappedOnDestruction) {
+    VariableBackup<decltype(NEO::SysCalls::mmapFuncCalled)> mmapCalledBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+    VariableBackup<decltype(NEO::SysCalls::munmapFuncCalled)> munmapCalledBackup(&NEO::SysCalls::munmapFuncCalled, 0u);
+
+    const uint64_t offset = MemoryConstants::pageSize + 16u;
+    auto binary = MappedCachedBinary::create(NEO::SysCalls::fakeFileDescriptor, offset, 100u);
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(1u, NEO::SysCalls::mmapFuncCalled);
+    EXPECT_EQ(100u, binary->getSize());
+    EXPECT_EQ(16u, reinterpret_cast<uintptr_t>(binary->getData().begin()) % MemoryConstants::pageSize);
+
+    binary.reset();
+    EXPECT_EQ(1u, NEO::SysCalls::munmapFuncCalled);
+
+    EXPECT_EQ(nullptr, MappedCachedBinary::create(-1, 0u, 100u));
+    EXPECT_EQ(nullptr, MappedCachedBinary::create(NEO::SysCalls::fakeFileDescriptor, 0u, 0u));
+    EXPECT_EQ(1u, NEO::SysCalls::mmapFuncCalled);
+}
+
+TEST(CompilerCacheTests, GivenCachedFileWhenMappingCachedBinaryThenWholeFileIsMapped) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return NEO::SysCalls::fakeFileDescriptor;
+    });
+    VariableBackup<decltype(NEO::SysCalls::sysCallsFstat)> fstatBackup(&NEO::SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int {
+        buf->st_size = 100;
+        return 0;
+    });
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    auto binary = cache.mapCachedBinary("0123456789abcdef");
+    ASSERT_NE(nullptr, binary);
+    EXPECT_EQ(100u, binary->getSize());
+}
+
+TEST(CompilerCacheTests, GivenMissingCachedFileWhenMappingCachedBinaryThenNullptrIsReturned) {
+    VariableBackup<decltype(NEO::SysCalls::sysCallsOpen)> openBackup(&NEO::SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return -1;
+    });
+    VariableBackup<decltype(NEO::SysCalls::mmapFuncCalled)> mmapCalledBackup(&NEO::SysCalls::mmapFuncCalled, 0u);
+
+    CompilerCacheMockLinux cache({true, ".cl_cache", "/home/cl_cache/", MemoryConstants::megaByte});
+    EXPECT_EQ(nullptr, cache.mapCachedBinary("0123456789abcdef"));
+    EXPECT_EQ(0u, NEO::SysCalls::mmapFuncCalled);
+}
+
 TEST(CompilerCacheHelper, GivenNonExistingPathWhenCheckDefaultCacheDirSettingsThenFalseIsReturned) {
     NEO::EnvironmentVariableReader envReader;
 
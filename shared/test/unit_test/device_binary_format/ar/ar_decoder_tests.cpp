@@ -424,3 +424,18 @@ TEST(ArDecoderDecodeAr, GivenFilesWithLongFilenamesWhenLongNameIsOutOfBoundsThen
     EXPECT_FALSE(decodeErrors.empty());
     EXPECT_STREQ("Corrupt AR archive - long file name entry has broken identifier : '/100            '", decodeErrors.c_str());
 }
+
+TEST(ArIndexFindFirstWithPrefix, GivenMultipleMatchingFilesThenReturnsFirstOneInArchiveOrder) {
+    Ar ar;
+    ar.files.push_back({"pvc.12", {}});
+    ar.files.push_back({"dg2", {}});
+    ar.files.push_back({"pvc", {}});
+    ar.files.push_back({"pvc.12.60", {}});
+
+    ArIndex index(ar);
+    EXPECT_EQ(&ar.files[0], index.findFirstWithPrefix("pvc"));
+    EXPECT_EQ(&ar.files[0], index.findFirstWithPrefix("pvc.12"));
+    EXPECT_EQ(&ar.files[3], index.findFirstWithPrefix("pvc.12.60"));
+    EXPECT_EQ(&ar.files[1], index.findFirstWithPrefix("dg"));
+    EXPECT_EQ(nullptr, index.findFirstWithPrefix("tgllp"));
+}
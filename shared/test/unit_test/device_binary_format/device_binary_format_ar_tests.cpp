@@ -613,3 +613,33 @@ TEST(UnpackSingleDeviceBinaryAr, WhenCouldNotFindBinaryWithRightPointerSizeThenU
     EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
     EXPECT_STREQ("Couldn't find matching binary in AR archive", unpackErrors.c_str());
 }
+
+TEST(UnpackSingleDeviceBinaryAr, WhenMultipleFilesMatchSameFilterThenFirstOneIsUsedAndPackedTargetBinaryPointsIntoArchive) {
+    PatchTokensTestData::ValidEmptyProgram programTokens;
+    PatchTokensTestData::ValidProgramWithConstantSurface otherProgramTokens;
+    NEO::Ar::ArEncoder encoder;
+
+    std::string requiredProduct = NEO::hardwarePrefix[productFamily];
+    std::string requiredStepping = std::to_string(programTokens.header->SteppingId);
+    std::string requiredPointerSize = (programTokens.header->GPUPointerSizeInBytes == 4) ? "32" : "64";
+
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, programTokens.storage));
+    ASSERT_TRUE(encoder.appendFileEntry(requiredPointerSize + "." + requiredProduct + "." + requiredStepping, otherProgramTokens.storage));
+
+    NEO::TargetDevice target;
+    target.coreFamily = static_cast<GFXCORE_FAMILY>(programTokens.header->Device);
+    target.stepping = programTokens.header->SteppingId;
+    target.maxPointerSizeInBytes = programTokens.header->GPUPointerSizeInBytes;
+
+    auto arData = encoder.encode();
+    std::string unpackErrors;
+    std::string unpackWarnings;
+    auto unpacked = NEO::unpackSingleDeviceBinary<NEO::DeviceBinaryFormat::Archive>(arData, requiredProduct, target, unpackErrors, unpackWarnings);
+    EXPECT_TRUE(unpackErrors.empty()) << unpackErrors;
+    EXPECT_TRUE(unpackWarnings.empty()) << unpackWarnings;
+
+    ASSERT_EQ(programTokens.storage.size(), unpacked.packedTargetDeviceBinary.size());
+    EXPECT_EQ(0, memcmp(programTokens.storage.data(), unpacked.packedTargetDeviceBinary.begin(), programTokens.storage.size()));
+    EXPECT_LE(arData.data(), unpacked.packedTargetDeviceBinary.begin());
+    EXPECT_GE(arData.data() + arData.size(), unpacked.packedTargetDeviceBinary.end());
+}
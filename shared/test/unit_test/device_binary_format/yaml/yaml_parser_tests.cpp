@@ -6,6 +6,8 @@
  */
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/device_binary_format/yaml/yaml_scanner.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include <limits>
@@ -3020,3 +3022,123 @@ TEST(ReserveBasedOnEstimates, WhenContainerFullThenGrowBasedOnPos) {
     EXPECT_TRUE(reservedAdditionalMem);
     EXPECT_EQ(280U, container.capacity());
 }
+
+namespace {
+std::string createZeInfoLikeText(size_t numKernels) {
+    std::string text = "version : '1.20'\nkernels:\n";
+    for (size_t i = 0; i < numKernels; ++i) {
+        auto kernelId = std::to_string(i);
+        text += "  - name:            kernel_" + kernelId + "\n"
+                "    execution_env:\n"
+                "      grf_count:       128\n"
+                "      simd_size:       32   # comment with \t tabs, 'quotes' and : colons\n"
+                "      required_work_group_size: [ 8, 4, 1 ]\n"
+                "    payload_arguments:\n"
+                "      - arg_type:        arg_bypointer\n"
+                "        offset:          " + kernelId + "\n"
+                "        size:            8\n"
+                "        addrmode:        stateless\n"
+                "        addrspace:       global\n"
+                "        access_type:     readwrite\n"
+                "        sampler_type:    \"sampler.type-name_x\"\n";
+    }
+    return text;
+}
+
+std::string createScannerInput(size_t size, size_t seed) {
+    const char alphabet[] = "abcXYZ019_-. \t\n#:\"'[]\r\x80\xff";
+    std::string input(size, ' ');
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        auto pick = static_cast<size_t>(seed >> 33);
+        // long runs of the same class so that vector loops are exercised
+        input[i] = (pick % 4 == 0) ? alphabet[pick % (sizeof(alphabet) - 1)] : input[(i > 0) ? i - 1 : 0];
+    }
+    return input;
+}
+} // namespace
+
+TEST(YamlScanner, givenAllKernelsWhenScanningThenResultsAreIdentical) {
+    struct KernelSet {
+        Scanner::ScanFunc scalar;
+        Scanner::ScanFunc sse4;
+        Scanner::ScanFunc dispatched;
+    };
+    const KernelSet kernelSets[] = {{ScannerKernels::skipSpacesScalar, ScannerKernels::skipSpacesSse4, Scanner::skipSpaces},
+                                    {ScannerKernels::skipToNewLineScalar, ScannerKernels::skipToNewLineSse4, Scanner::skipToNewLine},
+                                    {ScannerKernels::skipNameIdentifierScalar, ScannerKernels::skipNameIdentifierSse4, Scanner::skipNameIdentifier}};
+
+    for (size_t seed = 0; seed < 8; ++seed) {
+        auto input = createScannerInput(300u, seed);
+        auto end = input.data() + input.size();
+        for (const auto &kernels : kernelSets) {
+            for (auto pos = input.data(); pos <= end; ++pos) {
+                auto expected = kernels.scalar(pos, end);
+                EXPECT_EQ(expected, kernels.sse4(pos, end)) << "seed: " << seed << " offset: " << (pos - input.data());
+                EXPECT_EQ(expected, kernels.dispatched(pos, end)) << "seed: " << seed << " offset: " << (pos - input.data());
+            }
+        }
+    }
+}
+
+TEST(YamlScanner, givenEveryCharacterWhenScanningThenRunEndsOnlyOnCharactersOutsideOfTheRun) {
+    for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+        std::string input(40u, ' ');
+        input[37] = static_cast<char>(c);
+        auto end = input.data() + input.size();
+        auto charPos = input.data() + 37;
+        EXPECT_EQ((' ' == c) ? end : charPos, Scanner::skipSpaces(input.data(), end)) << c;
+
+        std::fill(input.begin(), input.end(), 'a');
+        input[37] = static_cast<char>(c);
+        EXPECT_EQ(('\n' == c) ? charPos : end, Scanner::skipToNewLine(input.data(), end)) << c;
+        bool continuesIdentifier = isNameIdentifierCharacter(static_cast<char>(c)) || isSeparationWhitespace(static_cast<char>(c));
+        EXPECT_EQ(continuesIdentifier ? end : charPos, Scanner::skipNameIdentifier(input.data(), end)) << c;
+    }
+}
+
+TEST(YamlScanner, givenRunReachingEndOfRangeWhenScanningThenCharactersPastEndAreNotInspected) {
+    std::string input(64u, ' ');
+    input[40] = 'x';
+    auto end = input.data() + 40;
+    EXPECT_EQ(end, Scanner::skipSpaces(input.data(), end));
+    EXPECT_EQ(end, ScannerKernels::skipSpacesSse4(input.data(), end));
+    EXPECT_EQ(input.data(), Scanner::skipSpaces(input.data(), input.data()));
+}
+
+TEST(YamlTokenize, givenScalarScannerKernelsWhenTokenizingThenOutputIsSameAsWithDefaultKernels) {
+    auto text = createZeInfoLikeText(16u);
+    text += "    # trailing comment without newline";
+
+    LinesCache lines;
+    TokensCache tokens;
+    std::string errors, warnings;
+    EXPECT_TRUE(NEO::Yaml::tokenize(text, lines, tokens, errors, warnings));
+
+    LinesCache scalarLines;
+    TokensCache scalarTokens;
+    std::string scalarErrors, scalarWarnings;
+    {
+        VariableBackup<Scanner::ScanFunc> skipSpacesBackup(&Scanner::skipSpaces, ScannerKernels::skipSpacesScalar);
+        VariableBackup<Scanner::ScanFunc> skipToNewLineBackup(&Scanner::skipToNewLine, ScannerKernels::skipToNewLineScalar);
+        VariableBackup<Scanner::ScanFunc> skipNameIdentifierBackup(&Scanner::skipNameIdentifier, ScannerKernels::skipNameIdentifierScalar);
+        EXPECT_TRUE(NEO::Yaml::tokenize(text, scalarLines, scalarTokens, scalarErrors, scalarWarnings));
+    }
+
+    EXPECT_EQ(errors, scalarErrors);
+    EXPECT_EQ(warnings, scalarWarnings);
+    ASSERT_EQ(tokens.size(), scalarTokens.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        EXPECT_EQ(tokens[i].pos, scalarTokens[i].pos) << i;
+        EXPECT_EQ(tokens[i].len, scalarTokens[i].len) << i;
+        EXPECT_EQ(tokens[i].traits.type, scalarTokens[i].traits.type) << i;
+    }
+    ASSERT_EQ(lines.size(), scalarLines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        EXPECT_EQ(lines[i].lineType, scalarLines[i].lineType) << i;
+        EXPECT_EQ(lines[i].indent, scalarLines[i].indent) << i;
+        EXPECT_EQ(lines[i].first, scalarLines[i].first) << i;
+        EXPECT_EQ(lines[i].last, scalarLines[i].last) << i;
+        EXPECT_EQ(lines[i].traits.packed, scalarLines[i].traits.packed) << i;
+    }
+}
@@ -4073,6 +4073,84 @@ TEST(DecodeZebinTest, givenGtpinInfoSectionsWhenDecodingZebinThenProperlySetIgcI
     EXPECT_EQ(0, memcmp(reinterpret_cast<const uint8_t *>(kernelInfo2->igcInfoForGtpin), mockGtpinData2.data(), mockGtpinData2.size()));
 }
 
+TEST(DecodeZebinTest, givenDeferredKernelMetadataDecodingWhenDecodingZebinThenOnlyKernelNameIsDecodedUntilMetadataIsRequested) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferZebinKernelMetadataDecoding.set(1);
+
+    std::string zeinfo = std::string("version :\'") + versionToString(Zebin::ZeInfo::zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : valid_empty_kernel
+      execution_env:
+        simd_size: 16
+      payload_arguments:
+        - arg_type : arg_bypointer
+          offset : 16
+          size : 8
+          arg_index : 0
+          addrmode : stateless
+          addrspace : global
+          access_type : readwrite
+)===";
+    NEO::ProgramInfo programInfo;
+    std::string errors, warnings;
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Zebin::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Zebin::Elf::SectionNames::zeInfo);
+    zebin.appendSection(NEO::Zebin::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Zebin::Elf::SectionNames::zeInfo, ArrayRef<const uint8_t>::fromAny(zeinfo.data(), zeinfo.size()));
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    auto err = decodeZebin(programInfo, elf, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::Success, err);
+    EXPECT_TRUE(errors.empty()) << errors;
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+
+    auto &kernelDescriptor = programInfo.kernelInfos[0]->kernelDescriptor;
+    EXPECT_STREQ("valid_empty_kernel", kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_TRUE(kernelDescriptor.hasDeferredMetadata());
+    EXPECT_EQ(0U, kernelDescriptor.kernelAttributes.simdSize);
+    EXPECT_TRUE(kernelDescriptor.payloadMappings.explicitArgs.empty());
+
+    EXPECT_TRUE(kernelDescriptor.decodeDeferredMetadata());
+    EXPECT_EQ(16U, kernelDescriptor.kernelAttributes.simdSize);
+    ASSERT_EQ(1U, kernelDescriptor.payloadMappings.explicitArgs.size());
+    EXPECT_EQ(16U, kernelDescriptor.payloadMappings.explicitArgs[0].as<ArgDescPointer>().stateless);
+    EXPECT_EQ(NEO::DeviceBinaryFormat::Zebin, kernelDescriptor.kernelAttributes.binaryFormat);
+
+    EXPECT_TRUE(kernelDescriptor.decodeDeferredMetadata());
+    EXPECT_EQ(1U, kernelDescriptor.payloadMappings.explicitArgs.size());
+}
+
+TEST(DecodeZebinTest, givenDeferredKernelMetadataDecodingAndInvalidKernelMetadataWhenDecodingZebinThenErrorIsReportedWhenMetadataIsRequested) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferZebinKernelMetadataDecoding.set(1);
+
+    std::string zeinfo = std::string("version :\'") + versionToString(Zebin::ZeInfo::zeInfoDecoderVersion) + R"===('
+kernels:
+    - name : valid_empty_kernel
+      execution_env:
+        simd_size: 8
+      payload_arguments:
+        - arg_type : unknown_arg_type
+          offset : 16
+          size : 8
+)===";
+    NEO::ProgramInfo programInfo;
+    std::string errors, warnings;
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.removeSection(NEO::Zebin::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Zebin::Elf::SectionNames::zeInfo);
+    zebin.appendSection(NEO::Zebin::Elf::SHT_ZEBIN::SHT_ZEBIN_ZEINFO, NEO::Zebin::Elf::SectionNames::zeInfo, ArrayRef<const uint8_t>::fromAny(zeinfo.data(), zeinfo.size()));
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    auto err = decodeZebin(programInfo, elf, errors, warnings);
+    EXPECT_EQ(NEO::DecodeError::Success, err);
+    ASSERT_EQ(1U, programInfo.kernelInfos.size());
+
+    auto &kernelDescriptor = programInfo.kernelInfos[0]->kernelDescriptor;
+    EXPECT_FALSE(kernelDescriptor.decodeDeferredMetadata());
+    EXPECT_FALSE(kernelDescriptor.decodeDeferredMetadata());
+}
+
 TEST_F(decodeZeInfoKernelEntryTest, GivenValidExecutionEnvironmentThenPopulateKernelDescriptorProperly) {
     ConstStringRef zeinfo = R"===(
 kernels:
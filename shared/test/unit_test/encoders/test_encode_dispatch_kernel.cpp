@@ -66,6 +66,26 @@ HWTEST_F(CommandEncodeStatesTest, givenDispatchInterfaceWhenDispatchKernelThenWa
     ASSERT_NE(itorPC, commands.end());
 }
 
+HWTEST_F(CommandEncodeStatesTest, givenDispatchInterfaceWhenDispatchKernelThenIndirectDataPointerIsReturnedInsideIndirectHeap) {
+    uint32_t dims[] = {2, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    EXPECT_EQ(nullptr, dispatchArgs.outIndirectDataPtr);
+
+    dispatchArgs.surfaceStateHeap = cmdContainer->getIndirectHeap(HeapType::SURFACE_STATE);
+    if (EncodeDispatchKernel<FamilyType>::isDshNeeded(pDevice->getDeviceInfo())) {
+        dispatchArgs.dynamicStateHeap = cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE);
+    }
+
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+
+    auto ioh = cmdContainer->getIndirectHeap(HeapType::INDIRECT_OBJECT);
+    ASSERT_NE(nullptr, dispatchArgs.outIndirectDataPtr);
+    EXPECT_LE(ioh->getCpuBase(), dispatchArgs.outIndirectDataPtr);
+    EXPECT_GE(ptrOffset(ioh->getCpuBase(), ioh->getUsed()), dispatchArgs.outIndirectDataPtr);
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDebugFlagSetWhenProgrammingWalkerThenSetFlushingBits) {
     DebugManagerStateRestore restore;
     DebugManager.flags.ForceComputeWalkerPostSyncFlush.set(1);
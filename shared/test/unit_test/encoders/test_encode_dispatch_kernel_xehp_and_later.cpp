@@ -1561,3 +1561,173 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesImplicitScalingSecondaryBufferTe
             givenDispatchImplicitScalingWithBbStartOverControlSectionWhenDispatchingAsSecondaryBufferContainerThenExpectSecondaryBatchBuffer) {
     testBodyFindPrimaryBatchBuffer<FamilyType>();
 }
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenWalkerTemplateCacheEnabledWhenDispatchingKernelTwiceThenTemplateIsReusedAndPerDispatchFieldsAreProgrammed) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWalkerTemplateCache.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->getSlmTotalSizeResult = 1;
+
+    uint32_t dims0[] = {2, 1, 1};
+    EncodeDispatchKernelArgs dispatchArgs0 = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims0, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs0);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+
+    uint32_t dims1[] = {4, 2, 1};
+    EncodeDispatchKernelArgs dispatchArgs1 = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims1, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs1);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+
+    auto walker0 = reinterpret_cast<WALKER_TYPE *>(dispatchArgs0.outWalkerPtr);
+    auto walker1 = reinterpret_cast<WALKER_TYPE *>(dispatchArgs1.outWalkerPtr);
+    ASSERT_NE(nullptr, walker0);
+    ASSERT_NE(nullptr, walker1);
+
+    auto &idd0 = walker0->getInterfaceDescriptor();
+    auto &idd1 = walker1->getInterfaceDescriptor();
+    EXPECT_EQ(idd0.getKernelStartPointer(), idd1.getKernelStartPointer());
+    EXPECT_EQ(idd0.getNumberOfThreadsInGpgpuThreadGroup(), idd1.getNumberOfThreadsInGpgpuThreadGroup());
+    EXPECT_EQ(idd0.getSharedLocalMemorySize(), idd1.getSharedLocalMemorySize());
+    EXPECT_EQ(idd0.getThreadPreemptionDisable(), idd1.getThreadPreemptionDisable());
+    EXPECT_EQ(idd0.getBindingTableEntryCount(), idd1.getBindingTableEntryCount());
+
+    EXPECT_EQ(2u, walker0->getThreadGroupIdXDimension());
+    EXPECT_EQ(1u, walker0->getThreadGroupIdYDimension());
+    EXPECT_EQ(4u, walker1->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker1->getThreadGroupIdYDimension());
+    EXPECT_NE(walker0->getIndirectDataStartAddress(), walker1->getIndirectDataStartAddress());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenWalkerTemplateCacheEnabledWhenKernelInvariantInputsChangeThenNewTemplateIsProgrammed) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWalkerTemplateCache.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    uint32_t dims[] = {2, 1, 1};
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+
+    dispatchInterface->groupSizes[0] = 64;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(2u, dispatchInterface->walkerTemplateCache.size());
+
+    const uint32_t slmTotalSize = static_cast<uint32_t>(64 * KB);
+    dispatchInterface->getSlmTotalSizeResult = slmTotalSize;
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(3u, dispatchInterface->walkerTemplateCache.size());
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(dispatchArgs.outWalkerPtr);
+    auto &gfxCoreHelper = this->getHelper<GfxCoreHelper>();
+    EXPECT_EQ(gfxCoreHelper.computeSlmValues(pDevice->getHardwareInfo(), slmTotalSize), walker->getInterfaceDescriptor().getSharedLocalMemorySize());
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    dispatchArgs.preemptionMode = PreemptionMode::MidThread;
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(4u, dispatchInterface->walkerTemplateCache.size());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenWalkerTemplateCacheEnabledWhenDebuggerIsAttachedAfterDispatchThenNewTemplateWithSoftwareExceptionIsProgrammed) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWalkerTemplateCache.set(1);
+
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.kernelAttributes.flags.usesAssert = true;
+    uint32_t dims[] = {2, 1, 1};
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+    auto walker = reinterpret_cast<WALKER_TYPE *>(dispatchArgs.outWalkerPtr);
+    ASSERT_NE(nullptr, walker);
+    EXPECT_FALSE(walker->getInterfaceDescriptor().getSoftwareExceptionEnable());
+
+    auto debugger = new MockDebuggerL0(pDevice);
+    pDevice->getRootDeviceEnvironmentRef().debugger.reset(debugger);
+
+    dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(2u, dispatchInterface->walkerTemplateCache.size());
+    walker = reinterpret_cast<WALKER_TYPE *>(dispatchArgs.outWalkerPtr);
+    ASSERT_NE(nullptr, walker);
+    EXPECT_TRUE(walker->getInterfaceDescriptor().getSoftwareExceptionEnable());
+}
+
+TEST(DispatchWalkerTemplateCacheTest, givenCachedTemplateWhenFindingThenTemplateIsCopiedOutOnlyForMatchingKey) {
+    DispatchWalkerTemplateCache cache;
+    DispatchWalkerTemplate::Key key;
+    key.kernelStartPointer = 0x1000u;
+
+    DispatchWalkerTemplate found;
+    EXPECT_FALSE(cache.find(key, found));
+
+    uint64_t walker[4] = {1u, 2u, 3u, 4u};
+    cache.add(key, walker, sizeof(walker));
+    EXPECT_TRUE(cache.find(key, found));
+    EXPECT_TRUE(found.key == key);
+    EXPECT_EQ(0, memcmp(walker, found.walker.data(), sizeof(walker)));
+
+    cache.clear();
+    EXPECT_TRUE(found.key == key);
+    EXPECT_EQ(4u, found.walker[3]);
+
+    cache.add(key, walker, sizeof(walker));
+    auto keyWithDebugger = key;
+    keyWithDebugger.debuggerActive = true;
+    EXPECT_FALSE(cache.find(keyWithDebugger, found));
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenWalkerTemplateCacheDisabledWhenDispatchingKernelThenTemplateIsNotStored) {
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    uint32_t dims[] = {2, 1, 1};
+
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+    EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+
+    EXPECT_EQ(0u, dispatchInterface->walkerTemplateCache.size());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenWalkerTemplateCacheEnabledWhenTemplateIsReusedThenWalkerIsIdenticalToUncachedEncode) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->getSlmTotalSizeResult = static_cast<uint32_t>(KB);
+    uint32_t dims[] = {4, 2, 1};
+
+    auto encodeWalker = [&](WALKER_TYPE &walker) {
+        cmdContainer->reset();
+        EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, false);
+        EncodeDispatchKernel<FamilyType>::encode(*cmdContainer.get(), dispatchArgs);
+        ASSERT_NE(nullptr, dispatchArgs.outWalkerPtr);
+        memcpy(&walker, dispatchArgs.outWalkerPtr, sizeof(WALKER_TYPE));
+    };
+
+    WALKER_TYPE uncachedWalker;
+    DebugManager.flags.EnableWalkerTemplateCache.set(0);
+    encodeWalker(uncachedWalker);
+    EXPECT_EQ(0u, dispatchInterface->walkerTemplateCache.size());
+
+    WALKER_TYPE cacheMissWalker;
+    DebugManager.flags.EnableWalkerTemplateCache.set(1);
+    encodeWalker(cacheMissWalker);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+
+    WALKER_TYPE cacheHitWalker;
+    encodeWalker(cacheHitWalker);
+    EXPECT_EQ(1u, dispatchInterface->walkerTemplateCache.size());
+
+    EXPECT_EQ(0, memcmp(&uncachedWalker, &cacheMissWalker, sizeof(WALKER_TYPE)));
+    EXPECT_EQ(0, memcmp(&uncachedWalker, &cacheHitWalker, sizeof(WALKER_TYPE)));
+}
@@ -45,6 +45,7 @@ EncodeDispatchKernelArgs CommandEncodeStatesFixture::createDefaultDispatchKernel
         nullptr,                  // dynamicStateHeap
         threadGroupDimensions,    // threadGroupDimensions
         nullptr,                  // outWalkerPtr
+        nullptr,                  // outIndirectDataPtr
         nullptr,                  // additionalCommands
         PreemptionMode::Disabled, // preemptionMode
         1,                        // partitionCount
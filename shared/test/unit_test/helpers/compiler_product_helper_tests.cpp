@@ -279,6 +279,21 @@ TEST_F(CompilerProductHelperFixture, givenHwInfoWithCLVersion30ThenReportsClKhrE
     EXPECT_FALSE(hasSubstr(extensions, std::string("cl_khr_external_memory")));
 }
 
+TEST_F(CompilerProductHelperFixture, givenClKhrCommandBufferExtensionDebugFlagWhenGettingDeviceExtensionsThenCommandBufferExtensionIsReportedOnlyWhenEnabled) {
+    auto &compilerProductHelper = pDevice->getCompilerProductHelper();
+    auto *releaseHelper = getReleaseHelper();
+    auto hwInfo = *defaultHwInfo;
+
+    auto extensions = compilerProductHelper.getDeviceExtensions(hwInfo, releaseHelper);
+    EXPECT_FALSE(hasSubstr(extensions, std::string("cl_khr_command_buffer")));
+
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.ClKhrCommandBufferExtension.set(1);
+
+    extensions = compilerProductHelper.getDeviceExtensions(hwInfo, releaseHelper);
+    EXPECT_TRUE(hasSubstr(extensions, std::string("cl_khr_command_buffer")));
+}
+
 HWTEST2_F(CompilerProductHelperFixture, GivenAtMostGen11DeviceWhenCheckingIfIntegerDotExtensionIsSupportedThenFalseReturned, IsAtMostGen11) {
     auto &compilerProductHelper = pDevice->getCompilerProductHelper();
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hash128.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+std::vector<char> createInput(size_t size) {
+    std::vector<char> input(size);
+    uint32_t state = 0x12345678u;
+    for (auto &value : input) {
+        state = state * 1664525u + 1013904223u;
+        value = static_cast<char>(state >> 24);
+    }
+    return input;
+}
+
+Hash128Value hashWithKernels(Hash128::AccumulateFunc accumulate, Hash128::ScrambleFunc scramble, const std::vector<char> &input) {
+    VariableBackup<Hash128::AccumulateFunc> accumulateBackup(&Hash128::accumulate, accumulate);
+    VariableBackup<Hash128::ScrambleFunc> scrambleBackup(&Hash128::scramble, scramble);
+    return Hash128::hash(input.data(), input.size());
+}
+} // namespace
+
+TEST(Hash128Tests, givenSameInputWhenHashIsCalculatedThenSameValuesAreGenerated) {
+    auto input = createInput(1000u);
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), Hash128::hash(input.data(), input.size()));
+}
+
+TEST(Hash128Tests, givenEmptyInputWhenHashIsCalculatedThenResultIsSameAsForNullInput) {
+    Hash128 hash;
+    hash.update(nullptr, 10u);
+    char value = 'a';
+    hash.update(&value, 0u);
+    EXPECT_EQ(Hash128().finish(), hash.finish());
+}
+
+TEST(Hash128Tests, givenDifferentInputsWhenHashIsCalculatedThenDifferentValuesAreGenerated) {
+    auto input = createInput(4096u);
+    auto baseHash = Hash128::hash(input.data(), input.size());
+
+    auto modifiedInput = input;
+    modifiedInput[2048] ^= 1;
+    EXPECT_NE(baseHash, Hash128::hash(modifiedInput.data(), modifiedInput.size()));
+
+    auto extendedInput = input;
+    extendedInput.push_back(0);
+    EXPECT_NE(baseHash, Hash128::hash(extendedInput.data(), extendedInput.size()));
+    EXPECT_NE(baseHash, Hash128::hash(input.data(), input.size() - 1));
+}
+
+TEST(Hash128Tests, givenInputSplitIntoChunksWhenHashIsCalculatedThenResultIsSameAsForSingleUpdate) {
+    auto input = createInput(10000u);
+    auto expectedHash = Hash128::hash(input.data(), input.size());
+
+    for (size_t chunkSize : {1u, 7u, 63u, 64u, 65u, 1000u, 1024u}) {
+        Hash128 hash;
+        for (size_t offset = 0; offset < input.size(); offset += chunkSize) {
+            hash.update(input.data() + offset, std::min(chunkSize, input.size() - offset));
+        }
+        EXPECT_EQ(expectedHash, hash.finish()) << "chunk size: " << chunkSize;
+    }
+}
+
+TEST(Hash128Tests, givenFinishedHashWhenMoreDataIsAddedThenHashContinuesFromPreviousState) {
+    auto input = createInput(300u);
+    Hash128 hash;
+    hash.update(input.data(), 100u);
+    auto partialHash = hash.finish();
+    hash.update(input.data() + 100u, 200u);
+
+    EXPECT_EQ(Hash128::hash(input.data(), 100u), partialHash);
+    EXPECT_EQ(Hash128::hash(input.data(), input.size()), hash.finish());
+
+    hash.reset();
+    EXPECT_EQ(Hash128().finish(), hash.finish());
+}
+
+TEST(Hash128Tests, givenAllKernelsWhenHashIsCalculatedThenResultsAreIdentical) {
+    for (size_t size : {0u, 1u, 63u, 64u, 1023u, 1024u, 1025u, 100000u}) {
+        auto input = createInput(size);
+        auto scalarHash = hashWithKernels(Hash128Kernels::accumulateScalar, Hash128Kernels::scrambleScalar, input);
+        EXPECT_EQ(scalarHash, hashWithKernels(Hash128Kernels::accumulateSse4, Hash128Kernels::scrambleSse4, input)) << "size: " << size;
+        EXPECT_EQ(scalarHash, Hash128::hash(input.data(), input.size())) << "size: " << size;
+    }
+}
+
+TEST(Hash128Tests, givenHashValueWhenConvertedToStringThenZeroPaddedHexOfHighAndLowPartIsReturned) {
+    Hash128Value value;
+    value.high = 0x1u;
+    value.low = 0xabcdefu;
+    EXPECT_STREQ("00000000000000010000000000abcdef", value.toString().c_str());
+    EXPECT_EQ(32u, Hash128::hash("a", 1u).toString().size());
+}
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
+#include "shared/source/kernel/dispatch_walker_template_cache.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/mock_method_macros.h"
@@ -31,6 +32,8 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
 
     void patchBindlessOffsetsInCrossThreadData(uint64_t bindlessSurfaceStateBaseOffset) const override { return; };
 
+    DispatchWalkerTemplateCache *getWalkerTemplateCache() override { return &walkerTemplateCache; }
+
     MockGraphicsAllocation mockAllocation{};
     static constexpr uint32_t crossThreadSize = 0x40;
     static constexpr uint32_t perThreadSize = 0x20;
@@ -39,6 +42,7 @@ struct MockDispatchKernelEncoder : public DispatchKernelEncoderI {
     uint32_t groupSizes[3]{32, 1, 1};
     uint32_t requiredWalkGroupOrder = 0x0u;
     KernelDescriptor kernelDescriptor{};
+    DispatchWalkerTemplateCache walkerTemplateCache;
 
     ADDMETHOD_CONST_NOBASE(getKernelDescriptor, const KernelDescriptor &, kernelDescriptor, ());
     ADDMETHOD_CONST_NOBASE(getGroupSize, const uint32_t *, groupSizes, ());
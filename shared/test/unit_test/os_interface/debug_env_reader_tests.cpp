@@ -12,6 +12,7 @@
 #include "shared/test/common/test_macros/test.h"
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 
 namespace NEO {
@@ -489,6 +490,39 @@ TEST_F(DebugEnvReaderTests, WhenSettingAppSpecificLocationThenLocationIsReturned
     EXPECT_EQ(appSpecific, environmentVariableReader->appSpecificLocation(appSpecific));
 }
 
+TEST(DebugEnvReaderSnapshotTests, givenEnvironmentBlockWhenGettingSettingsThenValuesAreReadFromSnapshotWithoutCallingGetenv) {
+    char neoVariable[] = "NEO_TestingVariable=1234";
+    char variable[] = "TestingVariable=5";
+    char stringVariable[] = "TestingString=Expected=Value";
+    char malformedEntry[] = "MalformedEntry";
+    char duplicatedVariable[] = "TestingVariable=6";
+    char *environment[] = {neoVariable, variable, stringVariable, malformedEntry, duplicatedVariable, nullptr};
+
+    VariableBackup<ApiSpecificConfig::ApiType> backup(&apiTypeForUlts, ApiSpecificConfig::L0);
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    EnvironmentVariableReader environmentVariableReader(environment);
+
+    DebugVarPrefix type = DebugVarPrefix::None;
+    EXPECT_EQ(1234, environmentVariableReader.getSetting("TestingVariable", 1, type));
+    EXPECT_EQ(DebugVarPrefix::Neo, type);
+    EXPECT_EQ(5, environmentVariableReader.getSetting("TestingVariable", 1));
+    EXPECT_EQ("Expected=Value", environmentVariableReader.getSetting("TestingString", std::string("Default")));
+    EXPECT_EQ("Default", environmentVariableReader.getSetting("MalformedEntry", std::string("Default")));
+    EXPECT_EQ(7, environmentVariableReader.getSetting("UnsetVariable", 7, type));
+    EXPECT_EQ(DebugVarPrefix::None, type);
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+}
+
+TEST(DebugEnvReaderSnapshotTests, givenNoEnvironmentBlockWhenGettingSettingThenGetenvIsUsed) {
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    std::unordered_map<std::string, std::string> mockableEnvs = {{"TestingVariable", "1234"}};
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&IoFunctions::mockableEnvValues, &mockableEnvs);
+
+    EnvironmentVariableReader environmentVariableReader(nullptr);
+    EXPECT_EQ(1234, environmentVariableReader.getSetting("TestingVariable", 1));
+    EXPECT_EQ(1u, IoFunctions::mockGetenvCalled);
+}
+
 TEST_F(DebugEnvReaderTests, givenEnvironmentVariableReaderWhenCreateOsReaderWithStringThenNotNullPointer) {
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, ""));
     EXPECT_NE(nullptr, settingsReader);
@@ -130,3 +130,59 @@ TEST(DeviceFactoryAffinityMaskTest, whenAffinityMaskDoesNotSelectAnyDeviceThenEm
 
     EXPECT_EQ(0u, executionEnvironment.rootDeviceEnvironments.size());
 }
+
+TEST(SortAndFilterDevicesDrmTest, givenParallelRootDeviceInitializationDisabledWhenPreparingDeviceEnvironmentsThenDevicesAreSortedTheSameWay) {
+    static const auto numRootDevices = 6;
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.CreateMultipleRootDevices.set(numRootDevices);
+    DebugManager.flags.ParallelRootDeviceInitialization.set(0);
+
+    VariableBackup<uint32_t> osContextCountBackup(&MemoryManager::maxOsContextCount);
+    VariableBackup<std::map<std::string, std::vector<std::string>>> directoryFilesMapBackup(&directoryFilesMap);
+    VariableBackup<const char *> pciDevicesDirectoryBackup(&Os::pciDevicesDirectory);
+    VariableBackup<decltype(SysCalls::sysCallsOpen)> mockOpen(&SysCalls::sysCallsOpen, [](const char *pathname, int flags) -> int {
+        return SysCalls::fakeFileDescriptor;
+    });
+
+    Os::pciDevicesDirectory = "/";
+    directoryFilesMap.clear();
+    directoryFilesMap[Os::pciDevicesDirectory] = {};
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0003:01:02.1-render");
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0000:00:02.0-render");
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0000:01:03.0-render");
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0000:01:02.1-render");
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0000:00:02.1-render");
+    directoryFilesMap[Os::pciDevicesDirectory].push_back("/pci-0003:01:02.0-render");
+
+    ExecutionEnvironment executionEnvironment{};
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    EXPECT_TRUE(success);
+
+    EXPECT_EQ(static_cast<size_t>(numRootDevices), executionEnvironment.rootDeviceEnvironments.size());
+
+    NEO::PhysicalDevicePciBusInfo expectedBusInfos[numRootDevices] = {{0, 0, 2, 0}, {0, 0, 2, 1}, {0, 1, 2, 1}, {0, 1, 3, 0}, {3, 1, 2, 0}, {3, 1, 2, 1}};
+
+    for (uint32_t rootDeviceIndex = 0; rootDeviceIndex < numRootDevices; rootDeviceIndex++) {
+        auto pciBusInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->osInterface->getDriverModel()->getPciBusInfo();
+        EXPECT_EQ(expectedBusInfos[rootDeviceIndex].pciDomain, pciBusInfo.pciDomain);
+        EXPECT_EQ(expectedBusInfos[rootDeviceIndex].pciBus, pciBusInfo.pciBus);
+        EXPECT_EQ(expectedBusInfos[rootDeviceIndex].pciDevice, pciBusInfo.pciDevice);
+        EXPECT_EQ(expectedBusInfos[rootDeviceIndex].pciFunction, pciBusInfo.pciFunction);
+        EXPECT_NE(nullptr, executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getGmmHelper());
+    }
+}
+
+TEST_F(DeviceFactoryLinuxTest, givenPrintRootDeviceInitializationTimesWhenPreparingDeviceEnvironmentsThenTimeOfEachPhaseIsPrinted) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.PrintRootDeviceInitializationTimes.set(true);
+
+    testing::internal::CaptureStdout();
+    bool success = DeviceFactory::prepareDeviceEnvironments(executionEnvironment);
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_TRUE(success);
+    EXPECT_NE(std::string::npos, output.find("Root device initialization - device discovery: "));
+    EXPECT_NE(std::string::npos, output.find("Root device initialization - os interface [0]: "));
+    EXPECT_NE(std::string::npos, output.find("Root device initialization - root device environments: "));
+    EXPECT_NE(std::string::npos, output.find("Root device initialization - execution environment setup: "));
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(DrmQueryCacheTest, givenStoredQueriesWhenCacheIsSerializedAndDeserializedWithSameKeyThenAllQueriesAreRestored) {
+    const uint64_t engines[] = {0x1u, 0x2u, 0x3u};
+    const uint8_t topology[] = {0xffu, 0x0fu, 0x3u};
+
+    DrmQueryCache queryCache("", "0000:03:00.0;i915 1.6.0 20201103;6.2.0;56a0.8");
+    EXPECT_FALSE(queryCache.isModified());
+    queryCache.storeQueryData(1u, 0u, engines, sizeof(engines));
+    queryCache.storeQueryData(2u, 0x100u, topology, sizeof(topology));
+    EXPECT_TRUE(queryCache.isModified());
+
+    DrmQueryCache restoredQueryCache("", "0000:03:00.0;i915 1.6.0 20201103;6.2.0;56a0.8");
+    EXPECT_TRUE(restoredQueryCache.deserialize(queryCache.serialize()));
+    EXPECT_FALSE(restoredQueryCache.isModified());
+
+    auto restoredEngines = restoredQueryCache.getQueryData(1u, 0u);
+    ASSERT_NE(nullptr, restoredEngines);
+    ASSERT_EQ(sizeof(engines), restoredEngines->size());
+    EXPECT_EQ(0, memcmp(engines, restoredEngines->data(), sizeof(engines)));
+
+    auto restoredTopology = restoredQueryCache.getQueryData(2u, 0x100u);
+    ASSERT_NE(nullptr, restoredTopology);
+    ASSERT_EQ(sizeof(topology), restoredTopology->size());
+    EXPECT_EQ(0, memcmp(topology, restoredTopology->data(), sizeof(topology)));
+
+    EXPECT_EQ(nullptr, restoredQueryCache.getQueryData(2u, 0u));
+}
+
+TEST(DrmQueryCacheTest, givenCacheCreatedWithDifferentKeyWhenDeserializingThenCacheIsRejected) {
+    const uint64_t engines[] = {0x1u, 0x2u};
+
+    DrmQueryCache queryCache("", "0000:03:00.0;i915 1.6.0 20201103;6.2.0;56a0.8");
+    queryCache.storeQueryData(1u, 0u, engines, sizeof(engines));
+    auto serialized = queryCache.serialize();
+
+    DrmQueryCache otherKernelQueryCache("", "0000:03:00.0;i915 1.6.0 20201103;6.5.0;56a0.8");
+    EXPECT_FALSE(otherKernelQueryCache.deserialize(serialized));
+    EXPECT_EQ(nullptr, otherKernelQueryCache.getQueryData(1u, 0u));
+
+    DrmQueryCache otherDeviceQueryCache("", "0000:04:00.0;i915 1.6.0 20201103;6.2.0;56a0.8");
+    EXPECT_FALSE(otherDeviceQueryCache.deserialize(serialized));
+    EXPECT_EQ(nullptr, otherDeviceQueryCache.getQueryData(1u, 0u));
+}
+
+TEST(DrmQueryCacheTest, givenCorruptedOrTruncatedCacheWhenDeserializingThenCacheIsRejected) {
+    const uint64_t engines[] = {0x1u, 0x2u};
+
+    DrmQueryCache queryCache("", "key");
+    queryCache.storeQueryData(1u, 0u, engines, sizeof(engines));
+    auto serialized = queryCache.serialize();
+
+    DrmQueryCache restoredQueryCache("", "key");
+    EXPECT_FALSE(restoredQueryCache.deserialize({}));
+    EXPECT_FALSE(restoredQueryCache.deserialize(ArrayRef<const uint8_t>(serialized.data(), serialized.size() - 1)));
+
+    auto corrupted = serialized;
+    corrupted.back() ^= 0xffu;
+    EXPECT_FALSE(restoredQueryCache.deserialize(corrupted));
+    EXPECT_EQ(nullptr, restoredQueryCache.getQueryData(1u, 0u));
+
+    EXPECT_TRUE(restoredQueryCache.deserialize(serialized));
+    EXPECT_NE(nullptr, restoredQueryCache.getQueryData(1u, 0u));
+}
+
+TEST(DrmQueryCacheTest, givenQueryCacheWhenSameQueryIsIssuedAgainThenCachedDataIsReturnedWithoutIoctl) {
+    MockExecutionEnvironment executionEnvironment{};
+    DrmMock drm(*executionEnvironment.rootDeviceEnvironments[0]);
+    drm.queryCache = std::make_unique<DrmQueryCache>("", "key");
+    auto queryId = drm.getIoctlHelper()->getDrmParamValue(DrmParam::QueryTopologyInfo);
+
+    auto queriedData = drm.query<uint64_t>(queryId, 0u);
+    ASSERT_FALSE(queriedData.empty());
+    EXPECT_EQ(2, drm.ioctlCount.query);
+    EXPECT_TRUE(drm.queryCache->isModified());
+    EXPECT_NE(nullptr, drm.queryCache->getQueryData(queryId, 0u));
+
+    auto cachedData = drm.query<uint64_t>(queryId, 0u);
+    EXPECT_EQ(2, drm.ioctlCount.query);
+    EXPECT_EQ(queriedData, cachedData);
+
+    drm.queryCache.reset();
+    drm.query<uint64_t>(queryId, 0u);
+    EXPECT_EQ(4, drm.ioctlCount.query);
+}
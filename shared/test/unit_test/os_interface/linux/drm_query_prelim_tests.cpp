@@ -556,3 +556,70 @@ TEST(DrmTestPrelim, givenHungContextWhenCallingWaitUserFenceThenSmallTimeoutIsPa
     EXPECT_EQ(value, waitUserFence->value);
     EXPECT_EQ(1, waitUserFence->timeout);
 }
+
+TEST(DrmQueryTest, givenMultipleQueryItemsWhenQueryingInBatchThenTwoIoctlsAreIssuedAndDataMatchesSingleQueries) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    std::vector<QueryItem> queryItems(2);
+    queryItems[0].queryId = DRM_I915_QUERY_ENGINE_INFO;
+    queryItems[1].queryId = DRM_I915_QUERY_MEMORY_REGIONS;
+    std::vector<std::vector<uint8_t>> queryData;
+
+    EXPECT_EQ(0, drm.getIoctlHelper()->queryBatch(queryItems, queryData));
+    EXPECT_EQ(2u, drm.ioctlCallsCount);
+    ASSERT_EQ(2u, queryData.size());
+
+    for (auto i = 0u; i < queryItems.size(); i++) {
+        auto singleQueryData = drm.query<uint64_t>(queryItems[i].queryId, 0);
+        EXPECT_EQ(static_cast<size_t>(queryItems[i].length), queryData[i].size());
+        ASSERT_LE(queryData[i].size(), singleQueryData.size() * sizeof(uint64_t));
+        EXPECT_EQ(0, memcmp(singleQueryData.data(), queryData[i].data(), queryData[i].size()));
+    }
+}
+
+TEST(DrmQueryTest, givenUnsupportedQueryItemInBatchWhenQueryingInBatchThenOnlyItsDataIsEmpty) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    std::vector<QueryItem> queryItems(2);
+    queryItems[0].queryId = 0x1234u;
+    queryItems[1].queryId = DRM_I915_QUERY_ENGINE_INFO;
+    std::vector<std::vector<uint8_t>> queryData;
+
+    EXPECT_EQ(0, drm.getIoctlHelper()->queryBatch(queryItems, queryData));
+    EXPECT_EQ(2u, drm.ioctlCallsCount);
+    EXPECT_EQ(-EINVAL, queryItems[0].length);
+    EXPECT_TRUE(queryData[0].empty());
+    EXPECT_FALSE(queryData[1].empty());
+}
+
+TEST(DrmQueryTest, givenPrefetchedQueriesWhenQueryingThenDataIsReturnedOnceWithoutIoctl) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.prefetchQueries({DRM_I915_QUERY_ENGINE_INFO, DRM_I915_QUERY_MEMORY_REGIONS});
+    EXPECT_EQ(2u, drm.ioctlCallsCount);
+    drm.ioctlCallsCount = 0;
+
+    auto engineInfoData = drm.query<uint64_t>(DRM_I915_QUERY_ENGINE_INFO, 0);
+    auto memoryRegionsData = drm.query<uint64_t>(DRM_I915_QUERY_MEMORY_REGIONS, 0);
+    EXPECT_FALSE(engineInfoData.empty());
+    EXPECT_FALSE(memoryRegionsData.empty());
+    EXPECT_EQ(0u, drm.ioctlCallsCount);
+
+    EXPECT_EQ(engineInfoData, drm.query<uint64_t>(DRM_I915_QUERY_ENGINE_INFO, 0));
+    EXPECT_EQ(2u, drm.ioctlCallsCount);
+}
+
+TEST(DrmQueryTest, givenPrefetchedQueriesWhenReleasingQueryCacheThenUnusedDataIsDropped) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    DrmQueryMock drm{*executionEnvironment->rootDeviceEnvironments[0]};
+
+    drm.prefetchQueries({DRM_I915_QUERY_ENGINE_INFO});
+    drm.releaseQueryCache();
+    drm.ioctlCallsCount = 0;
+
+    EXPECT_FALSE(drm.query<uint64_t>(DRM_I915_QUERY_ENGINE_INFO, 0).empty());
+    EXPECT_EQ(2u, drm.ioctlCallsCount);
+}
@@ -673,6 +673,58 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, givenDeviceWithMultipleSubdevicesWhen
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenNotInitializedOsContextWhenMakeResidentThenAllocationIsBoundOnFirstSubmissionToThatContext) {
+    struct MockOsContextLinux : OsContextLinux {
+        using OsContext::contextInitialized;
+    };
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    auto &engines = device->getAllEngines();
+    ASSERT_LT(1u, engines.size());
+    auto deferredOsContext = static_cast<MockOsContextLinux *>(engines[1].osContext);
+    auto deferredContextId = deferredOsContext->getContextId();
+    deferredOsContext->contextInitialized = false;
+
+    EXPECT_EQ(operationHandler->makeResident(device, ArrayRef<GraphicsAllocation *>(&allocation, 1)), MemoryOperationsStatus::SUCCESS);
+    EXPECT_FALSE(deferredOsContext->isInitialized());
+    EXPECT_TRUE(allocation->isAlwaysResident(engines[0].osContext->getContextId()));
+    EXPECT_FALSE(allocation->isAlwaysResident(deferredContextId));
+    EXPECT_EQ(operationHandler->isResident(device, *allocation), MemoryOperationsStatus::SUCCESS);
+
+    deferredOsContext->contextInitialized = true;
+    ResidencyContainer residencyContainer;
+    EXPECT_EQ(operationHandler->mergeWithResidencyContainer(deferredOsContext, residencyContainer), MemoryOperationsStatus::SUCCESS);
+    EXPECT_TRUE(allocation->isAlwaysResident(deferredContextId));
+    EXPECT_EQ(operationHandler->isResident(device, *allocation), MemoryOperationsStatus::SUCCESS);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenNotInitializedOsContextWhenEvictBeforeFirstSubmissionThenAllocationIsNotBoundInThatContext) {
+    struct MockOsContextLinux : OsContextLinux {
+        using OsContext::contextInitialized;
+    };
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+
+    auto &engines = device->getAllEngines();
+    ASSERT_LT(1u, engines.size());
+    auto deferredOsContext = static_cast<MockOsContextLinux *>(engines[1].osContext);
+    deferredOsContext->contextInitialized = false;
+
+    EXPECT_EQ(operationHandler->makeResident(device, ArrayRef<GraphicsAllocation *>(&allocation, 1)), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(operationHandler->evict(device, *allocation), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(operationHandler->isResident(device, *allocation), MemoryOperationsStatus::MEMORY_NOT_FOUND);
+
+    deferredOsContext->contextInitialized = true;
+    ResidencyContainer residencyContainer;
+    EXPECT_EQ(operationHandler->mergeWithResidencyContainer(deferredOsContext, residencyContainer), MemoryOperationsStatus::SUCCESS);
+    EXPECT_FALSE(allocation->isAlwaysResident(deferredOsContext->getContextId()));
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, whenIoctlFailDuringEvictingThenUnrecoverableIsThrown) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -9,8 +9,11 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/linux/drm_mock.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_io_functions.h"
 
 #include "gtest/gtest.h"
 
@@ -47,4 +50,23 @@ TEST(OsInterfaceTest, GivenLinuxOsInterfaceWhenCallingIsDebugAttachAvailableThen
     EXPECT_FALSE(osInterface.isDebugAttachAvailable());
 }
 
+TEST(OsInterfaceTest, GivenUserScopeOsReaderWhenEnvironmentChangesThenNewValueIsReturned) {
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+    std::unordered_map<std::string, std::string> mockableEnvs = {{"AUBDumpToggleCaptureOnOff", "0"}};
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&IoFunctions::mockableEnvValues, &mockableEnvs);
+
+    std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(true, ""));
+    EXPECT_FALSE(settingsReader->getSetting("AUBDumpToggleCaptureOnOff", false));
+
+    mockableEnvs["AUBDumpToggleCaptureOnOff"] = "1";
+    EXPECT_TRUE(settingsReader->getSetting("AUBDumpToggleCaptureOnOff", false));
+    EXPECT_EQ(0u, IoFunctions::mockGetEnvironmentCalled);
+}
+
+TEST(OsInterfaceTest, GivenOsReaderWhenCreatedThenEnvironmentIsReadOnce) {
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+
+    std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, ""));
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+}
 } // namespace NEO
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_pool.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+TEST(ThreadPoolTest, givenPoolWithoutThreadsWhenTaskIsEnqueuedThenItIsExecutedInline) {
+    ThreadPool threadPool(0u);
+    auto callerThreadId = std::this_thread::get_id();
+    std::thread::id taskThreadId;
+
+    auto future = threadPool.enqueue([&]() { taskThreadId = std::this_thread::get_id(); });
+
+    EXPECT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(callerThreadId, taskThreadId);
+}
+
+TEST(ThreadPoolTest, givenPoolWithThreadsWhenTasksAreEnqueuedThenAllAreExecutedOnWorkerThreads) {
+    ThreadPool threadPool(4u);
+    EXPECT_EQ(4u, threadPool.getNumThreads());
+
+    auto callerThreadId = std::this_thread::get_id();
+    std::atomic<uint32_t> executedTasks{0u};
+    std::atomic<uint32_t> tasksOnCallerThread{0u};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 64; i++) {
+        futures.push_back(threadPool.enqueue([&]() {
+            executedTasks++;
+            if (std::this_thread::get_id() == callerThreadId) {
+                tasksOnCallerThread++;
+            }
+        }));
+    }
+    for (auto &future : futures) {
+        future.wait();
+    }
+
+    EXPECT_EQ(64u, executedTasks);
+    EXPECT_EQ(0u, tasksOnCallerThread);
+}
+
+TEST(ThreadPoolTest, givenPendingTasksWhenPoolIsDestroyedThenQueueIsDrained) {
+    std::atomic<uint32_t> executedTasks{0u};
+    {
+        ThreadPool threadPool(1u);
+        for (int i = 0; i < 16; i++) {
+            threadPool.enqueue([&]() {
+                std::this_thread::yield();
+                executedTasks++;
+            });
+        }
+    }
+    EXPECT_EQ(16u, executedTasks);
+}
+
+TEST(ThreadPoolTest, givenTaskThrowingExceptionWhenWaitingForResultThenExceptionIsPropagatedAndPoolKeepsWorking) {
+    ThreadPool threadPool(1u);
+    auto throwingTask = threadPool.enqueue([]() { throw std::runtime_error("error"); });
+    EXPECT_THROW(throwingTask.get(), std::runtime_error);
+
+    bool executed = false;
+    threadPool.enqueue([&]() { executed = true; }).wait();
+    EXPECT_TRUE(executed);
+}
+
+TEST(ThreadPoolTest, givenPoolWithThreadsWhenParallelForIsCalledThenEachIndexIsProcessedExactlyOnce) {
+    ThreadPool threadPool(4u);
+    std::vector<std::atomic<uint32_t>> processed(100);
+
+    threadPool.parallelFor(processed.size(), [&](size_t index) { processed[index]++; });
+
+    for (auto &count : processed) {
+        EXPECT_EQ(1u, count);
+    }
+}
+
+TEST(ThreadPoolTest, givenPoolWithoutThreadsWhenParallelForIsCalledThenIndicesAreProcessedInOrderOnCallerThread) {
+    ThreadPool threadPool(0u);
+    auto callerThreadId = std::this_thread::get_id();
+    std::vector<size_t> processedIndices;
+    bool allOnCallerThread = true;
+
+    threadPool.parallelFor(8u, [&](size_t index) {
+        processedIndices.push_back(index);
+        allOnCallerThread &= (std::this_thread::get_id() == callerThreadId);
+    });
+
+    EXPECT_EQ((std::vector<size_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u}), processedIndices);
+    EXPECT_TRUE(allOnCallerThread);
+}
+
+TEST(ThreadPoolTest, givenParallelForCalledFromPoolTaskWhenPoolHasSingleThreadThenItCompletesWithoutDeadlock) {
+    ThreadPool threadPool(1u);
+    std::atomic<uint32_t> processed{0u};
+
+    auto outerTask = [&]() {
+        threadPool.parallelFor(16u, [&](size_t index) { processed++; });
+    };
+    threadPool.enqueue(outerTask).wait();
+
+    EXPECT_EQ(16u, processed);
+}
+
+TEST(ThreadPoolTest, whenGettingDefaultNumberOfThreadsThenItIsWithinLimits) {
+    auto numThreads = ThreadPool::getDefaultNumThreads();
+    EXPECT_LE(1u, numThreads);
+    EXPECT_GE(16u, numThreads);
+}